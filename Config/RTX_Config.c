@@ -27,12 +27,18 @@
  
 #include "cmsis_compiler.h"
 #include "rtx_os.h"
+#include "RTX_Config.h"
  
 // OS Idle Thread
 __WEAK __NO_RETURN void osRtxIdleThread (void *argument) {
   (void)argument;
 
-  for (;;) {}
+  for (;;) {
+#if (defined(OS_TICKLESS_IDLE) && (OS_TICKLESS_IDLE != 0))
+    // Sleep until the next timed event with the Kernel Tick stopped
+    osRtxKernelIdleSleep();
+#endif
+  }
 }
  
 // OS Error Callback function
@@ -58,6 +64,10 @@ __WEAK uint32_t osRtxErrorNotify (uint32_t code, void *object_id) {
     case osRtxErrorSVC:
       // Invalid SVC function called (function=object_id)
       break;
+    case osRtxErrorDeadlineMiss:
+      // Deadline missed by thread (thread_id=object_id): continue execution
+      //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+      return 0U;
     default:
       // Reserved
       break;
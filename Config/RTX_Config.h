@@ -47,6 +47,13 @@
 #define OS_DYNAMIC_MEM_SIZE         32768
 #endif
  
+//   <q>TLSF memory allocator
+//   <i> Uses a two-level segregated fit allocator for dynamic memory (requires RTX source variant).
+//   <i> Enabling this option makes memory allocation and release independent of the number of allocated blocks.
+#ifndef OS_MEMORY_TLSF
+#define OS_MEMORY_TLSF              0
+#endif
+ 
 //   <o>Kernel Tick Frequency [Hz] <1-1000000>
 //   <i> Defines base time unit for delays and timeouts.
 //   <i> Default: 1000 (1ms tick)
@@ -54,6 +61,20 @@
 #define OS_TICK_FREQ                1000
 #endif
  
+//   <q>Hierarchical timing wheel
+//   <i> Organizes thread delays and active timers in a hierarchical timing wheel (requires RTX source variant).
+//   <i> Enabling this option makes timeout insertion and removal independent of the number of pending timeouts.
+#ifndef OS_TIMING_WHEEL
+#define OS_TIMING_WHEEL             0
+#endif
+ 
+//   <q>Tickless Idle
+//   <i> Stops the periodic Kernel Tick while the Idle Thread sleeps until the next timed event.
+//   <i> The OS Tick timer is reprogrammed with OS_Tick_SleepEnter and OS_Tick_SleepExit (default uses SysTick).
+#ifndef OS_TICKLESS_IDLE
+#define OS_TICKLESS_IDLE            0
+#endif
+ 
 //   <e>Round-Robin Thread switching
 //   <i> Enables Round-Robin Thread switching.
 #ifndef OS_ROBIN_ENABLE
@@ -134,6 +155,40 @@
 #define OS_ISR_FIFO_QUEUE           16
 #endif
  
+//   <e>Deferred Work
+//   <i> Enables osRtxWorkSubmit to defer work items from interrupt handlers (requires RTX source variant).
+//   <i> Work items are executed by PendSV (soft IRQ level) or by the Work Thread (thread level).
+#ifndef OS_WORK_QUEUE
+#define OS_WORK_QUEUE               0
+#endif
+ 
+//     <o>Work Batch size <1-256>
+//     <i> Defines the maximum number of work items executed in one batch.
+//     <i> Default: 8
+#ifndef OS_WORK_BATCH
+#define OS_WORK_BATCH               8
+#endif
+ 
+//     <o>Work Thread Priority
+//        <8=> Low
+//       <16=> Below Normal  <24=> Normal  <32=> Above Normal
+//       <40=> High
+//       <48=> Realtime
+//     <i> Defines priority for Work Thread.
+//     <i> Default: High
+#ifndef OS_WORK_THREAD_PRIO
+#define OS_WORK_THREAD_PRIO         40
+#endif
+ 
+//     <o>Work Thread Stack size [bytes] <96-1073741824:8>
+//     <i> Defines stack size for Work Thread.
+//     <i> Default: 512
+#ifndef OS_WORK_THREAD_STACK_SIZE
+#define OS_WORK_THREAD_STACK_SIZE   512
+#endif
+ 
+//   </e>
+ 
 //   <q>Object Memory usage counters
 //   <i> Enables object memory usage counters (requires RTX source variant).
 #ifndef OS_OBJ_MEM_USAGE
@@ -225,6 +280,54 @@
 #define OS_STACK_WATERMARK          0
 #endif
  
+//   <q>Ready queue priority bitmap
+//   <i> Organizes ready threads in per-priority FIFO lists indexed by a priority bitmap (requires RTX source variant).
+//   <i> Enabling this option makes thread wakeup and preemption independent of the number of ready threads.
+#ifndef OS_THREAD_READY_BITMAP
+#define OS_THREAD_READY_BITMAP      0
+#endif
+ 
+//   <q>Thread run time accounting
+//   <i> Accumulates run time, preemptions and voluntary context switches per thread (requires RTX source variant).
+//   <i> Run time is measured in system timer counts and read with osRtxThreadGetRunTime and osRtxKernelGetRunTime.
+#ifndef OS_THREAD_RUN_TIME
+#define OS_THREAD_RUN_TIME          0
+#endif
+ 
+//   <e>Earliest deadline first scheduling
+//   <i> Schedules threads with a deadline by their absolute deadline within one priority level (requires RTX source variant).
+//   <i> Deadlines are assigned with osRtxThreadSetDeadline and missed deadlines are reported to osRtxErrorNotify.
+#ifndef OS_THREAD_EDF
+#define OS_THREAD_EDF               0
+#endif
+ 
+//     <o>Deadline scheduling Priority
+//        <8=> Low
+//       <16=> Below Normal  <24=> Normal  <32=> Above Normal
+//       <40=> High
+//       <48=> Realtime
+//     <i> Defines priority level of threads with a deadline.
+//     <i> Default: High
+#ifndef OS_THREAD_EDF_PRIO
+#define OS_THREAD_EDF_PRIO          40
+#endif
+ 
+//   </e>
+ 
+//   <q>Thread execution budget
+//   <i> Limits the kernel ticks a thread runs within each replenishment period (requires RTX source variant).
+//   <i> Budgets are assigned with osRtxThreadSetBudget. A thread exceeding its budget is demoted or suspended.
+#ifndef OS_THREAD_BUDGET
+#define OS_THREAD_BUDGET            0
+#endif
+ 
+//   <q>Wait for multiple objects
+//   <i> Enables osRtxThreadWaitAny to wait for semaphores, event flags and message queues (requires RTX source variant).
+//   <i> Signaling an object then also checks the threads waiting for multiple objects.
+#ifndef OS_THREAD_WAIT_ANY
+#define OS_THREAD_WAIT_ANY          0
+#endif
+ 
 //   <o>Default Processor mode for Thread execution
 //     <0=> Unprivileged mode
 //     <1=> Privileged mode
@@ -302,6 +405,27 @@
 #define OS_TIMER_CB_QUEUE           4
 #endif
  
+//   <q>Expired Timer List
+//   <i> Passes expired timers to the Timer Thread in a list instead of the Timer Callback Queue (requires RTX source variant).
+//   <i> The list cannot overflow; Timer Callback Queue entries only need to be non-zero.
+#ifndef OS_TIMER_EXPIRED_LIST
+#define OS_TIMER_EXPIRED_LIST       0
+#endif
+ 
+//   <q>Merge Periods missed during Kernel Sleep
+//   <i> osKernelResume calls a periodic timer once at its last period within the sleep instead of once per period (requires RTX source variant).
+//   <i> Limits the resume time and the Timer Callback Queue entries used by long sleeps, but the missed periods are lost.
+#ifndef OS_TIMER_RESUME_MERGE
+#define OS_TIMER_RESUME_MERGE       0
+#endif
+ 
+//   <q>High-Resolution Timers
+//   <i> Enables osRtxHrTimerStart to call functions at absolute system timer deadlines (requires RTX source variant).
+//   <i> The OS Tick timer compare is programmed with OS_Tick_CompareStart (default expires at the Kernel Tick).
+#ifndef OS_HR_TIMER
+#define OS_HR_TIMER                 0
+#endif
+ 
 // </h>
  
 // <h>Event Flags Configuration
@@ -322,6 +446,13 @@
  
 //   </e>
  
+//   <q>Waiting threads indexed by flag
+//   <i> Keeps threads waiting for event flags in one list per flag (requires RTX source variant).
+//   <i> Setting flags then only checks the threads waiting for these flags and threads waiting for any of several flags.
+#ifndef OS_EVFLAGS_WAIT_INDEX
+#define OS_EVFLAGS_WAIT_INDEX       0
+#endif
+ 
 // </h>
  
 // <h>Mutex Configuration
@@ -342,6 +473,20 @@
  
 //   </e>
  
+//   <o>Priority inheritance chain depth <1-16>
+//   <i> Defines the number of mutex owners in a chain of blocked owners that inherit the priority of a waiting thread.
+//   <i> Value 1 raises only the owner of the requested mutex.
+#ifndef OS_MUTEX_INHERIT_DEPTH
+#define OS_MUTEX_INHERIT_DEPTH      4
+#endif
+ 
+//   <q>Uncontended fast path
+//   <i> Acquires and releases mutexes without a Service Call when there is no contention (requires RTX source variant).
+//   <i> Applies to mutexes without priority inheritance, ceiling and robust attributes on cores with exclusive access.
+#ifndef OS_MUTEX_FAST_PATH
+#define OS_MUTEX_FAST_PATH          0
+#endif
+ 
 // </h>
  
 // <h>Semaphore Configuration
@@ -0,0 +1,207 @@
+/* --------------------------------------------------------------------------
+ * Copyright (c) 2013-2024 ARM Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *      Name:    bench.c
+ *      Purpose: RTX kernel benchmarks and message queue batch throughput
+ *
+ *---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "RTE_Components.h"
+#include  CMSIS_device_header
+#include "cmsis_os2.h"
+#include "rtx_os.h"
+#include "bench.h"
+
+#define MSG_COUNT       64U             // Message queue capacity
+#define MSG_TOTAL       6400U           // Messages transferred per run
+#define FLAG_DONE       0x0001U         // Consumer finished
+
+void app_main (void *argument);
+void app_producer (void *argument);
+void app_consumer (void *argument);
+
+typedef struct msg_s {
+  uint8_t cmd;
+  uint8_t len;
+  uint8_t data[8];
+} msg_t;
+
+static osMessageQueueId_t msgQueue;
+static osThreadId_t       mainThread;
+static uint32_t           batchSize;
+
+static msg_t txBuf[MSG_COUNT];
+static msg_t rxBuf[MSG_COUNT];
+
+// Benchmark main thread runs above all benchmark threads
+static const osThreadAttr_t mainAttr = {
+  .stack_size = BENCH_STACK_SIZE,
+  .priority   = osPriorityRealtime
+};
+
+static const osThreadAttr_t benchAttr = {
+  .stack_size = BENCH_STACK_SIZE
+};
+
+/*----------------------------------------------------------------------------
+ * Producer thread: put MSG_TOTAL messages in batches of batchSize
+ *---------------------------------------------------------------------------*/
+
+void app_producer (void *argument) {
+  (void)argument;
+
+  uint32_t cnt = 0U;
+  uint32_t n;
+
+  while (cnt < MSG_TOTAL) {
+    if (batchSize == 1U) {
+      if (osMessageQueuePut(msgQueue, &txBuf[0], 0U, osWaitForever) == osOK) {
+        cnt++;
+      }
+    } else {
+      n = ((MSG_TOTAL - cnt) < batchSize) ? (MSG_TOTAL - cnt) : batchSize;
+      cnt += osRtxMessageQueuePutN(msgQueue, txBuf, n, 0U, osWaitForever);
+    }
+  }
+  osThreadExit();
+}
+
+/*----------------------------------------------------------------------------
+ * Consumer thread: get MSG_TOTAL messages in batches of batchSize
+ *---------------------------------------------------------------------------*/
+
+void app_consumer (void *argument) {
+  (void)argument;
+
+  uint32_t cnt = 0U;
+  uint32_t n;
+
+  while (cnt < MSG_TOTAL) {
+    if (batchSize == 1U) {
+      if (osMessageQueueGet(msgQueue, &rxBuf[0], NULL, osWaitForever) == osOK) {
+        cnt++;
+      }
+    } else {
+      n = ((MSG_TOTAL - cnt) < batchSize) ? (MSG_TOTAL - cnt) : batchSize;
+      cnt += osRtxMessageQueueGetN(msgQueue, rxBuf, n, NULL, osWaitForever);
+    }
+  }
+  osThreadFlagsSet(mainThread, FLAG_DONE);
+  osThreadExit();
+}
+
+/*----------------------------------------------------------------------------
+ * Message queue batch throughput
+ *---------------------------------------------------------------------------*/
+
+int32_t bench_msgqueue (void) {
+  static const uint32_t batch[] = { 1U, 8U, 64U };
+  uint32_t i;
+  uint32_t start;
+  uint32_t cycles;
+  uint64_t rate;
+
+  // Message queue for up to MSG_COUNT messages of type msg_t
+  msgQueue = osMessageQueueNew(MSG_COUNT, sizeof(msg_t), NULL);
+  if (msgQueue == NULL) {
+    return -1;
+  }
+  mainThread = osThreadGetId();
+
+  for (i = 0U; i < (sizeof(batch) / sizeof(batch[0])); i++) {
+    batchSize = batch[i];
+
+    start = osKernelGetSysTimerCount();
+    osThreadNew(app_producer, NULL, &benchAttr);
+    osThreadNew(app_consumer, NULL, &benchAttr);
+    osThreadFlagsWait(FLAG_DONE, osFlagsWaitAny, osWaitForever);
+    cycles = osKernelGetSysTimerCount() - start;
+
+    rate = ((uint64_t)MSG_TOTAL * osKernelGetSysTimerFreq()) / cycles;
+    printf("batch %2u: %u messages in %u cycles, %u messages/s\n",
+           batchSize, MSG_TOTAL, cycles, (uint32_t)rate);
+  }
+
+  // Let the threads exit before the queue is deleted
+  osDelay(1U);
+  osMessageQueueDelete(msgQueue);
+
+  return 0;
+}
+
+/*----------------------------------------------------------------------------
+ * Benchmark main thread
+ *---------------------------------------------------------------------------*/
+
+static const struct {
+  const char *name;
+  int32_t   (*run)(void);
+} benchList[] = {
+  { "message queue batch throughput", bench_msgqueue },
+  { "uncontended mutex",              bench_mutex    },
+  { "priority inheritance chain",     bench_inherit  },
+  { "ready queue",                    bench_ready    },
+  { "semaphore timeout storm",        bench_timeout  },
+  { "dynamic memory allocator",       bench_memory   },
+  { "high-resolution timer latency",  bench_hrtimer  },
+  { "kernel resume catch-up",         bench_resume   },
+  { "event flags broadcast",          bench_evflags  },
+};
+
+void app_main (void *argument) {
+  (void)argument;
+
+  uint32_t i;
+  uint32_t failed = 0U;
+
+  for (i = 0U; i < (sizeof(benchList) / sizeof(benchList[0])); i++) {
+    printf("\n%s\n", benchList[i].name);
+    if (benchList[i].run() != 0) {
+      printf("%s: FAILED\n", benchList[i].name);
+      failed++;
+    }
+  }
+  printf("\nbenchmarks %s\n", (failed == 0U) ? "done" : "FAILED");
+
+#ifdef __unix__
+  // Terminate the host process
+  exit((failed == 0U) ? EXIT_SUCCESS : EXIT_FAILURE);
+#endif
+  for (;;) {
+    osDelay(osWaitForever);
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Main entry
+ *---------------------------------------------------------------------------*/
+
+int main (void) {
+
+  // System Initialization
+  SystemCoreClockUpdate();
+
+  osKernelInitialize();                 // Initialize CMSIS-RTOS
+
+  osThreadNew(app_main, NULL, &mainAttr); // Create benchmark main thread
+
+  osKernelStart();                      // Start thread execution
+  for (;;) {}
+}
@@ -0,0 +1,46 @@
+/* --------------------------------------------------------------------------
+ * Copyright (c) 2013-2024 ARM Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *      Name:    bench.h
+ *      Purpose: RTX kernel benchmarks
+ *
+ *---------------------------------------------------------------------------*/
+
+#ifndef BENCH_H_
+#define BENCH_H_
+
+#include <stdint.h>
+
+#ifndef BENCH_STACK_SIZE
+#define BENCH_STACK_SIZE    512U        // Stack size of benchmark threads
+#endif
+
+// Benchmarks are executed in sequence by the benchmark main thread, which
+// runs at osPriorityRealtime. Each benchmark returns 0 on success and -1
+// when its objects cannot be created or its results are not consistent.
+
+extern int32_t bench_msgqueue (void);   // bench.c
+extern int32_t bench_mutex    (void);   // bench_mutex.c
+extern int32_t bench_inherit  (void);   // bench_inherit.c
+extern int32_t bench_ready    (void);   // bench_ready.c
+extern int32_t bench_timeout  (void);   // bench_timeout.c
+extern int32_t bench_memory   (void);   // bench_memory.c
+extern int32_t bench_hrtimer  (void);   // bench_hrtimer.c
+extern int32_t bench_resume   (void);   // bench_resume.c
+extern int32_t bench_evflags  (void);   // bench_evflags.c
+
+#endif  // BENCH_H_
@@ -0,0 +1,167 @@
+/* --------------------------------------------------------------------------
+ * Copyright (c) 2013-2024 ARM Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *      Name:    bench_evflags.c
+ *      Purpose: RTX event flags broadcast benchmark
+ *
+ *---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+
+#include "RTE_Components.h"
+#include  CMSIS_device_header
+#include "cmsis_os2.h"
+#include "rtx_os.h"
+#include "bench.h"
+
+#define WAITER_MAX      40U             // Maximum number of waiting threads
+#define FLAG_WAITED     30U             // Flags 0..29 are waited for
+#define FLAG_IDLE       (1UL << 30)     // Flag without waiting threads
+#define SET_COUNT       1000U           // Sets per run
+#define FLAG_ACK        0x0001U         // Thread flag: all woken waiters waited again
+
+#ifndef OS_EVFLAGS_WAIT_INDEX
+#define OS_EVFLAGS_WAIT_INDEX  0        // Set by the build-type
+#endif
+
+void app_flags (void *argument);
+
+static osEventFlagsId_t flagsEvent;
+static osThreadId_t     mainThread;
+static uint32_t         wakeCount;
+static uint32_t         wakeTarget;
+
+// Waiters are created with static memory
+static osRtxThread_t flagsCb[WAITER_MAX];
+static uint64_t      flagsStack[WAITER_MAX][BENCH_STACK_SIZE / 8U];
+static osThreadId_t  flagsThread[WAITER_MAX];
+
+/*----------------------------------------------------------------------------
+ * Waiter: wait for one flag, acknowledge when all woken waiters have run
+ *---------------------------------------------------------------------------*/
+
+void app_flags (void *argument) {
+  uint32_t flag = 1UL << ((uint32_t)(uintptr_t)argument % FLAG_WAITED);
+  int32_t  lock;
+
+  for (;;) {
+    osEventFlagsWait(flagsEvent, flag, osFlagsWaitAny | osFlagsNoClear, osWaitForever);
+    // Waiters of the same priority can be preempted by round-robin
+    lock = osKernelLock();
+    wakeCount++;
+    if (wakeCount == wakeTarget) {
+      osThreadFlagsSet(mainThread, FLAG_ACK);
+    }
+    (void)osKernelRestoreLock(lock);
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Let count threads wait for flags 0..29 of a broadcast group and measure
+ * sets of a flag without waiters and sets that wake the waiters of a flag
+ *---------------------------------------------------------------------------*/
+
+static int32_t run (uint32_t count) {
+  osThreadAttr_t attr = { 0 };
+  uint32_t       idle   = 0U;
+  uint32_t       wake   = 0U;
+  uint32_t       woken  = 0U;
+  uint32_t       flag;
+  uint32_t       start;
+  uint32_t       n;
+  int32_t        ret = 0;
+
+  attr.cb_size    = sizeof(osRtxThread_t);
+  attr.stack_size = BENCH_STACK_SIZE;
+  attr.priority   = osPriorityAboveNormal;
+
+  for (n = 0U; n < count; n++) {
+    attr.cb_mem    = &flagsCb[n];
+    attr.stack_mem = &flagsStack[n][0];
+    flagsThread[n] = osThreadNew(app_flags, (void *)(uintptr_t)n, &attr);
+    if (flagsThread[n] == NULL) {
+      ret = -1;
+    }
+  }
+  // Let the waiters start waiting
+  for (n = 0U; (n < count) && (ret == 0); n++) {
+    while (osThreadGetState(flagsThread[n]) != osThreadBlocked) {
+      osDelay(1U);
+    }
+  }
+
+  for (n = 0U; (n < SET_COUNT) && (ret == 0); n++) {
+    start = osKernelGetSysTimerCount();
+    osEventFlagsSet(flagsEvent, FLAG_IDLE);
+    idle += osKernelGetSysTimerCount() - start;
+    osEventFlagsClear(flagsEvent, FLAG_IDLE);
+
+    // Waiters of the flag (thread n waits for flag n % FLAG_WAITED)
+    flag       = n % FLAG_WAITED;
+    wakeCount  = 0U;
+    wakeTarget = (count / FLAG_WAITED) + ((flag < (count % FLAG_WAITED)) ? 1U : 0U);
+    if (wakeTarget != 0U) {
+      start = osKernelGetSysTimerCount();
+      osEventFlagsSet(flagsEvent, 1UL << flag);
+      wake += osKernelGetSysTimerCount() - start;
+      osEventFlagsClear(flagsEvent, 1UL << flag);
+      if (osThreadFlagsWait(FLAG_ACK, osFlagsWaitAny, 100U) != FLAG_ACK) {
+        ret = -1;
+      }
+      woken += wakeTarget;
+    }
+  }
+
+  if (ret == 0) {
+    printf("%2u waiters: %u cycles per set without waiter, %u cycles per woken waiter\n",
+           count, idle / SET_COUNT, wake / woken);
+  }
+
+  for (n = 0U; n < count; n++) {
+    if (flagsThread[n] != NULL) {
+      osThreadTerminate(flagsThread[n]);
+    }
+  }
+
+  return ret;
+}
+
+/*----------------------------------------------------------------------------
+ * Event flags broadcast group with 8 and 40 waiting threads
+ *---------------------------------------------------------------------------*/
+
+int32_t bench_evflags (void) {
+  static const uint32_t count[] = { 8U, WAITER_MAX };
+  int32_t  ret = 0;
+  uint32_t i;
+
+  mainThread = osThreadGetId();
+  flagsEvent = osEventFlagsNew(NULL);
+  if (flagsEvent == NULL) {
+    return -1;
+  }
+
+  printf("event flags waiters %s\n", (OS_EVFLAGS_WAIT_INDEX != 0) ? "indexed by flag" : "in one list");
+
+  for (i = 0U; (i < (sizeof(count) / sizeof(count[0]))) && (ret == 0); i++) {
+    ret = run(count[i]);
+  }
+
+  osEventFlagsDelete(flagsEvent);
+
+  return ret;
+}
@@ -0,0 +1,166 @@
+/* --------------------------------------------------------------------------
+ * Copyright (c) 2013-2024 ARM Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *      Name:    bench_hrtimer.c
+ *      Purpose: RTX high-resolution timer accuracy benchmark
+ *
+ *---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+
+#include "RTE_Components.h"
+#include  CMSIS_device_header
+#include "cmsis_os2.h"
+#include "rtx_os.h"
+#include "bench.h"
+
+#define RUN_COUNT       1000U           // Timer expirations per run
+#define RUN_TIMEOUT     10000U          // Run timeout in ticks
+#define FLAG_DONE       0x0001U         // Run finished
+
+#ifndef OS_HR_TIMER
+#define OS_HR_TIMER     0               // Set by the build-type
+#endif
+
+static void hr_callback (void *argument);
+
+static osRtxHrTimer_t hrTimer = osRtxHrTimerInit(hr_callback, NULL);
+static osThreadId_t   mainThread;
+static uint32_t       hrPeriod;         // Timer period (0 = pseudo-random one-shot deadlines)
+static uint32_t       hrRange;          // Range of pseudo-random deadlines
+static uint32_t       hrSeed;
+
+static uint32_t       runCount;
+static uint32_t       runEarly;
+static uint32_t       latMin;
+static uint32_t       latMax;
+static uint64_t       latSum;
+
+/*----------------------------------------------------------------------------
+ * Next pseudo-random delay in the range 1..hrRange
+ *---------------------------------------------------------------------------*/
+
+static uint32_t next_delay (void) {
+  hrSeed = (hrSeed * 1103515245U) + 12345U;
+  return ((hrSeed >> 8) % hrRange) + 1U;
+}
+
+/*----------------------------------------------------------------------------
+ * Timer function: record latency and restart the timer
+ *---------------------------------------------------------------------------*/
+
+static void hr_callback (void *argument) {
+  uint32_t now = osKernelGetSysTimerCount();
+  uint32_t lat = now - hrTimer.deadline;
+  uint32_t deadline;
+
+  (void)argument;
+
+  if (lat > 0x7FFFFFFFU) {
+    // Called before the deadline
+    runEarly++;
+  } else {
+    if (lat < latMin) {
+      latMin = lat;
+    }
+    if (lat > latMax) {
+      latMax = lat;
+    }
+    latSum += lat;
+  }
+
+  runCount++;
+  if (runCount < RUN_COUNT) {
+    if (hrPeriod != 0U) {
+      deadline = hrTimer.deadline + hrPeriod;
+    } else {
+      deadline = now + next_delay();
+    }
+    osRtxHrTimerStart(&hrTimer, deadline);
+  } else {
+    osThreadFlagsSet(mainThread, FLAG_DONE);
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Run RUN_COUNT timer expirations and print the latency
+ *---------------------------------------------------------------------------*/
+
+static int32_t run (const char *name, uint32_t period, uint32_t range) {
+  uint32_t freq = osKernelGetSysTimerFreq();
+  uint32_t cnt;
+
+  hrPeriod = period;
+  hrRange  = range;
+  hrSeed   = 1U;
+  runCount = 0U;
+  runEarly = 0U;
+  latMin   = 0xFFFFFFFFU;
+  latMax   = 0U;
+  latSum   = 0U;
+
+  if (osRtxHrTimerStart(&hrTimer, osKernelGetSysTimerCount() + ((period != 0U) ? period : range)) != osOK) {
+    return -1;
+  }
+  if (osThreadFlagsWait(FLAG_DONE, osFlagsWaitAny, RUN_TIMEOUT) != FLAG_DONE) {
+    (void)osRtxHrTimerStop(&hrTimer);
+    return -1;
+  }
+
+  cnt = RUN_COUNT - runEarly;
+  if (cnt == 0U) {
+    cnt = 1U;
+  }
+  printf("%-16s latency min %u avg %u max %u cycles (max %u ns), early %u\n",
+         name, latMin, (uint32_t)(latSum / cnt), latMax,
+         (uint32_t)(((uint64_t)latMax * 1000000000U) / freq), runEarly);
+
+  return 0;
+}
+
+/*----------------------------------------------------------------------------
+ * High-resolution timer latency with periods below and deadlines across ticks
+ *---------------------------------------------------------------------------*/
+
+int32_t bench_hrtimer (void) {
+  uint32_t freq = osKernelGetSysTimerFreq();
+  uint32_t tick = freq / osKernelGetTickFreq();
+
+  if (OS_HR_TIMER == 0) {
+    // osRtxHrTimerStart returns osError without OS_HR_TIMER
+    printf("high-resolution timers not enabled\n");
+    return 0;
+  }
+
+  mainThread = osThreadGetId();
+
+  printf("system timer %u Hz, tick %u cycles\n", freq, tick);
+
+  // Periodic timers shorter than the tick period (deadline plus period)
+  if (run("period 100 us", freq / 10000U, 0U) != 0) {
+    return -1;
+  }
+  if (run("period 1/3 tick", tick / 3U, 0U) != 0) {
+    return -1;
+  }
+  // One-shot timers at pseudo-random deadlines within the next three tick periods
+  if (run("random 3 ticks", 0U, tick * 3U) != 0) {
+    return -1;
+  }
+
+  return 0;
+}
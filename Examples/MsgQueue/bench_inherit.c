@@ -0,0 +1,207 @@
+/* --------------------------------------------------------------------------
+ * Copyright (c) 2013-2024 ARM Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *      Name:    bench_inherit.c
+ *      Purpose: RTX priority inheritance chain stress test
+ *
+ *---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+
+#include "RTE_Components.h"
+#include  CMSIS_device_header
+#include "cmsis_os2.h"
+#include "rtx_os.h"
+#include "bench.h"
+
+#define CHAIN_MAX       5U              // Maximum number of mutex owners in the chain
+#define RUN_COUNT       20U             // Runs per chain depth
+#define FLAG_GO         0x0001U         // Last owner starts its work
+#define FLAG_START      0x0002U         // High priority thread acquires the first mutex
+#define FLAG_DONE       0x0004U         // High priority thread acquired the first mutex
+#define FLAG_HOG        0x0008U         // Medium priority thread finished
+
+#ifndef OS_MUTEX_INHERIT_DEPTH
+#define OS_MUTEX_INHERIT_DEPTH  4       // Set by the build-type
+#endif
+
+void app_owner (void *argument);
+void app_high (void *argument);
+void app_hog (void *argument);
+
+static osMutexId_t  chainMutex[CHAIN_MAX];
+static osThreadId_t mainThread;
+static osThreadId_t lastOwner;
+static uint32_t     chainDepth;
+static uint32_t     workCycles;         // Work of the last owner while holding its mutex
+static uint32_t     hogCycles;          // Run time of the medium priority thread
+static uint32_t     blockCycles;
+
+static const osMutexAttr_t mutexAttr = {
+  .attr_bits = osMutexPrioInherit
+};
+
+static const osThreadAttr_t highAttr = {
+  .stack_size = BENCH_STACK_SIZE,
+  .priority   = osPriorityHigh
+};
+
+static const osThreadAttr_t hogAttr = {
+  .stack_size = BENCH_STACK_SIZE,
+  .priority   = osPriorityAboveNormal
+};
+
+/*----------------------------------------------------------------------------
+ * Busy loop for the specified number of system timer cycles
+ *---------------------------------------------------------------------------*/
+
+static void spin (uint32_t cycles) {
+  uint32_t start = osKernelGetSysTimerCount();
+
+  while ((osKernelGetSysTimerCount() - start) < cycles) {}
+}
+
+/*----------------------------------------------------------------------------
+ * Mutex owner: hold mutex n and wait for mutex n + 1 (last owner works)
+ *---------------------------------------------------------------------------*/
+
+void app_owner (void *argument) {
+  uint32_t n = (uint32_t)(uintptr_t)argument;
+
+  osMutexAcquire(chainMutex[n], osWaitForever);
+  if ((n + 1U) < chainDepth) {
+    osMutexAcquire(chainMutex[n + 1U], osWaitForever);
+    osMutexRelease(chainMutex[n + 1U]);
+  } else {
+    osThreadFlagsWait(FLAG_GO, osFlagsWaitAny, osWaitForever);
+    spin(workCycles);
+  }
+  osMutexRelease(chainMutex[n]);
+  osThreadExit();
+}
+
+/*----------------------------------------------------------------------------
+ * High priority thread: measure blocking time on the first mutex
+ *---------------------------------------------------------------------------*/
+
+void app_high (void *argument) {
+  uint32_t start;
+  (void)argument;
+
+  osThreadFlagsWait(FLAG_START, osFlagsWaitAny, osWaitForever);
+  start = osKernelGetSysTimerCount();
+  osMutexAcquire(chainMutex[0], osWaitForever);
+  blockCycles = osKernelGetSysTimerCount() - start;
+  osMutexRelease(chainMutex[0]);
+  osThreadFlagsSet(mainThread, FLAG_DONE);
+  osThreadExit();
+}
+
+/*----------------------------------------------------------------------------
+ * Medium priority thread: delays owners that did not inherit the priority
+ *---------------------------------------------------------------------------*/
+
+void app_hog (void *argument) {
+  (void)argument;
+
+  spin(hogCycles);
+  osThreadFlagsSet(mainThread, FLAG_HOG);
+  osThreadExit();
+}
+
+/*----------------------------------------------------------------------------
+ * Build a chain of depth owners and return the blocking time of the
+ * high priority thread
+ *---------------------------------------------------------------------------*/
+
+static uint32_t run (uint32_t depth) {
+  osThreadAttr_t attr = { .stack_size = BENCH_STACK_SIZE };
+  osThreadId_t   thread;
+  osThreadId_t   high;
+  uint32_t       n;
+
+  chainDepth = depth;
+
+  // Owners at increasing low priorities, the last owner is created first
+  for (n = depth; n > 0U; n--) {
+    attr.priority = (osPriority_t)((uint32_t)osPriorityLow + (n - 1U));
+    thread = osThreadNew(app_owner, (void *)(uintptr_t)(n - 1U), &attr);
+    if (n == depth) {
+      lastOwner = thread;
+    }
+    // Let the owner acquire its mutex and block on the next one
+    osDelay(1U);
+  }
+  high = osThreadNew(app_high, NULL, &highAttr);
+
+  // Last owner is ready, the medium priority thread competes with it
+  osThreadFlagsSet(lastOwner, FLAG_GO);
+  osThreadNew(app_hog, NULL, &hogAttr);
+  osThreadFlagsSet(high, FLAG_START);
+
+  osThreadFlagsWait(FLAG_DONE, osFlagsWaitAny, osWaitForever);
+  osThreadFlagsWait(FLAG_HOG,  osFlagsWaitAny, osWaitForever);
+
+  return blockCycles;
+}
+
+/*----------------------------------------------------------------------------
+ * Priority inheritance chain: worst-case blocking per chain depth
+ * (the benchmark main thread runs above all test threads)
+ *---------------------------------------------------------------------------*/
+
+int32_t bench_inherit (void) {
+  uint32_t depth;
+  uint32_t i;
+  uint32_t n;
+  uint32_t cycles;
+  uint32_t worst;
+
+  for (n = 0U; n < CHAIN_MAX; n++) {
+    chainMutex[n] = osMutexNew(&mutexAttr);
+    if (chainMutex[n] == NULL) {
+      return -1;
+    }
+  }
+
+  mainThread = osThreadGetId();
+  workCycles = osKernelGetSysTimerFreq() / 10000U;      // 100 us
+  hogCycles  = osKernelGetSysTimerFreq() / 100U;        // 10 ms
+
+  printf("inherit depth %u, work %u cycles, medium priority load %u cycles\n",
+         (uint32_t)OS_MUTEX_INHERIT_DEPTH, workCycles, hogCycles);
+
+  for (depth = 1U; depth <= CHAIN_MAX; depth++) {
+    worst = 0U;
+    for (i = 0U; i < RUN_COUNT; i++) {
+      cycles = run(depth);
+      if (cycles > worst) {
+        worst = cycles;
+      }
+    }
+    printf("chain %u: worst-case blocking %u cycles (%u us)\n", depth, worst,
+           (uint32_t)(((uint64_t)worst * 1000000U) / osKernelGetSysTimerFreq()));
+  }
+
+  // Let the threads exit before the mutexes are deleted
+  osDelay(1U);
+  for (n = 0U; n < CHAIN_MAX; n++) {
+    osMutexDelete(chainMutex[n]);
+  }
+
+  return 0;
+}
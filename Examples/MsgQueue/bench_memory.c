@@ -0,0 +1,178 @@
+/* --------------------------------------------------------------------------
+ * Copyright (c) 2013-2024 ARM Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *      Name:    bench_memory.c
+ *      Purpose: RTX dynamic memory allocator benchmark
+ *
+ *---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+
+#include "RTE_Components.h"
+#include  CMSIS_device_header
+#include "cmsis_os2.h"
+#include "rtx_os.h"
+#include "bench.h"
+
+#define POOL_SIZE       8192U           // Memory pool size in bytes
+#define SLOT_COUNT      128U            // Number of allocated block slots
+#define STEP_COUNT      20000U          // Random allocate/free steps
+#define BLOCK_MIN       8U              // Minimum block size in bytes
+#define BLOCK_MAX       512U            // Maximum block size in bytes
+
+#ifndef OS_MEMORY_TLSF
+#define OS_MEMORY_TLSF  0               // Set by the build-type
+#endif
+
+// Kernel memory management functions (rtx_memory.c)
+extern uint32_t osRtxMemoryInit  (void *mem, uint32_t size);
+extern void    *osRtxMemoryAlloc (void *mem, uint32_t size, uint32_t type);
+extern uint32_t osRtxMemoryFree  (void *mem, void *block);
+
+static uint64_t memPool[POOL_SIZE / 8U];
+static void    *memBlock[SLOT_COUNT];
+static uint32_t memSize[SLOT_COUNT];
+static uint32_t randSeed;
+
+typedef struct {
+  uint32_t count;
+  uint32_t total;
+  uint32_t max;
+} latency_t;
+
+/*----------------------------------------------------------------------------
+ * Pseudo-random number (linear congruential generator)
+ *---------------------------------------------------------------------------*/
+
+static uint32_t rand_next (void) {
+  randSeed = (randSeed * 1664525U) + 1013904223U;
+  return (randSeed >> 8);
+}
+
+/*----------------------------------------------------------------------------
+ * Block size: small blocks are more frequent than large blocks
+ *---------------------------------------------------------------------------*/
+
+static uint32_t rand_size (void) {
+  uint32_t r = rand_next();
+
+  if ((r & 3U) != 0U) {
+    return (BLOCK_MIN + ((r >> 2) % 64U));
+  }
+  return (BLOCK_MIN + ((r >> 2) % (BLOCK_MAX - BLOCK_MIN + 1U)));
+}
+
+static void latency_add (latency_t *lat, uint32_t cycles) {
+  lat->count++;
+  lat->total += cycles;
+  if (cycles > lat->max) {
+    lat->max = cycles;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Largest block that can be allocated (binary search)
+ *---------------------------------------------------------------------------*/
+
+static uint32_t largest_block (void) {
+  uint32_t lo = 0U;
+  uint32_t hi = POOL_SIZE;
+  uint32_t mid;
+  void    *block;
+
+  while (lo < hi) {
+    mid   = (lo + hi + 1U) / 2U;
+    block = osRtxMemoryAlloc(memPool, mid, 0U);
+    if (block != NULL) {
+      (void)osRtxMemoryFree(memPool, block);
+      lo = mid;
+    } else {
+      hi = mid - 1U;
+    }
+  }
+
+  return lo;
+}
+
+/*----------------------------------------------------------------------------
+ * Random allocate/free of up to SLOT_COUNT blocks in a POOL_SIZE pool
+ *---------------------------------------------------------------------------*/
+
+int32_t bench_memory (void) {
+  latency_t alloc   = { 0U, 0U, 0U };
+  latency_t release = { 0U, 0U, 0U };
+  uint32_t  failed  = 0U;
+  uint32_t  used    = 0U;
+  uint32_t  blocks  = 0U;
+  uint32_t  empty;
+  uint32_t  start;
+  uint32_t  step;
+  uint32_t  n;
+
+  if (osRtxMemoryInit(memPool, sizeof(memPool)) == 0U) {
+    return -1;
+  }
+  empty = largest_block();
+
+  randSeed = 1U;
+  for (n = 0U; n < SLOT_COUNT; n++) {
+    memBlock[n] = NULL;
+  }
+
+  for (step = 0U; step < STEP_COUNT; step++) {
+    n = rand_next() % SLOT_COUNT;
+    if (memBlock[n] != NULL) {
+      start = osKernelGetSysTimerCount();
+      (void)osRtxMemoryFree(memPool, memBlock[n]);
+      latency_add(&release, osKernelGetSysTimerCount() - start);
+      memBlock[n] = NULL;
+      used -= memSize[n];
+      blocks--;
+    } else {
+      memSize[n] = rand_size();
+      start = osKernelGetSysTimerCount();
+      memBlock[n] = osRtxMemoryAlloc(memPool, memSize[n], 0U);
+      latency_add(&alloc, osKernelGetSysTimerCount() - start);
+      if (memBlock[n] != NULL) {
+        used += memSize[n];
+        blocks++;
+      } else {
+        failed++;
+      }
+    }
+  }
+
+  printf("memory allocator %s\n", (OS_MEMORY_TLSF != 0) ? "TLSF" : "first-fit");
+  printf("alloc: %u cycles average, %u cycles worst-case, %u failed\n",
+         alloc.total / alloc.count, alloc.max, failed);
+  printf("free:  %u cycles average, %u cycles worst-case\n",
+         release.total / release.count, release.max);
+  printf("%u blocks with %u bytes in use, largest free block %u of %u bytes\n",
+         blocks, used, largest_block(), empty);
+
+  // All memory is merged into one free block again
+  for (n = 0U; n < SLOT_COUNT; n++) {
+    if (memBlock[n] != NULL) {
+      (void)osRtxMemoryFree(memPool, memBlock[n]);
+    }
+  }
+  if (largest_block() != empty) {
+    return -1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,98 @@
+/* --------------------------------------------------------------------------
+ * Copyright (c) 2013-2024 ARM Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *      Name:    bench_mutex.c
+ *      Purpose: RTX uncontended mutex acquire/release benchmark
+ *
+ *---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+
+#include "RTE_Components.h"
+#include  CMSIS_device_header
+#include "cmsis_os2.h"
+#include "rtx_os.h"
+#include "bench.h"
+
+#define LOCK_COUNT      10000U          // Acquire/release pairs per run
+
+#ifndef OS_MUTEX_FAST_PATH
+#define OS_MUTEX_FAST_PATH  0           // Set by the build-type
+#endif
+
+static osMutexId_t mtxPlain;
+static osMutexId_t mtxRecursive;
+static osMutexId_t mtxInherit;
+
+static const osMutexAttr_t mtxRecursiveAttr = {
+  .attr_bits = osMutexRecursive
+};
+
+static const osMutexAttr_t mtxInheritAttr = {
+  .attr_bits = osMutexPrioInherit
+};
+
+/*----------------------------------------------------------------------------
+ * Run LOCK_COUNT acquire/release pairs (nested to depth) and print the cycles
+ *---------------------------------------------------------------------------*/
+
+static void run (const char *name, osMutexId_t mutex, uint32_t depth) {
+  uint32_t i;
+  uint32_t n;
+  uint32_t start;
+  uint32_t cycles;
+
+  start = osKernelGetSysTimerCount();
+  for (i = 0U; i < LOCK_COUNT; i++) {
+    for (n = 0U; n < depth; n++) {
+      osMutexAcquire(mutex, osWaitForever);
+    }
+    for (n = 0U; n < depth; n++) {
+      osMutexRelease(mutex);
+    }
+  }
+  cycles = osKernelGetSysTimerCount() - start;
+
+  printf("%-14s %u cycles per acquire/release pair\n", name, cycles / (LOCK_COUNT * depth));
+}
+
+/*----------------------------------------------------------------------------
+ * Uncontended mutex acquire/release
+ *---------------------------------------------------------------------------*/
+
+int32_t bench_mutex (void) {
+
+  mtxPlain     = osMutexNew(NULL);
+  mtxRecursive = osMutexNew(&mtxRecursiveAttr);
+  mtxInherit   = osMutexNew(&mtxInheritAttr);
+  if ((mtxPlain == NULL) || (mtxRecursive == NULL) || (mtxInherit == NULL)) {
+    return -1;
+  }
+
+  printf("mutex fast path %s\n", (OS_MUTEX_FAST_PATH != 0) ? "enabled" : "disabled");
+
+  run("plain",        mtxPlain,     1U);
+  run("recursive x4", mtxRecursive, 4U);
+  // Priority inheritance mutexes always take the Service Call
+  run("inherit",      mtxInherit,   1U);
+
+  osMutexDelete(mtxPlain);
+  osMutexDelete(mtxRecursive);
+  osMutexDelete(mtxInherit);
+
+  return 0;
+}
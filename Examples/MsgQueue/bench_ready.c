@@ -0,0 +1,127 @@
+/* --------------------------------------------------------------------------
+ * Copyright (c) 2013-2024 ARM Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *      Name:    bench_ready.c
+ *      Purpose: RTX ready queue benchmark
+ *
+ *---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+
+#include "RTE_Components.h"
+#include  CMSIS_device_header
+#include "cmsis_os2.h"
+#include "rtx_os.h"
+#include "bench.h"
+
+#define READY_MAX       128U            // Maximum number of ready threads
+#define READY_STACK     256U            // Stack size of ready threads (never executed)
+#define PAIR_COUNT      1000U           // Resume/suspend pairs per run
+
+#ifndef OS_THREAD_READY_BITMAP
+#define OS_THREAD_READY_BITMAP  0       // Set by the build-type
+#endif
+
+void app_ready (void *argument);
+
+// Ready threads and target thread are created with static memory
+static osRtxThread_t readyCb[READY_MAX + 1U];
+static uint64_t      readyStack[READY_MAX + 1U][READY_STACK / 8U];
+static osThreadId_t  readyThread[READY_MAX + 1U];
+
+/*----------------------------------------------------------------------------
+ * Ready thread: never executes, the benchmark main thread runs above it
+ *---------------------------------------------------------------------------*/
+
+void app_ready (void *argument) {
+  (void)argument;
+
+  for (;;) {}
+}
+
+/*----------------------------------------------------------------------------
+ * Create count ready threads and measure resume/suspend of a thread at a
+ * lower priority than all of them (inserted behind all in a sorted list)
+ *---------------------------------------------------------------------------*/
+
+static int32_t run (uint32_t count) {
+  osThreadAttr_t attr = { 0 };
+  osThreadId_t   target;
+  uint32_t       i;
+  uint32_t       start;
+  uint32_t       cycles;
+  int32_t        ret = 0;
+
+  attr.cb_size    = sizeof(osRtxThread_t);
+  attr.stack_size = READY_STACK;
+
+  // Ready threads spread over 24 priorities above the target thread
+  for (i = 0U; i <= count; i++) {
+    attr.cb_mem    = &readyCb[i];
+    attr.stack_mem = &readyStack[i][0];
+    if (i < count) {
+      attr.priority = (osPriority_t)((uint32_t)osPriorityBelowNormal + (i % 24U));
+    } else {
+      attr.priority = osPriorityLow;
+    }
+    readyThread[i] = osThreadNew(app_ready, NULL, &attr);
+    if (readyThread[i] == NULL) {
+      ret = -1;
+    }
+  }
+  target = readyThread[count];
+
+  if (ret == 0) {
+    osThreadSuspend(target);
+
+    start = osKernelGetSysTimerCount();
+    for (i = 0U; i < PAIR_COUNT; i++) {
+      osThreadResume(target);
+      osThreadSuspend(target);
+    }
+    cycles = osKernelGetSysTimerCount() - start;
+
+    printf("%3u ready threads: %u cycles per resume/suspend pair\n", count, cycles / PAIR_COUNT);
+  }
+
+  for (i = 0U; i <= count; i++) {
+    if (readyThread[i] != NULL) {
+      osThreadTerminate(readyThread[i]);
+    }
+  }
+
+  return ret;
+}
+
+/*----------------------------------------------------------------------------
+ * Ready queue insertion at 8, 32 and 128 ready threads
+ *---------------------------------------------------------------------------*/
+
+int32_t bench_ready (void) {
+  static const uint32_t count[] = { 8U, 32U, READY_MAX };
+  uint32_t i;
+
+  printf("ready queue %s\n", (OS_THREAD_READY_BITMAP != 0) ? "priority bitmap" : "sorted list");
+
+  for (i = 0U; i < (sizeof(count) / sizeof(count[0])); i++) {
+    if (run(count[i]) != 0) {
+      return -1;
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,262 @@
+/* --------------------------------------------------------------------------
+ * Copyright (c) 2013-2024 ARM Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *      Name:    bench_resume.c
+ *      Purpose: RTX kernel resume catch-up test and benchmark
+ *
+ *---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <string.h>
+#ifdef __unix__
+#include <time.h>
+#endif
+
+#include "RTE_Components.h"
+#include  CMSIS_device_header
+#include "cmsis_os2.h"
+#include "rtx_os.h"
+#include "bench.h"
+
+#ifndef OS_TIMER_RESUME_MERGE
+#define OS_TIMER_RESUME_MERGE   0       // Set by the build-type
+#endif
+
+#define THREAD_COUNT    8U              // Delayed threads per run
+#define TIMER_COUNT     4U              // Timers per run
+#define TIMER_PERIODIC  3U              // Index of the periodic timer
+#define LOG_SIZE        4096U           // Event log entries
+
+void app_delay (void *argument);
+static void timer_callback (void *argument);
+
+// Thread delays and timer periods [ticks]
+static const uint32_t threadDelay[THREAD_COUNT] = { 5U, 17U, 17U, 40U, 99U, 250U, 999U, 20000U };
+static const uint32_t timerTicks[TIMER_COUNT]   = { 7U, 17U, 500U, 3U };
+static const osTimerType_t timerType[TIMER_COUNT] = {
+  osTimerOnce, osTimerOnce, osTimerOnce, osTimerPeriodic
+};
+
+static osThreadId_t threadId[THREAD_COUNT];
+static osTimerId_t  timerId[TIMER_COUNT];
+
+// Event log: thread wakeups (1..THREAD_COUNT) and timer callbacks (0x81..)
+// (periodic timer callbacks are not logged when missed periods are merged)
+static uint8_t  eventLog[LOG_SIZE];
+static uint32_t eventCount;
+static uint8_t  refLog[LOG_SIZE];
+static uint32_t refCount;
+
+// Periodic timer: callbacks and tick of the last callback (relative to the timer start)
+static uint32_t periodicCount;
+static uint32_t periodicTick;
+static uint32_t startTick;
+static uint32_t suspendTick;
+
+// Timer callbacks are executed in the Kernel Tick (no Timer Callback Queue overflow)
+static const osTimerAttr_t timerAttr = {
+  .attr_bits = osRtxTimerCallbackInline
+};
+
+// Delayed threads preempt the benchmark main thread to start their delays
+// and then run below it (woken threads log after osKernelResume returns)
+static const osThreadAttr_t delayAttr = {
+  .stack_size = BENCH_STACK_SIZE,
+  .priority   = osPriorityRealtime1
+};
+
+/*----------------------------------------------------------------------------
+ * Cycle counter: the system timer is stopped while the kernel is suspended
+ * (DWT cycle counter, monotonic clock in nanoseconds on the host)
+ *---------------------------------------------------------------------------*/
+
+static uint32_t cycle_count (void) {
+#ifdef __unix__
+  struct timespec ts;
+
+  (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ((uint32_t)ts.tv_sec * 1000000000U) + (uint32_t)ts.tv_nsec;
+#else
+  return DWT->CYCCNT;
+#endif
+}
+
+/*----------------------------------------------------------------------------
+ * Record an event in the event log
+ *---------------------------------------------------------------------------*/
+
+static void log_event (uint8_t event) {
+  if (eventCount < LOG_SIZE) {
+    eventLog[eventCount] = event;
+  }
+  eventCount++;
+}
+
+/*----------------------------------------------------------------------------
+ * Delayed thread and timer callback
+ *---------------------------------------------------------------------------*/
+
+void app_delay (void *argument) {
+  uint32_t i = (uint32_t)(uintptr_t)argument;
+
+  osDelay(threadDelay[i]);
+  log_event((uint8_t)(i + 1U));
+  threadId[i] = NULL;
+  osThreadExit();
+}
+
+static void timer_callback (void *argument) {
+  uint32_t i = (uint32_t)(uintptr_t)argument;
+
+  if (i == TIMER_PERIODIC) {
+    periodicCount++;
+    periodicTick = osKernelGetTickCount() - startTick;
+  }
+  if ((OS_TIMER_RESUME_MERGE == 0) || (i != TIMER_PERIODIC)) {
+    log_event((uint8_t)(0x81U + i));
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Sleep for the specified number of ticks with the kernel suspended and
+ * return the cycles spent in osKernelResume
+ * (bulk: one call, otherwise: one call per tick)
+ *---------------------------------------------------------------------------*/
+
+static uint32_t run (uint32_t sleep, uint32_t bulk) {
+  uint32_t i;
+  uint32_t start;
+  uint32_t cycles;
+
+  eventCount    = 0U;
+  periodicCount = 0U;
+  periodicTick  = 0U;
+
+  // Start the thread delays and the timers in the same tick
+  osDelay(1U);
+  startTick = osKernelGetTickCount();
+  for (i = 0U; i < THREAD_COUNT; i++) {
+    threadId[i] = osThreadNew(app_delay, (void *)(uintptr_t)i, &delayAttr);
+    osThreadSetPriority(threadId[i], osPriorityNormal);
+  }
+  for (i = 0U; i < TIMER_COUNT; i++) {
+    osTimerStart(timerId[i], timerTicks[i]);
+  }
+
+  (void)osKernelSuspend();
+  suspendTick = osKernelGetTickCount() - startTick;
+  if (bulk != 0U) {
+    start  = cycle_count();
+    osKernelResume(sleep);
+    cycles = cycle_count() - start;
+  } else {
+    // Kernel Ticks between the calls count towards the sleep
+    cycles = 0U;
+    while ((osKernelGetTickCount() - startTick - suspendTick) < sleep) {
+      start = cycle_count();
+      osKernelResume(1U);
+      cycles += cycle_count() - start;
+      (void)osKernelSuspend();
+    }
+    osKernelResume(0U);
+  }
+
+  for (i = 0U; i < TIMER_COUNT; i++) {
+    osTimerStop(timerId[i]);
+  }
+
+  // Let woken threads run
+  osDelay(10U);
+
+  // Terminate threads that did not wake up
+  for (i = 0U; i < THREAD_COUNT; i++) {
+    if (threadId[i] != NULL) {
+      osThreadTerminate(threadId[i]);
+    }
+  }
+
+  return cycles;
+}
+
+/*----------------------------------------------------------------------------
+ * Kernel resume after 100, 1000 and 10000 ticks: one call against one call
+ * per tick, with the same thread wakeup and timer callback sequence
+ * (with OS_TIMER_RESUME_MERGE the periodic timer is called once at its last
+ * period within the sleep and only the other events are compared)
+ *---------------------------------------------------------------------------*/
+
+int32_t bench_resume (void) {
+  static const uint32_t sleep[] = { 100U, 1000U, 10000U };
+  uint32_t tick_cycles;
+  uint32_t bulk_cycles;
+  uint32_t ref_periodic;
+  uint32_t last;
+  uint32_t match;
+  int32_t  ret = 0;
+  uint32_t i;
+
+#ifndef __unix__
+  // Enable the DWT cycle counter
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0U;
+  DWT->CTRL  |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+
+  for (i = 0U; i < TIMER_COUNT; i++) {
+    timerId[i] = osTimerNew(timer_callback, timerType[i], (void *)(uintptr_t)i, &timerAttr);
+    if (timerId[i] == NULL) {
+      return -1;
+    }
+  }
+
+  for (i = 0U; i < (sizeof(sleep) / sizeof(sleep[0])); i++) {
+    // Reference: one Kernel Tick per resume
+    tick_cycles  = run(sleep[i], 0U);
+    refCount     = eventCount;
+    ref_periodic = periodicCount;
+    memcpy(refLog, eventLog, sizeof(refLog));
+
+    bulk_cycles = run(sleep[i], 1U);
+
+    // Last period of the periodic timer within the sleep
+    last  = suspendTick + sleep[i];
+    last -= last % timerTicks[TIMER_PERIODIC];
+
+    match = 0U;
+    if ((eventCount == refCount) && (eventCount <= LOG_SIZE) &&
+        (memcmp(eventLog, refLog, eventCount) == 0) &&
+#if (OS_TIMER_RESUME_MERGE != 0)
+        (periodicCount == 1U) &&
+#else
+        (periodicCount == ref_periodic) &&
+#endif
+        (periodicTick == last)) {
+      match = 1U;
+    } else {
+      ret = -1;
+    }
+    printf("sleep %5u ticks: %u events %s, periodic %u/%u calls, per tick %u cycles, bulk %u cycles\n",
+           sleep[i], eventCount, (match != 0U) ? "match" : "MISMATCH",
+           periodicCount, ref_periodic, tick_cycles, bulk_cycles);
+  }
+
+  for (i = 0U; i < TIMER_COUNT; i++) {
+    osTimerDelete(timerId[i]);
+  }
+
+  return ret;
+}
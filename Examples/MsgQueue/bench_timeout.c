@@ -0,0 +1,151 @@
+/* --------------------------------------------------------------------------
+ * Copyright (c) 2013-2024 ARM Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *      Name:    bench_timeout.c
+ *      Purpose: RTX timeout storm benchmark
+ *
+ *---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+
+#include "RTE_Components.h"
+#include  CMSIS_device_header
+#include "cmsis_os2.h"
+#include "rtx_os.h"
+#include "bench.h"
+
+#define WAITER_MAX      32U             // Maximum number of semaphore waiters
+#define STORM_TIMEOUT   10U             // Semaphore wait timeout in ticks
+#define RUN_COUNT       10U             // Valid runs per waiter count (minimum is taken)
+#define RUN_MAX         100U            // Maximum runs per waiter count
+
+void app_waiter (void *argument);
+
+static osSemaphoreId_t stormSem;
+static uint32_t        waitTick[WAITER_MAX];
+
+// Waiters are created with static memory
+static osRtxThread_t waiterCb[WAITER_MAX];
+static uint64_t      waiterStack[WAITER_MAX][BENCH_STACK_SIZE / 8U];
+static osThreadId_t  waiterThread[WAITER_MAX];
+
+/*----------------------------------------------------------------------------
+ * Semaphore waiter: wait with timeout (terminated after the timeout)
+ *---------------------------------------------------------------------------*/
+
+void app_waiter (void *argument) {
+  uint32_t n = (uint32_t)(uintptr_t)argument;
+
+  waitTick[n] = osKernelGetTickCount();
+  osSemaphoreAcquire(stormSem, STORM_TIMEOUT);
+  for (;;) {
+    osDelay(osWaitForever);
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Let count waiters time out in the same tick as the benchmark main thread
+ * and return the system timer cycles from the tick until the main thread
+ * runs, or 0 when the waiters did not start waiting in the same tick
+ *---------------------------------------------------------------------------*/
+
+static uint32_t run (uint32_t count) {
+  osThreadAttr_t attr = { 0 };
+  uint32_t       interval;
+  uint32_t       tick;
+  uint32_t       cycles;
+  uint32_t       n;
+
+  attr.cb_size    = sizeof(osRtxThread_t);
+  attr.stack_size = BENCH_STACK_SIZE;
+  attr.priority   = osPriorityAboveNormal;
+
+  // Start at the beginning of a tick
+  osDelay(1U);
+  tick = osKernelGetTickCount();
+
+  for (n = 0U; n < count; n++) {
+    attr.cb_mem     = &waiterCb[n];
+    attr.stack_mem  = &waiterStack[n][0];
+    waiterThread[n] = osThreadNew(app_waiter, (void *)(uintptr_t)n, &attr);
+  }
+
+  // Waiters start waiting while the main thread is delayed to their timeout
+  osDelayUntil(tick + STORM_TIMEOUT);
+  cycles   = osKernelGetSysTimerCount();
+  interval = osKernelGetSysTimerFreq() / osKernelGetTickFreq();
+  cycles  -= osKernelGetTickCount() * interval;
+
+  for (n = 0U; n < count; n++) {
+    if ((waiterThread[n] == NULL) || (waitTick[n] != tick)) {
+      cycles = 0U;
+    }
+    if (waiterThread[n] != NULL) {
+      osThreadTerminate(waiterThread[n]);
+    }
+  }
+
+  return cycles;
+}
+
+/*----------------------------------------------------------------------------
+ * Timeout storm on a semaphore with 1, 8 and 32 waiters
+ *---------------------------------------------------------------------------*/
+
+int32_t bench_timeout (void) {
+  static const uint32_t count[] = { 0U, 1U, 8U, WAITER_MAX };
+  uint32_t base = 0U;
+  uint32_t best;
+  uint32_t valid;
+  uint32_t cycles;
+  uint32_t i;
+  uint32_t n;
+
+  stormSem = osSemaphoreNew(1U, 0U, NULL);
+  if (stormSem == NULL) {
+    return -1;
+  }
+
+  for (i = 0U; i < (sizeof(count) / sizeof(count[0])); i++) {
+    // Runs with a tick boundary while the waiters are started are repeated
+    best  = UINT32_MAX;
+    valid = 0U;
+    for (n = 0U; (n < RUN_MAX) && (valid < RUN_COUNT); n++) {
+      cycles = run(count[i]);
+      if (cycles != 0U) {
+        valid++;
+        if (cycles < best) {
+          best = cycles;
+        }
+      }
+    }
+    if (best == UINT32_MAX) {
+      return -1;
+    }
+    if (count[i] == 0U) {
+      base = best;
+      printf("no waiters: %u cycles from tick to thread\n", base);
+    } else {
+      printf("%2u waiters: %u cycles from tick to thread, %u cycles per timeout\n",
+             count[i], best, (best > base) ? ((best - base) / count[i]) : 0U);
+    }
+  }
+
+  osSemaphoreDelete(stormSem);
+
+  return 0;
+}
@@ -58,6 +58,65 @@
  #define RTX_STACK_CHECK
 #endif
 
+#if (defined(OS_MEMORY_TLSF) && (OS_MEMORY_TLSF != 0))
+ #define RTX_MEMORY_TLSF
+#endif
+
+#if (defined(OS_TIMING_WHEEL) && (OS_TIMING_WHEEL != 0))
+ #define RTX_TIMING_WHEEL
+#endif
+
+#if (defined(OS_WORK_QUEUE) && (OS_WORK_QUEUE != 0))
+ #define RTX_WORK_QUEUE
+#endif
+
+#if (defined(OS_HR_TIMER) && (OS_HR_TIMER != 0))
+ #define RTX_HR_TIMER
+#endif
+
+#if (defined(OS_TIMER_EXPIRED_LIST) && (OS_TIMER_EXPIRED_LIST != 0))
+ #define RTX_TIMER_EXPIRED_LIST
+#endif
+
+#if (defined(OS_TIMER_RESUME_MERGE) && (OS_TIMER_RESUME_MERGE != 0))
+ #define RTX_TIMER_RESUME_MERGE
+#endif
+
+#if (defined(OS_THREAD_READY_BITMAP) && (OS_THREAD_READY_BITMAP != 0))
+ #define RTX_THREAD_READY_BITMAP
+#endif
+
+#if (defined(OS_THREAD_RUN_TIME) && (OS_THREAD_RUN_TIME != 0))
+ #define RTX_THREAD_RUN_TIME
+#endif
+
+#if (defined(OS_THREAD_EDF) && (OS_THREAD_EDF != 0))
+ #define RTX_THREAD_EDF
+#endif
+
+#if (defined(OS_THREAD_BUDGET) && (OS_THREAD_BUDGET != 0))
+ #define RTX_THREAD_BUDGET
+#endif
+
+#if (defined(OS_THREAD_WAIT_ANY) && (OS_THREAD_WAIT_ANY != 0))
+ #define RTX_THREAD_WAIT_ANY
+#endif
+
+#if (defined(OS_EVFLAGS_WAIT_INDEX) && (OS_EVFLAGS_WAIT_INDEX != 0))
+ #define RTX_EVFLAGS_WAIT_INDEX
+#endif
+
+#ifndef OS_MUTEX_INHERIT_DEPTH
+ #define OS_MUTEX_INHERIT_DEPTH 1
+#endif
+#if (OS_MUTEX_INHERIT_DEPTH > 1)
+ #define RTX_MUTEX_INHERIT_DEPTH
+#endif
+
+#if (defined(OS_MUTEX_FAST_PATH) && (OS_MUTEX_FAST_PATH != 0))
+ #define RTX_MUTEX_FAST_PATH
+#endif
+
 #if (defined(OS_TZ_CONTEXT) && (OS_TZ_CONTEXT != 0))
  #define RTX_TZ_CONTEXT
 #endif
@@ -96,6 +96,7 @@
 #define osRtxErrorTZ_FreeContext_S      (-22)
 #define osRtxErrorTZ_LoadContext_S      (-23)
 #define osRtxErrorTZ_SaveContext_S      (-24)
+#define osRtxErrorMutexCeiling          (-25)
 
 
 //  ==== Memory Events ====
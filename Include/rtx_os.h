@@ -64,6 +64,10 @@ extern "C"
 #define osRtxAttrClass_Pos      4U
 #define osRtxAttrClass_Msk      0xF0U
  
+/// Message Queue Attribute definitions
+#define osRtxAttrFifo           0x01U   ///< FIFO Ring Buffer
+#define osRtxAttrFifoSP         0x02U   ///< FIFO Ring Buffer with Single Producer
+ 
  
 //  ==== Kernel definitions ====
  
@@ -100,9 +104,16 @@ extern "C"
 #define osRtxThreadWaitingMemoryPool    ((uint8_t)(osRtxThreadBlocked | 0x70U))
 #define osRtxThreadWaitingMessageGet    ((uint8_t)(osRtxThreadBlocked | 0x80U))
 #define osRtxThreadWaitingMessagePut    ((uint8_t)(osRtxThreadBlocked | 0x90U))
+#define osRtxThreadWaitingMessageLoan   ((uint8_t)(osRtxThreadBlocked | 0xA0U))
+#define osRtxThreadWaitingMessageRecv   ((uint8_t)(osRtxThreadBlocked | 0xB0U))
+#define osRtxThreadWaitingBudget        ((uint8_t)(osRtxThreadBlocked | 0xC0U))
+#define osRtxThreadWaitingAny           ((uint8_t)(osRtxThreadBlocked | 0xD0U))
  
 /// Thread Flags definitions
 #define osRtxThreadFlagDefStack 0x10U   ///< Default Stack flag
+#define osRtxThreadFlagWaitList 0x20U   ///< Wait List flag (Timing Wheel)
+#define osRtxThreadFlagDeadline 0x40U   ///< Deadline scheduling flag
+#define osRtxThreadFlagMissed   0x80U   ///< Deadline Missed flag
  
 /// Stack Marker definitions
 #define osRtxStackMagicWord     0xE25A2EA5U ///< Stack Magic Word (Stack Base)
@@ -130,13 +141,45 @@ typedef struct osRtxThread_s {
   struct osRtxMutex_s     *mutex_list;  ///< Link pointer to list of owned Mutexes
   void                     *stack_mem;  ///< Stack Memory
   uint32_t                 stack_size;  ///< Stack Size
-  uint32_t                         sp;  ///< Current Stack Pointer
-  uint32_t                thread_addr;  ///< Thread entry address
+  uintptr_t                        sp;  ///< Current Stack Pointer
+  uintptr_t               thread_addr;  ///< Thread entry address
   uint32_t                  tz_memory;  ///< TrustZone Memory Identifier
   uint8_t                        zone;  ///< Thread Zone
-  uint8_t                 reserved[3];
+  int8_t               priority_ready;  ///< Ready List Priority Level
+  uint8_t                    affinity;  ///< Processor Affinity Mask
+  uint8_t                budget_state;  ///< Execution Budget State
   struct osRtxThread_s     *wdog_next;  ///< Link pointer to next Thread in Watchdog list
   uint32_t                  wdog_tick;  ///< Watchdog tick counter
+  void                     *list_root;  ///< Object list root (Object or Ready list)
+  void                     *post_next;  ///< Link pointer to next Object in Post Processing list
+#ifdef RTX_THREAD_RUN_TIME
+  uint32_t                   run_time;  ///< Run Time (system timer counts, low word)
+  uint32_t                run_time_hi;  ///< Run Time (system timer counts, high word)
+  uint32_t                    preempt;  ///< Preemption Count
+  uint32_t                      yield;  ///< Voluntary Context Switch Count
+#endif
+#ifdef RTX_THREAD_EDF
+  uint32_t                     period;  ///< Deadline scheduling Period
+  uint32_t               deadline_rel;  ///< Relative Deadline
+  uint32_t                   deadline;  ///< Absolute Deadline (Kernel Tick)
+#endif
+#ifdef RTX_THREAD_BUDGET
+  struct osRtxThread_s   *budget_next;  ///< Link pointer to next Thread in Budget list
+  struct osRtxThread_s   *budget_prev;  ///< Link pointer to previous Thread in Budget list
+  uint32_t                     budget;  ///< Execution Budget
+  uint32_t              budget_period;  ///< Execution Budget replenishment Period
+  uint32_t                budget_left;  ///< Remaining Execution Budget
+  uint32_t                budget_time;  ///< Execution Budget Period start (Kernel Tick)
+  int8_t                  budget_prio;  ///< Priority while Budget is exhausted
+  int8_t                  budget_base;  ///< Base Priority before Budget demotion
+  uint8_t                 reserved[2];
+#endif
+#ifdef RTX_EVFLAGS_WAIT_INDEX
+  struct osRtxThread_s     *wait_next;  ///< Link pointer to next Thread in Event Flags wait list
+  struct osRtxThread_s     *wait_prev;  ///< Link pointer to previous Thread in Event Flags wait list
+  uint8_t                  wait_index;  ///< Event Flags wait list index
+  uint8_t                reserved1[3];
+#endif
 } osRtxThread_t;
  
  
@@ -149,6 +192,7 @@ typedef struct osRtxThread_s {
  
 /// Timer attribute definitions
 #define osRtxTimerPeriodic      0x01U   ///< Timer Periodic mode
+#define osRtxTimerInline        0x02U   ///< Timer Callback executed in Kernel Tick handler
  
 /// Timer Function Information
 typedef struct {
@@ -168,6 +212,7 @@ typedef struct osRtxTimer_s {
   uint32_t                       tick;  ///< Timer current Tick
   uint32_t                       load;  ///< Timer Load value
   osRtxTimerFinfo_t             finfo;  ///< Timer Function Info
+  struct osRtxTimer_s        *expired;  ///< Pointer to next expired Timer (Callback pending)
 } osRtxTimer_t;
  
  
@@ -182,6 +227,11 @@ typedef struct {
   const char                    *name;  ///< Object Name
   osRtxThread_t          *thread_list;  ///< Waiting Threads List
   uint32_t                event_flags;  ///< Event Flags
+  uint32_t                 wait_flags;  ///< Event Flags waited for by Threads in list (superset)
+  void                     *post_next;  ///< Link pointer to next Object in Post Processing list
+#ifdef RTX_EVFLAGS_WAIT_INDEX
+  osRtxThread_t        *wait_list[32];  ///< Waiting Threads per Event Flag (last: any of several Event Flags)
+#endif
 } osRtxEventFlags_t;
  
  
@@ -199,7 +249,8 @@ typedef struct osRtxMutex_s {
   struct osRtxMutex_s     *owner_prev;  ///< Pointer to previous owned Mutex
   struct osRtxMutex_s     *owner_next;  ///< Pointer to next owned Mutex
   uint8_t                        lock;  ///< Lock counter
-  uint8_t                  padding[3];
+  int8_t                      ceiling;  ///< Ceiling Priority (0 = no ceiling)
+  uint8_t                  padding[2];
 } osRtxMutex_t;
  
  
@@ -215,6 +266,7 @@ typedef struct {
   osRtxThread_t          *thread_list;  ///< Waiting Threads List
   uint16_t                     tokens;  ///< Current number of tokens
   uint16_t                 max_tokens;  ///< Maximum number of tokens
+  void                     *post_next;  ///< Link pointer to next Object in Post Processing list
 } osRtxSemaphore_t;
  
  
@@ -239,6 +291,7 @@ typedef struct {
   const char                    *name;  ///< Object Name
   osRtxThread_t          *thread_list;  ///< Waiting Threads List
   osRtxMpInfo_t               mp_info;  ///< Memory Pool Info
+  void                     *post_next;  ///< Link pointer to next Object in Post Processing list
 } osRtxMemoryPool_t;
  
  
@@ -267,8 +320,19 @@ typedef struct {
   uint32_t                  msg_count;  ///< Number of queued Messages
   osRtxMessage_t           *msg_first;  ///< Pointer to first Message
   osRtxMessage_t            *msg_last;  ///< Pointer to last Message
+  uint16_t                  fifo_head;  ///< FIFO Ring Buffer Read Index
+  uint16_t                  fifo_tail;  ///< FIFO Ring Buffer Write Index
+  uint16_t                 fifo_count;  ///< FIFO Ring Buffer Reserved Slots
+  uint8_t                   fifo_wait;  ///< FIFO Ring Buffer Waiting Threads
+  uint8_t                     padding;
+  void                     *post_next;  ///< Link pointer to next Object in Post Processing list
+  void                      *msg_pend;  ///< Messages put or removed from ISR (last first)
 } osRtxMessageQueue_t;
  
+/// Message Queue FIFO Waiting Threads definitions
+#define osRtxMessageQueueWaitGet 0x01U  ///< Thread waiting to receive a Message
+#define osRtxMessageQueueWaitPut 0x02U  ///< Thread waiting to send a Message
+ 
  
 //  ==== Generic Object definitions ====
  
@@ -312,6 +376,12 @@ typedef struct {
       osRtxThread_t           *thread;  ///< Round Robin Thread
       uint32_t                timeout;  ///< Round Robin Timeout
     } robin;                            ///< Thread Round Robin Info
+    struct {
+      uint32_t              timestamp;  ///< Last Update (system timer count)
+      uint32_t                   time;  ///< Total Run Time (low word)
+      uint32_t                time_hi;  ///< Total Run Time (high word)
+    } run_time;                         ///< Thread Run Time Accounting
+    osRtxObject_t            wait_any;  ///< Wait Any List Object
   } thread;                             ///< Thread Info
   struct {
     osRtxTimer_t                *list;  ///< Active Timer List
@@ -327,12 +397,13 @@ typedef struct {
     void                       **data;  ///< Queue Data
   } isr_queue;                          ///< ISR Post Processing Queue
   struct {
-    void          (*thread)(osRtxThread_t*);  ///< Thread Post Processing function
-    void (*event_flags)(osRtxEventFlags_t*);  ///< Event Flags Post Processing function
-    void    (*semaphore)(osRtxSemaphore_t*);  ///< Semaphore Post Processing function
-    void (*memory_pool)(osRtxMemoryPool_t*);  ///< Memory Pool Post Processing function
-    void        (*message)(osRtxMessage_t*);  ///< Message Post Processing function
-  } post_process;                             ///< ISR Post Processing functions
+    void             (*thread)(osRtxThread_t*);  ///< Thread Post Processing function
+    void    (*event_flags)(osRtxEventFlags_t*);  ///< Event Flags Post Processing function
+    void       (*semaphore)(osRtxSemaphore_t*);  ///< Semaphore Post Processing function
+    void    (*memory_pool)(osRtxMemoryPool_t*);  ///< Memory Pool Post Processing function
+    void      (*message)(osRtxMessageQueue_t*);  ///< Message Queue Post Processing function
+    void (*message_fifo)(osRtxMessageQueue_t*);  ///< Message Queue FIFO Post Processing function
+  } post_process;                                ///< ISR Post Processing functions
   struct {
     void                       *stack;  ///< Stack Memory
     void                     *mp_data;  ///< Memory Pool Data Memory
@@ -391,13 +462,101 @@ extern osRtxObjectMemUsage_t osRtxMessageQueueMemUsage;
 /// \param         block_count   maximum number of memory blocks in memory pool.
 /// \param         block_size    memory block size in bytes.
 #define osRtxMemoryPoolMemSize(block_count, block_size) \
-  (4*(block_count)*(((block_size)+3)/4))
+  (sizeof(void *)*(block_count)*(((block_size)+sizeof(void *)-1)/sizeof(void *)))
+ 
+/// Message Queue attributes (osMessageQueueAttr_t::attr_bits)
+#define osRtxMessageQueueFifo     0x00000001U ///< FIFO ring buffer (priority not used): multiple producers, single consumer
+#define osRtxMessageQueueFifoSPSC 0x00000003U ///< FIFO ring buffer (priority not used): single producer, single consumer
+ 
+/// Timer attributes (osTimerAttr_t::attr_bits)
+#define osRtxTimerCallbackInline  0x00000001U ///< Callback executed in Kernel Tick handler (interrupt context)
+ 
+/// Mutex attributes (osMutexAttr_t::attr_bits)
+#define osRtxMutexPrioCeiling_Pos 24U
+#define osRtxMutexPrioCeiling_Msk (0x7FUL << osRtxMutexPrioCeiling_Pos)
+#define osRtxMutexPrioCeiling(priority) \
+  ((((uint32_t)(priority)) << osRtxMutexPrioCeiling_Pos) & osRtxMutexPrioCeiling_Msk) ///< Priority ceiling protocol
+ 
+/// Wait Object (osRtxThreadWaitAny)
+typedef struct {
+  void                     *object_id;  ///< Semaphore, Event Flags or Message Queue ID
+  uint32_t                      flags;  ///< Event Flags to wait for (any of them)
+} osRtxWaitObject_t;
+ 
+#define osRtxWaitObjectLimit       16U  ///< Maximum number of Wait Objects
+ 
+/// Thread Run Time Information
+typedef struct {
+  uint64_t                   run_time;  ///< Run Time (system timer counts)
+  uint32_t                    preempt;  ///< Number of Preemptions (involuntary context switches)
+  uint32_t                      yield;  ///< Number of voluntary context switches (yield or wait)
+} osRtxThreadRunTime_t;
+ 
+/// Kernel Run Time Information
+typedef struct {
+  uint64_t                 total_time;  ///< Total accounted Run Time (system timer counts)
+  uint64_t                  idle_time;  ///< Idle Thread Run Time (system timer counts)
+} osRtxKernelRunTime_t;
+ 
+/// Deferred Work Level definitions (osRtxWork_t::level)
+#define osRtxWorkLevelSoftIrq       0U  ///< Work executed by PendSV (soft IRQ)
+#define osRtxWorkLevelThread        1U  ///< Work executed by Work Thread
+#define osRtxWorkLevels             2U  ///< Number of Work Levels
+ 
+/// Deferred Work Function
+typedef void (*osRtxWorkFunc_t) (void *argument);
+ 
+/// Deferred Work Item
+typedef struct osRtxWork_s {
+  struct osRtxWork_s            *next;  ///< Link pointer to next pending Work Item (NULL when not pending)
+  osRtxWorkFunc_t                func;  ///< Work Function
+  void                      *argument;  ///< Work Function argument
+  uint32_t                  timestamp;  ///< Submit time (system timer count)
+  uint8_t                       level;  ///< Work Level
+  uint8_t                  padding[3];
+} osRtxWork_t;
+ 
+/// Deferred Work Item initializer.
+/// \param         func          work function.
+/// \param         argument      work function argument.
+/// \param         level         work level.
+#define osRtxWorkInit(func, argument, level) \
+  { NULL, (func), (argument), 0U, (uint8_t)(level), { 0U, 0U, 0U } }
+ 
+/// Deferred Work Statistics
+typedef struct {
+  uint32_t                      count;  ///< Number of executed Work Items
+  uint32_t                    backlog;  ///< Number of pending Work Items
+  uint32_t                backlog_max;  ///< Maximum number of pending Work Items
+  uint32_t                    latency;  ///< Latency of last executed Work Item (system timer counts)
+  uint32_t                latency_max;  ///< Maximum Latency from submit to execution (system timer counts)
+} osRtxWorkStats_t;
+ 
+/// High-Resolution Timer Function
+typedef void (*osRtxHrTimerFunc_t) (void *argument);
+ 
+/// High-Resolution Timer
+typedef struct osRtxHrTimer_s {
+  struct osRtxHrTimer_s         *prev;  ///< Pointer to previous active High-Resolution Timer
+  struct osRtxHrTimer_s         *next;  ///< Pointer to next active High-Resolution Timer
+  osRtxHrTimerFunc_t             func;  ///< Timer Function
+  void                      *argument;  ///< Timer Function argument
+  uint32_t                   deadline;  ///< Expiry time (system timer count)
+  uint8_t                      active;  ///< Active flag
+  uint8_t                  padding[3];
+} osRtxHrTimer_t;
+ 
+/// High-Resolution Timer initializer.
+/// \param         func          timer function.
+/// \param         argument      timer function argument.
+#define osRtxHrTimerInit(func, argument) \
+  { NULL, NULL, (func), (argument), 0U, 0U, { 0U, 0U, 0U } }
  
 /// Memory size in bytes for Message Queue storage.
 /// \param         msg_count     maximum number of messages in queue.
 /// \param         msg_size      maximum message size in bytes.
 #define osRtxMessageQueueMemSize(msg_count, msg_size) \
-  (4*(msg_count)*(3+(((msg_size)+3)/4)))
+  ((msg_count)*(sizeof(osRtxMessage_t)+(sizeof(void *)*(((msg_size)+sizeof(void *)-1)/sizeof(void *)))))
  
  
 //  ==== OS External Functions ====
@@ -410,6 +569,7 @@ extern osRtxObjectMemUsage_t osRtxMessageQueueMemUsage;
 #define osRtxErrorClibSpace             4U  ///< Standard C/C++ library libspace not available: increase \c OS_THREAD_LIBSPACE_NUM.
 #define osRtxErrorClibMutex             5U  ///< Standard C/C++ library mutex initialization failed.
 #define osRtxErrorSVC                   6U  ///< Invalid SVC function called.
+#define osRtxErrorDeadlineMiss          7U  ///< Thread did not complete its job by its absolute deadline.
  
 /// OS Error Callback function
 extern uint32_t osRtxErrorNotify (uint32_t code, void *object_id);
@@ -418,6 +578,51 @@ extern uint32_t osRtxKernelErrorNotify (uint32_t code, void *object_id);
 /// OS Idle Thread
 extern void osRtxIdleThread (void *argument);
  
+/// OS Tickless Idle function
+extern void osRtxKernelIdleSleep (void);
+ 
+/// OS Tick extension for Tickless Idle
+extern uint32_t OS_Tick_SleepEnter (uint32_t ticks);
+extern uint32_t OS_Tick_SleepExit  (void);
+ 
+/// OS Tick extension for High-Resolution Timers
+extern int32_t  OS_Tick_CompareSetup (void (*handler) (void));
+extern void     OS_Tick_CompareStart (uint32_t count);
+extern int32_t  OS_Tick_CompareIRQ   (void);
+extern uint32_t OS_Tick_CompareGetCount (void);
+ 
+/// OS Message Queue zero-copy functions
+extern void      *osRtxMessageQueueLoan    (osMessageQueueId_t mq_id, uint32_t timeout);
+extern osStatus_t osRtxMessageQueueCommit  (osMessageQueueId_t mq_id, void *msg_ptr, uint8_t msg_prio);
+extern void      *osRtxMessageQueueReceive (osMessageQueueId_t mq_id, uint8_t *msg_prio, uint32_t timeout);
+extern osStatus_t osRtxMessageQueueRelease (osMessageQueueId_t mq_id, void *msg_ptr);
+ 
+/// OS Message Queue batch functions
+extern uint32_t osRtxMessageQueuePutN (osMessageQueueId_t mq_id, const void *msg_ptr, uint32_t msg_count, uint8_t msg_prio, uint32_t timeout);
+extern uint32_t osRtxMessageQueueGetN (osMessageQueueId_t mq_id, void *msg_ptr, uint32_t msg_count, uint8_t *msg_prio, uint32_t timeout);
+ 
+/// OS Run Time Accounting functions
+extern osStatus_t osRtxThreadGetRunTime (osThreadId_t thread_id, osRtxThreadRunTime_t *run_time);
+extern osStatus_t osRtxKernelGetRunTime (osRtxKernelRunTime_t *run_time);
+ 
+/// OS Deadline scheduling functions
+extern osStatus_t osRtxThreadSetDeadline (osThreadId_t thread_id, uint32_t period, uint32_t deadline);
+extern osStatus_t osRtxThreadWaitPeriod  (void);
+ 
+/// OS Execution Budget functions
+extern osStatus_t osRtxThreadSetBudget (osThreadId_t thread_id, uint32_t budget, uint32_t period, osPriority_t priority);
+ 
+/// OS Wait for multiple Objects function
+extern int32_t osRtxThreadWaitAny (const osRtxWaitObject_t *objects, uint32_t count, uint32_t timeout);
+ 
+/// OS Deferred Work functions
+extern osStatus_t osRtxWorkSubmit   (osRtxWork_t *work);
+extern osStatus_t osRtxWorkGetStats (uint32_t level, osRtxWorkStats_t *stats);
+ 
+/// OS High-Resolution Timer functions
+extern osStatus_t osRtxHrTimerStart (osRtxHrTimer_t *timer, uint32_t deadline);
+extern osStatus_t osRtxHrTimerStop  (osRtxHrTimer_t *timer);
+ 
 /// OS Exception handlers
 extern void SVC_Handler     (void);
 extern void PendSV_Handler  (void);
@@ -436,6 +641,7 @@ extern void SysTick_Handler (void);
 #define osRtxConfigThreadWatchdog   (1UL<<6)   ///< Thread Watchdog enabled
 #define osRtxConfigObjPtrCheck      (1UL<<7)   ///< Object Pointer Checking enabled
 #define osRtxConfigSVCPtrCheck      (1UL<<8)   ///< SVC Pointer Checking enabled
+#define osRtxConfigTicklessIdle     (1UL<<9)   ///< Tickless Idle enabled
  
 /// OS Configuration structure
 typedef struct {
@@ -477,6 +683,9 @@ typedef struct {
   const
   osMessageQueueAttr_t        *timer_mq_attr;  ///< Timer Message Queue Attributes
   uint32_t                     timer_mq_mcnt;  ///< Timer Message Queue maximum Messages
+  const
+  osThreadAttr_t           *work_thread_attr;  ///< Work Thread Attributes
+  uint32_t                        work_batch;  ///< Work Items executed in one batch
 } osRtxConfig_t;
  
 extern const osRtxConfig_t osRtxConfig;        ///< OS Configuration
@@ -94,6 +94,45 @@
 #define OS_OBJ_MEM_USAGE            0
 #endif
  
+//   <q>Hierarchical timing wheel
+//   <i> Organizes thread delays and active timers in a hierarchical timing wheel (requires RTX source variant).
+//   <i> Enabling this option makes timeout insertion and removal independent of the number of pending timeouts.
+#ifndef OS_TIMING_WHEEL
+#define OS_TIMING_WHEEL             0
+#endif
+ 
+//   <q>TLSF memory allocator
+//   <i> Uses a two-level segregated fit allocator for dynamic memory (requires RTX source variant).
+//   <i> Enabling this option makes memory allocation and release independent of the number of allocated blocks.
+#ifndef OS_MEMORY_TLSF
+#define OS_MEMORY_TLSF              0
+#endif
+ 
+//   <q>Deferred Work
+//   <i> Enables osRtxWorkSubmit to defer work items from interrupt handlers (requires RTX source variant).
+//   <i> Work items are executed by PendSV (soft IRQ level) or by the Work Thread (thread level).
+#ifndef OS_WORK_QUEUE
+#define OS_WORK_QUEUE               0
+#endif
+ 
+//   <q>Expired Timer List
+//   <i> Passes expired timers to the Timer Thread in a list instead of the Timer Callback Queue (requires RTX source variant).
+#ifndef OS_TIMER_EXPIRED_LIST
+#define OS_TIMER_EXPIRED_LIST       0
+#endif
+ 
+//   <q>Merge Periods missed during Kernel Sleep
+//   <i> osKernelResume calls a periodic timer once at its last period within the sleep instead of once per period (requires RTX source variant).
+#ifndef OS_TIMER_RESUME_MERGE
+#define OS_TIMER_RESUME_MERGE       0
+#endif
+ 
+//   <q>High-Resolution Timers
+//   <i> Enables osRtxHrTimerStart to call functions at absolute system timer deadlines (requires RTX source variant).
+#ifndef OS_HR_TIMER
+#define OS_HR_TIMER                 0
+#endif
+ 
 // </h>
  
 // <h>Thread Configuration
@@ -106,6 +145,54 @@
 #define OS_STACK_CHECK              0
 #endif
  
+//   <q>Ready queue priority bitmap
+//   <i> Organizes ready threads in per-priority FIFO lists indexed by a priority bitmap (requires RTX source variant).
+//   <i> Enabling this option makes thread wakeup and preemption independent of the number of ready threads.
+#ifndef OS_THREAD_READY_BITMAP
+#define OS_THREAD_READY_BITMAP      0
+#endif
+ 
+//   <q>Thread run time accounting
+//   <i> Accumulates run time, preemptions and voluntary context switches per thread (requires RTX source variant).
+//   <i> Run time is measured in system timer counts and read with osRtxThreadGetRunTime and osRtxKernelGetRunTime.
+#ifndef OS_THREAD_RUN_TIME
+#define OS_THREAD_RUN_TIME          0
+#endif
+ 
+//   <e>Earliest deadline first scheduling
+//   <i> Schedules threads with a deadline by their absolute deadline within one priority level (requires RTX source variant).
+//   <i> Deadlines are assigned with osRtxThreadSetDeadline and missed deadlines are reported to osRtxErrorNotify.
+#ifndef OS_THREAD_EDF
+#define OS_THREAD_EDF               0
+#endif
+ 
+//     <o>Deadline scheduling Priority
+//        <8=> Low
+//       <16=> Below Normal  <24=> Normal  <32=> Above Normal
+//       <40=> High
+//       <48=> Realtime
+//     <i> Defines priority level of threads with a deadline.
+//     <i> Default: High
+#ifndef OS_THREAD_EDF_PRIO
+#define OS_THREAD_EDF_PRIO          40
+#endif
+ 
+//   </e>
+ 
+//   <q>Thread execution budget
+//   <i> Limits the kernel ticks a thread runs within each replenishment period (requires RTX source variant).
+//   <i> Budgets are assigned with osRtxThreadSetBudget. A thread exceeding its budget is demoted or suspended.
+#ifndef OS_THREAD_BUDGET
+#define OS_THREAD_BUDGET            0
+#endif
+ 
+//   <q>Wait for multiple objects
+//   <i> Enables osRtxThreadWaitAny to wait for semaphores, event flags and message queues (requires RTX source variant).
+//   <i> Signaling an object then also checks the threads waiting for multiple objects.
+#ifndef OS_THREAD_WAIT_ANY
+#define OS_THREAD_WAIT_ANY          0
+#endif
+ 
 // </h>
  
 // <h>Event Recorder Configuration
@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2013-2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-RTOS RTX
+ * Title:       POSIX Host compiler abstraction and emulated core intrinsics
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef __CMSIS_COMPILER_H
+#define __CMSIS_COMPILER_H
+
+#include <stdint.h>
+
+#if !defined(__GNUC__)
+#error "POSIX Host port requires GCC or Clang!"
+#endif
+
+//  ==== Compiler specific defines ====
+
+#ifndef   __ASM
+  #define __ASM                     __asm
+#endif
+#ifndef   __INLINE
+  #define __INLINE                  inline
+#endif
+#ifndef   __STATIC_INLINE
+  #define __STATIC_INLINE           static inline
+#endif
+#ifndef   __STATIC_FORCEINLINE
+  #define __STATIC_FORCEINLINE      __attribute__((always_inline)) static inline
+#endif
+#ifndef   __NO_RETURN
+  #define __NO_RETURN               __attribute__((__noreturn__))
+#endif
+#ifndef   __USED
+  #define __USED                    __attribute__((used))
+#endif
+#ifndef   __WEAK
+  #define __WEAK                    __attribute__((weak))
+#endif
+#ifndef   __PACKED
+  #define __PACKED                  __attribute__((packed, aligned(1)))
+#endif
+#ifndef   __PACKED_STRUCT
+  #define __PACKED_STRUCT           struct __attribute__((packed, aligned(1)))
+#endif
+#ifndef   __PACKED_UNION
+  #define __PACKED_UNION            union __attribute__((packed, aligned(1)))
+#endif
+#ifndef   __ALIGNED
+  #define __ALIGNED(x)              __attribute__((aligned(x)))
+#endif
+#ifndef   __RESTRICT
+  #define __RESTRICT                __restrict
+#endif
+#ifndef   __COMPILER_BARRIER
+  #define __COMPILER_BARRIER()      __ASM volatile("":::"memory")
+#endif
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+//  ==== Emulated Core Register functions (irq_posix.c) ====
+
+/// Enable IRQ Interrupts (clear emulated PRIMASK and serve pending interrupts)
+extern void     __enable_irq  (void);
+
+/// Disable IRQ Interrupts (set emulated PRIMASK)
+extern void     __disable_irq (void);
+
+/// Get emulated Priority Mask
+/// \return     Priority Mask value
+extern uint32_t __get_PRIMASK (void);
+
+/// Get emulated IPSR Register
+/// \return     Active exception number (0 = Thread mode)
+extern uint32_t __get_IPSR    (void);
+
+/// Get emulated CONTROL Register (privileged Thread mode & PSP)
+/// \return     CONTROL Register value
+__STATIC_INLINE uint32_t __get_CONTROL (void) {
+  return 0x02U;
+}
+
+//  ==== Emulated Core Instruction functions ====
+
+/// No Operation
+#define __NOP()                     __ASM volatile ("")
+
+/// Wait For Interrupt (suspend the host process until a signal arrives)
+extern void     __WFI (void);
+
+/// Wait For Event
+#define __WFE()                     __WFI()
+
+/// Send Event
+#define __SEV()                     __ASM volatile ("")
+
+/// Instruction Synchronization Barrier
+#define __ISB()                     __atomic_signal_fence(__ATOMIC_SEQ_CST)
+
+/// Data Synchronization Barrier
+#define __DSB()                     __atomic_signal_fence(__ATOMIC_SEQ_CST)
+
+/// Data Memory Barrier
+#define __DMB()                     __atomic_signal_fence(__ATOMIC_SEQ_CST)
+
+/// Count leading zeros
+/// \param[in]  value           Value to count the leading zeros
+/// \return                     number of leading zeros in value
+__STATIC_INLINE uint8_t __CLZ (uint32_t value) {
+  if (value == 0U) {
+    return 32U;
+  }
+  return ((uint8_t)__builtin_clz(value));
+}
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif  // __CMSIS_COMPILER_H
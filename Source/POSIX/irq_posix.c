@@ -0,0 +1,490 @@
+/*
+ * Copyright (c) 2013-2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-RTOS RTX
+ * Title:       POSIX Host Exception handlers and Core emulation
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include <errno.h>
+#include <signal.h>
+#include <string.h>
+#include <unistd.h>
+#include <ucontext.h>
+
+#include "rtx_lib.h"
+
+// AddressSanitizer is notified of the switches between thread stacks
+#if defined(__SANITIZE_ADDRESS__)
+#define IRQ_ASAN                1
+#elif defined(__has_feature)
+#if __has_feature(address_sanitizer)
+#define IRQ_ASAN                1
+#endif
+#endif
+
+#ifdef IRQ_ASAN
+#include <sanitizer/asan_interface.h>
+#include <sanitizer/common_interface_defs.h>
+#endif
+
+// The host process is a single core:
+//  - exceptions and interrupts are emulated with POSIX signals and a
+//    pending bitmap indexed by exception number (IPSR value),
+//  - PRIMASK masks the emulated interrupts in software,
+//  - service calls are direct calls in SVCall exception state (IPSR = 11),
+//  - threads execute on their RTX stacks with ucontext context switching.
+// Exceptions do not nest: an exception is served only in Thread mode with
+// PRIMASK cleared, otherwise it stays pending until exception exit.
+
+#define EXC_SVCALL              ((uint32_t)((int32_t)SVCall_IRQn  + 16))
+#define EXC_PENDSV              ((uint32_t)((int32_t)PendSV_IRQn  + 16))
+#define EXC_SYSTICK             ((uint32_t)((int32_t)SysTick_IRQn + 16))
+#define EXC_NUM                 32U
+
+#define SIGNAL_NUM              65
+
+extern void PendSV_Handler  (void);
+extern void SysTick_Handler (void);
+
+static volatile uint32_t IRQ_Active;    // Active exception number (IPSR)
+static volatile uint32_t IRQ_Masked;    // Interrupt mask (PRIMASK)
+static volatile uint32_t IRQ_Pending;   // Pending exceptions (bit = exception number)
+static volatile uint32_t IRQ_Enable = (1UL << EXC_PENDSV) | (1UL << EXC_SYSTICK);
+
+// Exception vectors
+static uintptr_t IRQ_Vector[EXC_NUM] = {
+  [EXC_PENDSV] = (uintptr_t)PendSV_Handler
+};
+
+// Signal to exception number map
+static uint8_t  IRQ_Signal[SIGNAL_NUM];
+static sigset_t IRQ_SignalSet;
+
+// Thread startup context
+static ucontext_t ThreadStartContext;
+
+// Non weak library reference
+//lint -esym(765,irqRtxLib) "Global scope"
+extern const uint8_t irqRtxLib;
+       const uint8_t irqRtxLib = 0U;
+
+
+//  ==== Helper functions ====
+
+/// Get exception number of an interrupt
+/// \param[in]  IRQn            interrupt number.
+/// \return exception number or 0 when invalid.
+static uint32_t ExcNumber (IRQn_Type IRQn) {
+  int32_t exc = (int32_t)IRQn + 16;
+
+  if ((exc < (int32_t)EXC_PENDSV) || (exc >= (int32_t)EXC_NUM)) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return 0U;
+  }
+  return ((uint32_t)exc);
+}
+
+/// Serve pending exceptions in priority order (PendSV has lowest priority).
+static void ExceptionServe (void) {
+  IRQ_Handler_t handler;
+  uint32_t      pending;
+  uint32_t      exc;
+  uint32_t      bit;
+
+  for (;;) {
+    pending = IRQ_Pending & IRQ_Enable;
+    if ((pending == 0U) || (IRQ_Masked != 0U) || (IRQ_Active != 0U)) {
+      break;
+    }
+    if ((pending & ~(1UL << EXC_PENDSV)) != 0U) {
+      exc = (uint32_t)__builtin_ctz(pending & ~(1UL << EXC_PENDSV));
+    } else {
+      exc = EXC_PENDSV;
+    }
+    bit = 1UL << exc;
+    // Claim the exception (a signal may have served it meanwhile)
+    if ((__atomic_fetch_and(&IRQ_Pending, ~bit, __ATOMIC_SEQ_CST) & bit) != 0U) {
+      //lint -e{923} "cast from unsigned int to pointer"
+      handler = (IRQ_Handler_t)IRQ_Vector[exc];
+      if (handler != NULL) {
+        IRQ_Active = exc;
+        handler();
+        IRQ_Active = 0U;
+      }
+    }
+  }
+}
+
+/// Signal handler: emulated interrupt request.
+/// \param[in]  signo           signal number.
+static void IRQ_SignalHandler (int signo) {
+  int      err = errno;
+  uint32_t exc = IRQ_Signal[signo];
+
+  if (exc != 0U) {
+    (void)__atomic_fetch_or(&IRQ_Pending, 1UL << exc, __ATOMIC_SEQ_CST);
+    ExceptionServe();
+  }
+  errno = err;
+}
+
+/// Start switch to the stack of a thread (AddressSanitizer).
+/// Frames left on the stack of a suspended or deleted thread are cleared, since they are
+/// not unwound when the thread is terminated and its stack is reused by a new thread.
+/// \param[out] fake_stack      fake stack of the running thread or NULL when it is deleted.
+/// \param[in]  curr            running thread object or NULL when it is deleted.
+/// \param[in]  next            next thread object.
+static void StackSwitchStart (void **fake_stack, const os_thread_t *curr, const os_thread_t *next) {
+#ifdef IRQ_ASAN
+  if (curr != NULL) {
+    ASAN_UNPOISON_MEMORY_REGION(curr->stack_mem, curr->stack_size);
+  } else {
+    __asan_handle_no_return();
+  }
+  __sanitizer_start_switch_fiber(fake_stack, next->stack_mem, next->stack_size);
+#else
+  (void)fake_stack;
+  (void)curr;
+  (void)next;
+#endif
+}
+
+/// Finish switch to the stack of a thread (AddressSanitizer).
+/// \param[in]  fake_stack      fake stack of the resumed context or NULL when it is started.
+static void StackSwitchFinish (void *fake_stack) {
+#ifdef IRQ_ASAN
+  __sanitizer_finish_switch_fiber(fake_stack, NULL, NULL);
+#else
+  (void)fake_stack;
+#endif
+}
+
+/// Get host context of a suspended thread (stored in R4-R5 of the stack frame).
+/// \param[in]  thread          thread object.
+/// \return host context or NULL when thread has not been started yet.
+static ucontext_t *ThreadContextGet (const os_thread_t *thread) {
+  ucontext_t *ctx;
+
+  //lint -e{923} "cast from unsigned int to pointer"
+  memcpy(&ctx, (const void *)thread->sp, sizeof(ctx));
+  return ctx;
+}
+
+/// Set host context of a suspended thread (stored in R4-R5 of the stack frame).
+/// \param[in]  thread          thread object.
+/// \param[in]  ctx             host context.
+static void ThreadContextSet (const os_thread_t *thread, ucontext_t *ctx) {
+  //lint -e{923} "cast from unsigned int to pointer"
+  memcpy((void *)thread->sp, &ctx, sizeof(ctx));
+}
+
+/// Thread startup: execute thread entry from the initial stack frame.
+static void ThreadStart (void) {
+  const os_thread_t *thread = osRtxInfo.thread.run.curr;
+  //lint -e{923} "cast from unsigned int to pointer"
+  const uintptr_t   *frame  = (const uintptr_t *)thread->sp;
+  void             (*entry)(void *argument, osThreadFunc_t func);
+  void              *argument;
+  osThreadFunc_t     func;
+
+  StackSwitchFinish(NULL);
+
+  //lint --e{923} --e{9074} "cast between pointers and unsigned int"
+  entry    = (void (*)(void *, osThreadFunc_t))frame[14];   // PC
+  argument = (void *)frame[8];                              // R0
+  func     = (osThreadFunc_t)frame[9];                      // R1
+
+  // Thread mode
+  IRQ_Active = 0U;
+  IRQ_Masked = 0U;
+  ExceptionServe();
+
+  entry(argument, func);
+}
+
+/// Get host context for the next thread.
+/// \param[in]  thread          thread object.
+/// \return host context.
+static ucontext_t *ThreadContextNext (const os_thread_t *thread) {
+
+  if (ThreadContextGet(thread) != NULL) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return ThreadContextGet(thread);
+  }
+
+  // Thread not started yet: execute on stack below the initial stack frame
+  (void)getcontext(&ThreadStartContext);
+  ThreadStartContext.uc_stack.ss_sp   = thread->stack_mem;
+  //lint -e{923} "cast from pointer to unsigned int"
+  ThreadStartContext.uc_stack.ss_size = thread->sp - (uintptr_t)thread->stack_mem;
+  ThreadStartContext.uc_link          = NULL;
+  (void)sigemptyset(&ThreadStartContext.uc_sigmask);
+  makecontext(&ThreadStartContext, ThreadStart, 0);
+
+  return &ThreadStartContext;
+}
+
+/// Switch to the next thread (SVC_Context in Cortex-M exception handlers).
+/// \return true=running thread was switched, false=not switched.
+static bool_t SVC_Context (void) {
+  os_thread_t *curr = osRtxInfo.thread.run.curr;
+  os_thread_t *next = osRtxInfo.thread.run.next;
+  ucontext_t   ctx;
+  void        *fake_stack;
+  uint32_t     ipsr;
+  uint32_t     primask;
+
+  if (curr == next) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return FALSE;
+  }
+  osRtxInfo.thread.run.curr = next;
+
+#ifdef RTX_STACK_CHECK
+  // Check if thread stack is overrun
+  if ((curr != NULL) && !osRtxThreadStackCheck(curr)) {
+    (void)osRtxKernelErrorNotify(osRtxErrorStackOverflow, curr);
+    next = osRtxInfo.thread.run.next;
+    osRtxInfo.thread.run.curr = next;
+    curr = NULL;                        // Simulate deleted running thread
+  }
+#endif
+
+#ifdef RTX_EXECUTION_ZONE
+  // Setup zone for next thread
+  if ((curr == NULL) || (curr->zone != next->zone)) {
+    osZoneSetup_Callback(next->zone);
+  }
+#endif
+
+  if (curr == NULL) {
+    // Running thread is deleted: its stack is abandoned
+    StackSwitchStart(NULL, NULL, next);
+    (void)setcontext(ThreadContextNext(next));
+  }
+
+  // Save exception state, suspend running thread and restore on resume
+  ipsr    = IRQ_Active;
+  primask = IRQ_Masked;
+  ThreadContextSet(curr, &ctx);
+  StackSwitchStart(&fake_stack, curr, next);
+  (void)swapcontext(&ctx, ThreadContextNext(next));
+  StackSwitchFinish(fake_stack);
+  IRQ_Active = ipsr;
+  IRQ_Masked = primask;
+
+  return TRUE;
+}
+
+
+//  ==== Exception handlers ====
+
+/// Enter SVCall exception
+/// \return pointer to registers R0-R3 of running thread or NULL.
+uintptr_t *SVC_Enter (void) {
+  const os_thread_t *thread;
+
+  IRQ_Active = EXC_SVCALL;
+
+  thread = osRtxInfo.thread.run.curr;
+  if (thread == NULL) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return NULL;
+  }
+  return osRtxThreadRegPtr(thread);
+}
+
+/// Exit SVCall exception: switch thread and serve pending exceptions
+/// \return true=running thread was switched, false=not switched.
+bool_t SVC_Exit (void) {
+  bool_t switched;
+
+  switched = SVC_Context();
+  IRQ_Active = 0U;
+  ExceptionServe();
+
+  return switched;
+}
+
+/// PendSV exception handler
+void PendSV_Handler (void) {
+  osRtxPendSV_Handler();
+  (void)SVC_Context();
+}
+
+/// SysTick exception handler
+void SysTick_Handler (void) {
+  osRtxTick_Handler();
+  (void)SVC_Context();
+}
+
+
+//  ==== Emulated Core Register functions ====
+
+/// Enable IRQ Interrupts
+void __enable_irq (void) {
+  IRQ_Masked = 0U;
+  if (IRQ_Active == 0U) {
+    ExceptionServe();
+  }
+}
+
+/// Disable IRQ Interrupts
+void __disable_irq (void) {
+  IRQ_Masked = 1U;
+}
+
+/// Get Priority Mask
+uint32_t __get_PRIMASK (void) {
+  return IRQ_Masked;
+}
+
+/// Get IPSR Register
+uint32_t __get_IPSR (void) {
+  return IRQ_Active;
+}
+
+/// Wait For Interrupt
+void __WFI (void) {
+  sigset_t mask;
+
+  (void)sigprocmask(SIG_BLOCK, &IRQ_SignalSet, &mask);
+  if ((IRQ_Pending & IRQ_Enable) == 0U) {
+    (void)sigsuspend(&mask);
+  }
+  (void)sigprocmask(SIG_SETMASK, &mask, NULL);
+}
+
+
+//  ==== Emulated NVIC functions ====
+
+/// Enable Interrupt
+void NVIC_EnableIRQ (IRQn_Type IRQn) {
+  uint32_t exc = ExcNumber(IRQn);
+
+  if (exc != 0U) {
+    (void)__atomic_fetch_or(&IRQ_Enable, 1UL << exc, __ATOMIC_SEQ_CST);
+    if ((IRQ_Active == 0U) && (IRQ_Masked == 0U)) {
+      ExceptionServe();
+    }
+  }
+}
+
+/// Disable Interrupt
+void NVIC_DisableIRQ (IRQn_Type IRQn) {
+  uint32_t exc = ExcNumber(IRQn);
+
+  if (exc != 0U) {
+    (void)__atomic_fetch_and(&IRQ_Enable, ~(1UL << exc), __ATOMIC_SEQ_CST);
+  }
+}
+
+/// Get Interrupt Enable status
+uint32_t NVIC_GetEnableIRQ (IRQn_Type IRQn) {
+  uint32_t exc = ExcNumber(IRQn);
+
+  if (exc == 0U) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return 0U;
+  }
+  return ((IRQ_Enable >> exc) & 1U);
+}
+
+/// Set Pending Interrupt
+void NVIC_SetPendingIRQ (IRQn_Type IRQn) {
+  uint32_t exc = ExcNumber(IRQn);
+
+  if (exc != 0U) {
+    (void)__atomic_fetch_or(&IRQ_Pending, 1UL << exc, __ATOMIC_SEQ_CST);
+    if ((IRQ_Active == 0U) && (IRQ_Masked == 0U)) {
+      ExceptionServe();
+    }
+  }
+}
+
+/// Clear Pending Interrupt
+void NVIC_ClearPendingIRQ (IRQn_Type IRQn) {
+  uint32_t exc = ExcNumber(IRQn);
+
+  if (exc != 0U) {
+    (void)__atomic_fetch_and(&IRQ_Pending, ~(1UL << exc), __ATOMIC_SEQ_CST);
+  }
+}
+
+/// Get Pending Interrupt
+uint32_t NVIC_GetPendingIRQ (IRQn_Type IRQn) {
+  uint32_t exc = ExcNumber(IRQn);
+
+  if (exc == 0U) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return 0U;
+  }
+  return ((IRQ_Pending >> exc) & 1U);
+}
+
+/// Set Interrupt Vector
+void NVIC_SetVector (IRQn_Type IRQn, uintptr_t vector) {
+  uint32_t exc = ExcNumber(IRQn);
+
+  if (exc != 0U) {
+    IRQ_Vector[exc] = vector;
+  }
+}
+
+/// Get Interrupt Vector
+uintptr_t NVIC_GetVector (IRQn_Type IRQn) {
+  uint32_t exc = ExcNumber(IRQn);
+
+  if (exc == 0U) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return 0U;
+  }
+  return IRQ_Vector[exc];
+}
+
+/// Route a POSIX signal to an interrupt
+int32_t NVIC_SetSignal (IRQn_Type IRQn, int signo) {
+  struct sigaction sa;
+  uint32_t         exc = ExcNumber(IRQn);
+
+  if ((exc <= EXC_PENDSV) || (signo <= 0) || (signo >= SIGNAL_NUM)) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return -1;
+  }
+
+  IRQ_Signal[signo] = (uint8_t)exc;
+  (void)sigaddset(&IRQ_SignalSet, signo);
+
+  // Exceptions do not nest: block all signals while in the signal handler
+  memset(&sa, 0, sizeof(sa));
+  sa.sa_handler = IRQ_SignalHandler;
+  sa.sa_flags   = SA_RESTART;
+  (void)sigfillset(&sa.sa_mask);
+  if (sigaction(signo, &sa, NULL) != 0) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return -1;
+  }
+  return 0;
+}
@@ -0,0 +1,270 @@
+/*
+ * Copyright (c) 2013-2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-RTOS RTX
+ * Title:       POSIX Host OS Tick implementation (interval timer and SIGALRM)
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include <signal.h>
+#include <string.h>
+#include <sys/time.h>
+#include <time.h>
+
+#include "RTE_Components.h"
+#include  CMSIS_device_header
+#include "os_tick.h"
+
+// System Clock Frequency: nanosecond time base of the host monotonic clock
+uint32_t SystemCoreClock = 1000000000U;
+
+static uint32_t Tick_Interval;          // Tick interval [ns]
+static uint64_t Tick_Period;            // Start of current tick period [ns]
+static uint8_t  Tick_Enabled;
+static uint8_t  Tick_Pending;           // Tick interrupt pending while disabled
+
+// OS Tick compare interrupt (host POSIX timer and first real-time signal)
+#define COMPARE_IRQn            Interrupt15_IRQn
+
+static timer_t  Compare_Timer;
+
+/// Get host monotonic time
+/// \return time in nanoseconds
+static uint64_t ClockGetTime (void) {
+  struct timespec ts;
+
+  (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (((uint64_t)ts.tv_sec * 1000000000U) + (uint64_t)ts.tv_nsec);
+}
+
+/// Get time elapsed in current tick period
+/// \return time in nanoseconds
+static uint64_t ClockGetElapsed (void) {
+  uint64_t now = ClockGetTime();
+
+  return ((now > Tick_Period) ? (now - Tick_Period) : 0U);
+}
+
+/// Update SystemCoreClock variable (fixed on host)
+void SystemCoreClockUpdate (void) {
+}
+
+/// Setup OS Tick timer to generate periodic RTOS Kernel Ticks
+int32_t OS_Tick_Setup (uint32_t freq, IRQHandler_t handler) {
+
+  if ((freq == 0U) || (freq > SystemCoreClock)) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return (-1);
+  }
+
+  Tick_Interval = SystemCoreClock / freq;
+  Tick_Enabled  = 0U;
+
+  //lint -e{923} "cast from pointer to unsigned int"
+  NVIC_SetVector(SysTick_IRQn, (uintptr_t)handler);
+
+  return (NVIC_SetSignal(SysTick_IRQn, SIGALRM));
+}
+
+/// Start interval timer
+/// \param[in]  first           time to first expiry [ns]
+/// \param[in]  interval        reload interval [ns] (0 = one-shot)
+static void TimerStart (uint64_t first, uint64_t interval) {
+  struct itimerval timer;
+
+  // Round up to the timer resolution (zero would stop the timer)
+  first = (first + 999U) / 1000U;
+  if (first == 0U) {
+    first = 1U;
+  }
+  interval /= 1000U;
+
+  timer.it_value.tv_sec     = (time_t)(first / 1000000U);
+  timer.it_value.tv_usec    = (suseconds_t)(first % 1000000U);
+  timer.it_interval.tv_sec  = (time_t)(interval / 1000000U);
+  timer.it_interval.tv_usec = (suseconds_t)(interval % 1000000U);
+  (void)setitimer(ITIMER_REAL, &timer, NULL);
+}
+
+/// Enable OS Tick timer interrupt (continues the current tick period)
+void OS_Tick_Enable (void) {
+  uint64_t pending;
+  uint64_t period;
+  uint64_t now;
+
+  if (Tick_Enabled == 0U) {
+    Tick_Enabled = 1U;
+    now = ClockGetTime();
+    // Current period starts after the pending (not yet acknowledged) tick
+    pending = (Tick_Pending != 0U) ? Tick_Interval : 0U;
+    period  = Tick_Period + pending;
+    if ((Tick_Period == 0U) || (now < period) || ((now - period) >= Tick_Interval)) {
+      period = now;
+    }
+    Tick_Period = period - pending;
+    TimerStart((period + Tick_Interval) - now, Tick_Interval);
+    if (Tick_Pending != 0U) {
+      Tick_Pending = 0U;
+      NVIC_SetPendingIRQ(SysTick_IRQn);
+    }
+  }
+}
+
+/// Disable OS Tick timer interrupt
+void OS_Tick_Disable (void) {
+  struct itimerval timer = { { 0, 0 }, { 0, 0 } };
+
+  if (Tick_Enabled != 0U) {
+    Tick_Enabled = 0U;
+    (void)setitimer(ITIMER_REAL, &timer, NULL);
+    if (NVIC_GetPendingIRQ(SysTick_IRQn) != 0U) {
+      NVIC_ClearPendingIRQ(SysTick_IRQn);
+      Tick_Pending = 1U;
+    }
+  }
+}
+
+/// Acknowledge OS Tick timer interrupt: start next tick period
+void OS_Tick_AcknowledgeIRQ (void) {
+  uint64_t now = ClockGetTime();
+
+  Tick_Period += Tick_Interval;
+
+  // Resynchronize when timer signals were merged by the host
+  if ((now > Tick_Period) && ((now - Tick_Period) >= Tick_Interval)) {
+    Tick_Period = now - ((now - Tick_Period) % Tick_Interval);
+  }
+}
+
+/// Get OS Tick timer IRQ number
+int32_t OS_Tick_GetIRQn (void) {
+  return ((int32_t)SysTick_IRQn);
+}
+
+/// Get OS Tick timer clock frequency
+uint32_t OS_Tick_GetClock (void) {
+  return (SystemCoreClock);
+}
+
+/// Get OS Tick timer interval reload value
+uint32_t OS_Tick_GetInterval (void) {
+  return (Tick_Interval);
+}
+
+/// Get OS Tick timer counter value (counts up within the tick period)
+uint32_t OS_Tick_GetCount (void) {
+  return ((uint32_t)(ClockGetElapsed() % Tick_Interval));
+}
+
+/// Get OS Tick timer overflow status
+uint32_t OS_Tick_GetOverflow (void) {
+  return ((ClockGetElapsed() >= Tick_Interval) ? 1U : 0U);
+}
+
+/// Program OS Tick timer to expire after the specified number of ticks
+uint32_t OS_Tick_SleepEnter (uint32_t ticks) {
+  uint64_t expiry;
+  uint64_t now;
+
+  now    = ClockGetTime();
+  expiry = Tick_Period + ((uint64_t)ticks * Tick_Interval);
+  if (expiry <= now) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return 0U;
+  }
+
+  TimerStart(expiry - now, 0U);
+
+  return ticks;
+}
+
+/// Stop tickless sleep and realign the OS Tick period to the elapsed time
+uint32_t OS_Tick_SleepExit (void) {
+  struct itimerval timer = { { 0, 0 }, { 0, 0 } };
+  uint64_t ticks;
+
+  (void)setitimer(ITIMER_REAL, &timer, NULL);
+
+  // Expired tick periods are accounted here and not by the tick handler
+  NVIC_ClearPendingIRQ(SysTick_IRQn);
+  Tick_Pending = 0U;
+
+  ticks        = ClockGetElapsed() / Tick_Interval;
+  Tick_Period += ticks * Tick_Interval;
+
+  return ((ticks < 0xFFFFFFFFU) ? (uint32_t)ticks : 0xFFFFFFFEU);
+}
+
+/// Setup OS Tick timer compare interrupt (POSIX timer routed to interrupt 15)
+int32_t OS_Tick_CompareSetup (void (*handler) (void)) {
+  struct sigevent event;
+
+  (void)memset(&event, 0, sizeof(event));
+  event.sigev_notify = SIGEV_SIGNAL;
+  event.sigev_signo  = SIGRTMIN;
+  if (timer_create(CLOCK_MONOTONIC, &event, &Compare_Timer) != 0) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return (-1);
+  }
+
+  //lint -e{923} "cast from pointer to unsigned int"
+  NVIC_SetVector(COMPARE_IRQn, (uintptr_t)handler);
+  if (NVIC_SetSignal(COMPARE_IRQn, SIGRTMIN) != 0) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return (-1);
+  }
+  NVIC_EnableIRQ(COMPARE_IRQn);
+
+  return 0;
+}
+
+/// Program OS Tick timer compare interrupt after the specified number of counts
+void OS_Tick_CompareStart (uint32_t count) {
+  struct itimerspec timer = { { 0, 0 }, { 0, 0 } };
+
+  // Zero would stop the timer
+  if (count == 0U) {
+    count = 1U;
+  }
+
+  timer.it_value.tv_sec  = (time_t)(count / SystemCoreClock);
+  timer.it_value.tv_nsec = (long)(count % SystemCoreClock);
+  (void)timer_settime(Compare_Timer, 0, &timer, NULL);
+}
+
+/// Handle OS Tick interrupt (compare has a separate interrupt)
+int32_t OS_Tick_CompareIRQ (void) {
+  return 0;
+}
+
+/// Get OS Tick timer counts since the start of the tick period of the last Kernel Tick
+uint32_t OS_Tick_CompareGetCount (void) {
+  uint32_t count;
+
+  count = OS_Tick_GetCount();
+  if (OS_Tick_GetOverflow() != 0U) {
+    count = OS_Tick_GetCount() + OS_Tick_GetInterval();
+  }
+  return count;
+}
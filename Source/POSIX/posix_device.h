@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2013-2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-RTOS RTX
+ * Title:       POSIX Host device header
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef POSIX_DEVICE_H_
+#define POSIX_DEVICE_H_
+
+#include <stdint.h>
+#include "cmsis_compiler.h"
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+/// Interrupt Number Definition (exception number = IRQn + 16)
+typedef enum {
+  NonMaskableInt_IRQn   = -14,          ///< Non Maskable Interrupt (not used)
+  HardFault_IRQn        = -13,          ///< Hard Fault (not used)
+  SVCall_IRQn           =  -5,          ///< SV Call
+  PendSV_IRQn           =  -2,          ///< Pend SV
+  SysTick_IRQn          =  -1,          ///< System Tick (host interval timer)
+  Interrupt0_IRQn       =   0,          ///< Host interrupt 0
+  Interrupt1_IRQn       =   1,          ///< Host interrupt 1
+  Interrupt2_IRQn       =   2,          ///< Host interrupt 2
+  Interrupt3_IRQn       =   3,          ///< Host interrupt 3
+  Interrupt4_IRQn       =   4,          ///< Host interrupt 4
+  Interrupt5_IRQn       =   5,          ///< Host interrupt 5
+  Interrupt6_IRQn       =   6,          ///< Host interrupt 6
+  Interrupt7_IRQn       =   7,          ///< Host interrupt 7
+  Interrupt8_IRQn       =   8,          ///< Host interrupt 8
+  Interrupt9_IRQn       =   9,          ///< Host interrupt 9
+  Interrupt10_IRQn      =  10,          ///< Host interrupt 10
+  Interrupt11_IRQn      =  11,          ///< Host interrupt 11
+  Interrupt12_IRQn      =  12,          ///< Host interrupt 12
+  Interrupt13_IRQn      =  13,          ///< Host interrupt 13
+  Interrupt14_IRQn      =  14,          ///< Host interrupt 14
+  Interrupt15_IRQn      =  15           ///< Host interrupt 15 (OS Tick compare with High-Resolution Timers)
+} IRQn_Type;
+
+/// Interrupt Handler
+typedef void (*IRQ_Handler_t) (void);
+
+/// System Clock Frequency (nanosecond time base)
+extern uint32_t SystemCoreClock;
+
+/// Update SystemCoreClock variable (no operation on host)
+extern void SystemCoreClockUpdate (void);
+
+//  ==== Emulated NVIC functions ====
+
+/// Enable Interrupt
+/// \param[in]  IRQn            Device specific interrupt number
+extern void     NVIC_EnableIRQ       (IRQn_Type IRQn);
+
+/// Disable Interrupt
+/// \param[in]  IRQn            Device specific interrupt number
+extern void     NVIC_DisableIRQ      (IRQn_Type IRQn);
+
+/// Get Interrupt Enable status
+/// \param[in]  IRQn            Device specific interrupt number
+/// \return                     0=not enabled, 1=enabled
+extern uint32_t NVIC_GetEnableIRQ    (IRQn_Type IRQn);
+
+/// Set Pending Interrupt (system exceptions SysTick and PendSV are accepted)
+/// \param[in]  IRQn            Interrupt number
+extern void     NVIC_SetPendingIRQ   (IRQn_Type IRQn);
+
+/// Clear Pending Interrupt
+/// \param[in]  IRQn            Interrupt number
+extern void     NVIC_ClearPendingIRQ (IRQn_Type IRQn);
+
+/// Get Pending Interrupt
+/// \param[in]  IRQn            Interrupt number
+/// \return                     0=not pending, 1=pending
+extern uint32_t NVIC_GetPendingIRQ   (IRQn_Type IRQn);
+
+/// Set Interrupt Vector
+/// \param[in]  IRQn            Interrupt number
+/// \param[in]  vector          Address of interrupt handler function
+extern void      NVIC_SetVector      (IRQn_Type IRQn, uintptr_t vector);
+
+/// Get Interrupt Vector
+/// \param[in]  IRQn            Interrupt number
+/// \return                     Address of interrupt handler function
+extern uintptr_t NVIC_GetVector      (IRQn_Type IRQn);
+
+/// Route a POSIX signal to an interrupt
+/// \param[in]  IRQn            Interrupt number
+/// \param[in]  signo           Signal number (SIGALRM, SIGUSR1, SIGIO, ...)
+/// \return                     0 on success, -1 on error
+extern int32_t  NVIC_SetSignal       (IRQn_Type IRQn, int signo);
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif  // POSIX_DEVICE_H_
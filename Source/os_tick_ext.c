@@ -0,0 +1,357 @@
+/*
+ * Copyright (c) 2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-RTOS RTX
+ * Title:       OS Tick extension for SysTick (Tickless Idle, High-Resolution Timers)
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "rtx_lib.h"
+
+
+#ifdef SysTick
+
+// Default implementation for SysTick used as OS Tick timer:
+// SysTick is reprogrammed without waiting for the counter reload, which requires
+// SysTick to run with the processor clock (as set up by the CMSIS OS Tick for SysTick).
+// (other OS Tick timers and an external SysTick clock report the extensions as not supported)
+
+//  ==== OS Tick extension (High-Resolution Timers) ====
+
+// SysTick has no compare register, so the current tick period is split at the compare event:
+// SysTick is restarted to wrap at the compare event and the remaining counts of the tick period
+// are set as reload value, so the counter continues with them without being written again.
+// A compare event shortly before the Kernel Tick ends the tick period early instead and the
+// next tick period is extended by the remaining counts, which keeps the tick phase.
+#define TICK_PERIOD_NORMAL      0U      // Tick period with the tick interval
+#define TICK_PERIOD_SPLIT       1U      // Compare event within the tick period
+#define TICK_PERIOD_EARLY       2U      // Compare event ends the tick period early
+#define TICK_PERIOD_LONG        3U      // Tick period extended after an early end
+
+// Minimum SysTick counts until the compare event (covers reprogramming SysTick)
+#define TICK_COMPARE_MIN        64U
+
+static void   (*TickCompareHandler) (void);
+static uint32_t TickCompareInterval;    // Tick interval [counts]
+static uint32_t TickCompareMargin;      // Minimum counts from a split to the Kernel Tick
+static uint32_t TickCompareRemain;      // Counts from the compare event to the Kernel Tick
+static uint32_t TickCompareState;       // Tick period state
+
+/// Setup OS Tick timer compare interrupt.
+/// \param[in]  handler         compare interrupt handler.
+/// \return 0 on success, -1 when compare is not available (timers expire at the Kernel Tick).
+__WEAK int32_t OS_Tick_CompareSetup (void (*handler) (void)) {
+
+  // Check if SysTick is the OS Tick timer and runs with the processor clock
+  if ((osRtxInfo.tick_irqn != (int32_t)SysTick_IRQn) ||
+      ((SysTick->CTRL & SysTick_CTRL_CLKSOURCE_Msk) == 0U)) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return (-1);
+  }
+
+  TickCompareHandler  = handler;
+  TickCompareInterval = SysTick->LOAD + 1U;
+  TickCompareState    = TICK_PERIOD_NORMAL;
+
+  // The compare interrupt must be handled before the remaining counts of a split tick period
+  // have elapsed: closer compare events end the tick period early
+  TickCompareMargin = TickCompareInterval / 8U;
+  if (TickCompareMargin < TICK_COMPARE_MIN) {
+    TickCompareMargin = TICK_COMPARE_MIN;
+  }
+
+  return 0;
+}
+
+/// Program OS Tick timer compare interrupt after the specified number of counts.
+/// \note Called with interrupts disabled.
+/// \param[in]  count           number of OS Tick timer counts (1 = as soon as possible).
+__WEAK void OS_Tick_CompareStart (uint32_t count) {
+  uint32_t remain;
+  uint32_t state;
+  uint32_t load;
+  uint32_t val;
+
+  // SysTick is stopped or reprogrammed while the kernel is suspended
+  if ((TickCompareHandler == NULL) || (osRtxInfo.kernel.state == osRtxKernelSuspended) ||
+      ((SysTick->CTRL & SysTick_CTRL_ENABLE_Msk) == 0U)) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return;
+  }
+
+  if (count < TICK_COMPARE_MIN) {
+    count = TICK_COMPARE_MIN;
+  }
+
+  // Kernel Tick or an earlier compare event comes first
+  val = SysTick->VAL;
+  if (val <= (count + TICK_COMPARE_MIN)) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return;
+  }
+
+  // Pending SysTick interrupt (Kernel Tick or compare event) programs the compare
+  if ((SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) != 0U) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return;
+  }
+
+  // Counts from the compare event to the Kernel Tick
+  remain = val + 1U;
+  if ((TickCompareState == TICK_PERIOD_SPLIT) || (TickCompareState == TICK_PERIOD_EARLY)) {
+    remain += TickCompareRemain;
+  }
+  remain -= count;
+
+  if (remain >= TickCompareMargin) {
+    state = TICK_PERIOD_SPLIT;
+    load  = remain - 1U;
+  } else {
+    state = TICK_PERIOD_EARLY;
+    load  = (remain + TickCompareInterval) - 1U;
+    if (load > SysTick_LOAD_RELOAD_Msk) {
+      //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+      return;
+    }
+  }
+
+  // Restart SysTick: the counter is reloaded on the next processor clock (accounted in count),
+  // before the read back completes, and wraps at the compare event to the remaining counts
+  SysTick->LOAD = count - 2U;
+  SysTick->VAL  = 0U;
+  (void)SysTick->VAL;
+  SysTick->LOAD = load;
+
+  TickCompareRemain = remain;
+  TickCompareState  = state;
+}
+
+/// Handle OS Tick interrupt shared with the compare interrupt.
+/// \return 1 - compare event, 0 - Kernel Tick (after an early compare event).
+__WEAK int32_t OS_Tick_CompareIRQ (void) {
+  uint32_t primask;
+  uint32_t state;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  state = TickCompareState;
+  if ((state == TICK_PERIOD_SPLIT) || (state == TICK_PERIOD_EARLY)) {
+    // Counter continues with the remaining counts, next tick periods use the tick interval
+    SysTick->LOAD    = TickCompareInterval - 1U;
+    TickCompareState = (state == TICK_PERIOD_EARLY) ? TICK_PERIOD_LONG : TICK_PERIOD_NORMAL;
+  } else {
+    TickCompareState = TICK_PERIOD_NORMAL;
+  }
+
+  if (primask == 0U) {
+    __enable_irq();
+  }
+
+  if ((state == TICK_PERIOD_SPLIT) || (state == TICK_PERIOD_EARLY)) {
+    TickCompareHandler();
+  }
+
+  return ((state == TICK_PERIOD_SPLIT) ? 1 : 0);
+}
+
+/// Get OS Tick timer counts since the start of the tick period of the last Kernel Tick.
+/// \note Called with interrupts disabled.
+/// \return OS Tick timer counts (including the tick interval of a pending Kernel Tick).
+__WEAK uint32_t OS_Tick_CompareGetCount (void) {
+  uint32_t count;
+  uint32_t val;
+
+  // Other OS Tick timers
+  if (TickCompareHandler == NULL) {
+    count = OS_Tick_GetCount();
+    if (OS_Tick_GetOverflow() != 0U) {
+      count = OS_Tick_GetCount() + OS_Tick_GetInterval();
+    }
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return count;
+  }
+
+  val = SysTick->VAL;
+  if ((SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) != 0U) {
+    val = SysTick->VAL;
+    // Compare event continues the tick period, Kernel Tick (also early) starts the next one
+    count = (TickCompareState == TICK_PERIOD_SPLIT) ? 0U : TickCompareInterval;
+  } else if ((TickCompareState == TICK_PERIOD_SPLIT) || (TickCompareState == TICK_PERIOD_EARLY)) {
+    // Remaining counts of the tick period follow the compare event
+    count = 0U - TickCompareRemain;
+  } else {
+    // Extended tick period starts before the end of the tick period counted by the kernel
+    count = 0U;
+  }
+  count += (TickCompareInterval - 1U) - val;
+
+  return count;
+}
+
+
+//  ==== OS Tick extension (Tickless Idle) ====
+
+static uint32_t TickSleepInterval;      // Tick interval [counts]
+static uint32_t TickSleepStart;         // Counts remaining in tick period at sleep entry
+static uint32_t TickSleepCount;         // Programmed sleep period [counts]
+
+/// Program OS Tick timer to expire after the specified number of ticks.
+/// \param[in]  ticks           number of ticks (including the current tick period).
+/// \return number of ticks programmed (0 = tickless sleep not possible).
+__WEAK uint32_t OS_Tick_SleepEnter (uint32_t ticks) {
+  uint32_t interval;
+  uint32_t start;
+  uint32_t max;
+
+  // Check if SysTick is the OS Tick timer and runs with the processor clock
+  if ((osRtxInfo.tick_irqn != (int32_t)SysTick_IRQn) ||
+      ((SysTick->CTRL & SysTick_CTRL_CLKSOURCE_Msk) == 0U)) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return 0U;
+  }
+
+  // Tick period is split by a pending High-Resolution Timer compare
+  if (TickCompareState != TICK_PERIOD_NORMAL) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return 0U;
+  }
+
+  // SysTick is stopped by OS_Tick_Disable
+  interval = SysTick->LOAD + 1U;
+  start    = SysTick->VAL;
+  if ((start == 0U) || (start > interval)) {
+    start = interval;
+  }
+
+  // Limit to the 24-bit reload range
+  max = ((SysTick_LOAD_RELOAD_Msk - start) / interval) + 1U;
+  if (ticks > max) {
+    ticks = max;
+  }
+
+  TickSleepInterval = interval;
+  TickSleepStart    = start;
+  TickSleepCount    = start + ((ticks - 1U) * interval);
+
+  SysTick->LOAD  = TickSleepCount - 1U;
+  SysTick->VAL   = 0U;
+  SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+
+  return ticks;
+}
+
+/// Stop tickless sleep and realign the OS Tick period to the elapsed time.
+/// \return number of complete ticks elapsed since sleep entry.
+__WEAK uint32_t OS_Tick_SleepExit (void) {
+  uint32_t interval;
+  uint32_t elapsed;
+  uint32_t ticks;
+  uint32_t ctrl;
+  uint32_t val;
+
+  val  = SysTick->VAL;
+  ctrl = SysTick->CTRL;
+  SysTick->CTRL = ctrl & ~SysTick_CTRL_ENABLE_Msk;
+
+  interval = TickSleepInterval;
+  elapsed  = (TickSleepCount - 1U) - val;
+  if (((ctrl & SysTick_CTRL_COUNTFLAG_Msk) != 0U) ||
+      ((SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) != 0U)) {
+    // Sleep period expired: tick interrupt is accounted here
+    SCB->ICSR = SCB_ICSR_PENDSTCLR_Msk;
+    elapsed  += TickSleepCount;
+  }
+  // Include the part of the tick period before sleep entry
+  elapsed += interval - TickSleepStart;
+
+  ticks   = elapsed / interval;
+  elapsed = interval - (elapsed % interval);
+  if (elapsed < 4U) {
+    ticks++;
+    elapsed = interval;
+  }
+
+  // Shorten the next tick period by the elapsed sub-tick time: the counter is
+  // reloaded on the next processor clock, before the read back completes
+  SysTick->LOAD  = elapsed - 1U;
+  SysTick->VAL   = 0U;
+  SysTick->CTRL  = ctrl | SysTick_CTRL_ENABLE_Msk;
+  (void)SysTick->VAL;
+  SysTick->CTRL  = ctrl & ~SysTick_CTRL_ENABLE_Msk;
+  SysTick->LOAD  = interval - 1U;
+
+  return ticks;
+}
+
+#else
+
+//  ==== OS Tick extension (High-Resolution Timers) ====
+
+/// Setup OS Tick timer compare interrupt.
+/// \param[in]  handler         compare interrupt handler.
+/// \return 0 on success, -1 when compare is not available (timers expire at the Kernel Tick).
+__WEAK int32_t OS_Tick_CompareSetup (void (*handler) (void)) {
+  (void)handler;
+  return (-1);
+}
+
+/// Program OS Tick timer compare interrupt after the specified number of counts.
+/// \param[in]  count           number of OS Tick timer counts (1 = as soon as possible).
+__WEAK void OS_Tick_CompareStart (uint32_t count) {
+  (void)count;
+}
+
+/// Handle OS Tick interrupt shared with the compare interrupt.
+/// \return 1 - compare event, 0 - Kernel Tick.
+__WEAK int32_t OS_Tick_CompareIRQ (void) {
+  return 0;
+}
+
+/// Get OS Tick timer counts since the start of the tick period of the last Kernel Tick.
+/// \return OS Tick timer counts (including the tick interval of a pending Kernel Tick).
+__WEAK uint32_t OS_Tick_CompareGetCount (void) {
+  uint32_t count;
+
+  count = OS_Tick_GetCount();
+  if (OS_Tick_GetOverflow() != 0U) {
+    count = OS_Tick_GetCount() + OS_Tick_GetInterval();
+  }
+  return count;
+}
+
+
+//  ==== OS Tick extension (Tickless Idle) ====
+
+/// Program OS Tick timer to expire after the specified number of ticks.
+/// \param[in]  ticks           number of ticks (including the current tick period).
+/// \return number of ticks programmed (0 = tickless sleep not possible).
+__WEAK uint32_t OS_Tick_SleepEnter (uint32_t ticks) {
+  (void)ticks;
+  return 0U;
+}
+
+/// Stop tickless sleep and realign the OS Tick period to the elapsed time.
+/// \return number of complete ticks elapsed since sleep entry.
+__WEAK uint32_t OS_Tick_SleepExit (void) {
+  return 0U;
+}
+
+#endif
@@ -38,12 +38,20 @@
      (!defined(__ARM_ARCH_7EM__))       && \
      (!defined(__ARM_ARCH_8M_BASE__))   && \
      (!defined(__ARM_ARCH_8M_MAIN__))   && \
-     (!defined(__ARM_ARCH_8_1M_MAIN__)))
+     (!defined(__ARM_ARCH_8_1M_MAIN__)) && \
+     (!defined(__unix__)))
 #error "Unknown Arm Architecture!"
 #endif
 
 #if   (defined(__ARM_ARCH_7A__) && (__ARM_ARCH_7A__ != 0))
 #include "rtx_core_ca.h"
+#elif ((!defined(__ARM_ARCH_6M__))        && \
+       (!defined(__ARM_ARCH_7M__))        && \
+       (!defined(__ARM_ARCH_7EM__))       && \
+       (!defined(__ARM_ARCH_8M_BASE__))   && \
+       (!defined(__ARM_ARCH_8M_MAIN__))   && \
+       (!defined(__ARM_ARCH_8_1M_MAIN__)))
+#include "rtx_core_posix.h"
 #else
 #include "rtx_core_cm.h"
 #endif
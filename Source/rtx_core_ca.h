@@ -183,6 +183,19 @@ __STATIC_INLINE bool_t IsIrqMasked (void) {
   return  FALSE;
 }
 
+/// Count leading zero bits
+/// \param[in]  value           value to evaluate
+/// \return                     number of leading zero bits (32 for value 0)
+__STATIC_INLINE uint8_t CountLeadingZeros (uint32_t value) {
+  return __CLZ(value);
+}
+
+/// Get processor core number
+/// \return     core number (MPIDR affinity level 0)
+__STATIC_INLINE uint32_t GetCoreId (void) {
+  return (__get_MPIDR() & 0xFFU);
+}
+
 
 //  ==== Core Peripherals functions ====
 
@@ -911,6 +924,86 @@ __STATIC_INLINE void atomic_link_put (void **root, void *link) {
   );
 }
 
+/// Atomic Access Operation: Write Pointer if NULL
+/// \param[in]  mem             Memory address
+/// \param[in]  ptr             Pointer to write
+/// \return                     Previous value (NULL when written)
+__STATIC_INLINE void *atomic_ptr_set (void **mem, void *ptr) {
+#ifdef  __ICCARM__
+#pragma diag_suppress=Pe550
+#endif
+  register uint32_t res;
+#ifdef  __ICCARM__
+#pragma diag_default=Pe550
+#endif
+  register void    *ret;
+
+  __ASM volatile (
+#ifndef __ICCARM__
+  ".syntax unified\n\t"
+#endif
+  "1:\n\t"
+    "ldrex %[ret],[%[mem]]\n\t"
+    "cmp   %[ret],#0\n\t"
+    "beq   2f\n\t"
+    "clrex\n\t"
+    "b     3f\n"
+  "2:\n\t"
+    "strex %[res],%[ptr],[%[mem]]\n\t"
+    "cmp   %[res],#0\n\t"
+    "bne   1b\n"
+  "3:"
+  : [ret] "=&l" (ret),
+    [res] "=&l" (res)
+  : [mem] "l"   (mem),
+    [ptr] "l"   (ptr)
+  : "cc", "memory"
+  );
+
+  return ret;
+}
+
+/// Atomic Access Operation: Compare and Swap Pointer
+/// \param[in]  mem             Memory address
+/// \param[in]  cmp             Expected pointer
+/// \param[in]  ptr             Pointer to write
+/// \return                     Previous value (cmp when written)
+__STATIC_INLINE void *atomic_ptr_cas (void **mem, void *cmp, void *ptr) {
+#ifdef  __ICCARM__
+#pragma diag_suppress=Pe550
+#endif
+  register uint32_t res;
+#ifdef  __ICCARM__
+#pragma diag_default=Pe550
+#endif
+  register void    *ret;
+
+  __ASM volatile (
+#ifndef __ICCARM__
+  ".syntax unified\n\t"
+#endif
+  "1:\n\t"
+    "ldrex %[ret],[%[mem]]\n\t"
+    "cmp   %[ret],%[cmp]\n\t"
+    "beq   2f\n\t"
+    "clrex\n\t"
+    "b     3f\n"
+  "2:\n\t"
+    "strex %[res],%[ptr],[%[mem]]\n\t"
+    "cmp   %[res],#0\n\t"
+    "bne   1b\n"
+  "3:"
+  : [ret] "=&l" (ret),
+    [res] "=&l" (res)
+  : [mem] "l"   (mem),
+    [cmp] "l"   (cmp),
+    [ptr] "l"   (ptr)
+  : "cc", "memory"
+  );
+
+  return ret;
+}
+
 //lint --flb "Library End" [MISRA Note 12]
 
 #endif  // (EXCLUSIVE_ACCESS == 1)
@@ -163,6 +163,54 @@ __STATIC_INLINE bool_t IsIrqMasked (void) {
 #endif
 }
 
+/// Count leading zero bits
+/// \param[in]  value           value to evaluate
+/// \return                     number of leading zero bits (32 for value 0)
+__STATIC_INLINE uint8_t CountLeadingZeros (uint32_t value) {
+#if   ((defined(__ARM_ARCH_7M__)        && (__ARM_ARCH_7M__        != 0)) || \
+       (defined(__ARM_ARCH_7EM__)       && (__ARM_ARCH_7EM__       != 0)) || \
+       (defined(__ARM_ARCH_8M_MAIN__)   && (__ARM_ARCH_8M_MAIN__   != 0)) || \
+       (defined(__ARM_ARCH_8_1M_MAIN__) && (__ARM_ARCH_8_1M_MAIN__ != 0)))
+  return __CLZ(value);
+#else
+  // Armv6-M and Armv8-M Baseline have no CLZ instruction
+  uint32_t val = value;
+  uint8_t  n;
+
+  if (val == 0U) {
+    n = 32U;
+  } else {
+    n = 0U;
+    if ((val & 0xFFFF0000U) == 0U) {
+      n += 16U;
+      val <<= 16;
+    }
+    if ((val & 0xFF000000U) == 0U) {
+      n +=  8U;
+      val <<=  8;
+    }
+    if ((val & 0xF0000000U) == 0U) {
+      n +=  4U;
+      val <<=  4;
+    }
+    if ((val & 0xC0000000U) == 0U) {
+      n +=  2U;
+      val <<=  2;
+    }
+    if ((val & 0x80000000U) == 0U) {
+      n +=  1U;
+    }
+  }
+  return n;
+#endif
+}
+
+/// Get processor core number (single core)
+/// \return     core number
+__STATIC_INLINE uint32_t GetCoreId (void) {
+  return 0U;
+}
+
 
 //  ==== Core Peripherals functions ====
 
@@ -1000,6 +1048,85 @@ __STATIC_INLINE void atomic_link_put (void **root, void *link) {
   );
 }
 
+/// Atomic Access Operation: Write Pointer if NULL
+/// \param[in]  mem             Memory address
+/// \param[in]  ptr             Pointer to write
+/// \return                     Previous value (NULL when written)
+__STATIC_INLINE void *atomic_ptr_set (void **mem, void *ptr) {
+#ifdef  __ICCARM__
+#pragma diag_suppress=Pe550
+#endif
+  register uint32_t res;
+#ifdef  __ICCARM__
+#pragma diag_default=Pe550
+#endif
+  register void    *ret;
+
+  __ASM volatile (
+#ifndef __ICCARM__
+  ".syntax unified\n\t"
+#endif
+  "1:\n\t"
+    "ldrex %[ret],[%[mem]]\n\t"
+    "cbz   %[ret],2f\n\t"
+    "clrex\n\t"
+    "b     3f\n"
+  "2:\n\t"
+    "strex %[res],%[ptr],[%[mem]]\n\t"
+    "cbz   %[res],3f\n\t"
+    "b     1b\n"
+  "3:"
+  : [ret] "=&l" (ret),
+    [res] "=&l" (res)
+  : [mem] "l"   (mem),
+    [ptr] "l"   (ptr)
+  : "cc", "memory"
+  );
+
+  return ret;
+}
+
+/// Atomic Access Operation: Compare and Swap Pointer
+/// \param[in]  mem             Memory address
+/// \param[in]  cmp             Expected pointer
+/// \param[in]  ptr             Pointer to write
+/// \return                     Previous value (cmp when written)
+__STATIC_INLINE void *atomic_ptr_cas (void **mem, void *cmp, void *ptr) {
+#ifdef  __ICCARM__
+#pragma diag_suppress=Pe550
+#endif
+  register uint32_t res;
+#ifdef  __ICCARM__
+#pragma diag_default=Pe550
+#endif
+  register void    *ret;
+
+  __ASM volatile (
+#ifndef __ICCARM__
+  ".syntax unified\n\t"
+#endif
+  "1:\n\t"
+    "ldrex %[ret],[%[mem]]\n\t"
+    "cmp   %[ret],%[cmp]\n\t"
+    "beq   2f\n\t"
+    "clrex\n\t"
+    "b     3f\n"
+  "2:\n\t"
+    "strex %[res],%[ptr],[%[mem]]\n\t"
+    "cbz   %[res],3f\n\t"
+    "b     1b\n"
+  "3:"
+  : [ret] "=&l" (ret),
+    [res] "=&l" (res)
+  : [mem] "l"   (mem),
+    [cmp] "l"   (cmp),
+    [ptr] "l"   (ptr)
+  : "cc", "memory"
+  );
+
+  return ret;
+}
+
 //lint --flb "Library End" [MISRA Note 12]
 
 #endif  // (EXCLUSIVE_ACCESS == 1)
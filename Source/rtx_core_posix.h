@@ -0,0 +1,482 @@
+/*
+ * Copyright (c) 2013-2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-RTOS RTX
+ * Title:       POSIX Host Core definitions
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef RTX_CORE_POSIX_H_
+#define RTX_CORE_POSIX_H_
+
+#ifndef RTX_CORE_C_H_
+#ifndef RTE_COMPONENTS_H
+#include "RTE_Components.h"
+#endif
+#include CMSIS_device_header
+#endif
+
+#include <stdbool.h>
+typedef bool bool_t;
+
+#ifndef FALSE
+#define FALSE                   ((bool_t)0)
+#endif
+
+#ifndef TRUE
+#define TRUE                    ((bool_t)1)
+#endif
+
+#if defined(RTX_TZ_CONTEXT)
+#error "TrustZone is not supported on POSIX Host!"
+#endif
+
+#define EXCLUSIVE_ACCESS        1
+
+#define OS_TICK_HANDLER         SysTick_Handler
+
+/// xPSR_Initialization Value (not used on POSIX Host)
+/// \param[in]  privileged      true=privileged, false=unprivileged
+/// \param[in]  thumb           true=Thumb, false=ARM
+/// \return                     xPSR Init Value
+__STATIC_INLINE uint32_t xPSR_InitVal (bool_t privileged, bool_t thumb) {
+  (void)privileged;
+  (void)thumb;
+  return (0x01000000U);
+}
+
+// Stack Frame (at top of thread stack, host execution stack is below):
+//  - Basic: R4-R11, R0-R3, R12, LR, PC, xPSR
+//    R4-R5 hold the host context pointer of a suspended thread,
+//    R0-R3 hold service call arguments and return value,
+//    R0, R1 and PC hold the thread startup argument, function and entry.
+
+/// Stack Frame Initialization Value
+#define STACK_FRAME_INIT_VAL    0x00U
+
+/// Stack Offset of Register R0
+/// \param[in]  stack_frame     Stack Frame
+/// \return                     R0 Offset
+__STATIC_INLINE uint32_t StackOffsetR0 (uint8_t stack_frame) {
+  (void)stack_frame;
+  return (8U*(uint32_t)sizeof(uintptr_t));
+}
+
+
+//  ==== Emulated Cortex-M functions ====
+
+/// Get PSP Register - emulate with the host stack pointer
+/// \return     PSP Register value
+__STATIC_INLINE uintptr_t __get_PSP (void) {
+  //lint -e{923} "cast from pointer to unsigned int"
+  return ((uintptr_t)__builtin_frame_address(0));
+}
+
+
+//  ==== Core functions ====
+
+/// Check if running Privileged
+/// \return     true=privileged, false=unprivileged
+__STATIC_INLINE bool_t IsPrivileged (void) {
+  return ((__get_CONTROL() & 1U) == 0U);
+}
+
+/// Set thread Privileged mode (not needed on POSIX Host)
+/// \param[in]  privileged      true=privileged, false=unprivileged
+__STATIC_INLINE void SetPrivileged (bool_t privileged) {
+  (void)privileged;
+}
+
+/// Check if in Exception
+/// \return     true=exception, false=thread
+__STATIC_INLINE bool_t IsException (void) {
+  return (__get_IPSR() != 0U);
+}
+
+/// Check if in Fault
+/// \return     true, false
+__STATIC_INLINE bool_t IsFault (void) {
+  uint32_t ipsr = __get_IPSR();
+  return (((int32_t)ipsr < ((int32_t)SVCall_IRQn + 16)) &&
+          ((int32_t)ipsr > ((int32_t)NonMaskableInt_IRQn + 16)));
+}
+
+/// Check if in SVCall IRQ
+/// \return     true, false
+__STATIC_INLINE bool_t IsSVCallIrq (void) {
+  return ((int32_t)__get_IPSR() == ((int32_t)SVCall_IRQn + 16));
+}
+
+/// Check if in PendSV IRQ
+/// \return     true, false
+__STATIC_INLINE bool_t IsPendSvIrq (void) {
+  return ((int32_t)__get_IPSR() == ((int32_t)PendSV_IRQn + 16));
+}
+
+/// Check if in Tick Timer IRQ
+/// \return     true, false
+__STATIC_INLINE bool_t IsTickIrq (int32_t tick_irqn) {
+  return ((int32_t)__get_IPSR() == (tick_irqn + 16));
+}
+
+/// Check if IRQ is Masked
+/// \return     true=masked, false=not masked
+__STATIC_INLINE bool_t IsIrqMasked (void) {
+  return (__get_PRIMASK() != 0U);
+}
+
+/// Count leading zero bits
+/// \param[in]  value           value to evaluate
+/// \return                     number of leading zero bits (32 for value 0)
+__STATIC_INLINE uint8_t CountLeadingZeros (uint32_t value) {
+  return __CLZ(value);
+}
+
+/// Get processor core number (single emulated core)
+/// \return     core number
+__STATIC_INLINE uint32_t GetCoreId (void) {
+  return 0U;
+}
+
+
+//  ==== Core Peripherals functions ====
+
+/// Setup SVC and PendSV System Service Calls (not needed on POSIX Host)
+__STATIC_INLINE void SVC_Setup (void) {
+}
+
+/// Get Pending SV (Service Call) Flag
+/// \return     Pending SV Flag
+__STATIC_INLINE uint8_t GetPendSV (void) {
+  return ((uint8_t)NVIC_GetPendingIRQ(PendSV_IRQn));
+}
+
+/// Clear Pending SV (Service Call) Flag
+__STATIC_INLINE void ClrPendSV (void) {
+  NVIC_ClearPendingIRQ(PendSV_IRQn);
+}
+
+/// Set Pending SV (Service Call) Flag
+__STATIC_INLINE void SetPendSV (void) {
+  NVIC_SetPendingIRQ(PendSV_IRQn);
+}
+
+
+//  ==== Service Calls definitions ====
+
+// Service calls are executed as direct function calls framed by SVC_Enter
+// and SVC_Exit (irq_posix.c), which emulate the SVCall exception entry and
+// exit. Arguments and return value are mirrored in the R0..R3 frame of the
+// running thread, since the kernel accesses them in waiting threads.
+
+/// Enter SVCall exception
+/// \return     pointer to registers R0-R3 of running thread or NULL.
+extern uintptr_t *SVC_Enter (void);
+
+/// Exit SVCall exception: switch thread and serve pending exceptions
+/// \return     true=running thread was switched, false=not switched
+extern bool_t    SVC_Exit  (void);
+
+//lint -save -e9023 -e9024 -e9026 "Function-like macros using '#/##'" [MISRA Note 10]
+
+#if defined(RTX_SVC_PTR_CHECK)
+#warning "SVC Function Pointer checking is not supported!"
+#endif
+
+#define SVC_ArgN                                                               \
+  uintptr_t *__reg = SVC_Enter()
+
+#define SVC_ArgR(n,a)                                                          \
+  if (__reg != NULL) { __reg[n] = (uintptr_t)(a); }
+
+#define SVC_Call0(t,r)                                                         \
+  if (__reg != NULL) { __reg[0] = (uintptr_t)(r); }                            \
+  if (SVC_Exit() && (__reg != NULL)) { r = (t)__reg[0]; }
+
+#define SVC_Call0N                                                             \
+  (void)SVC_Exit();                                                            \
+  (void)__reg
+
+#define SVC0_0N(f,t)                                                           \
+__STATIC_INLINE t __svc##f (void) {                                            \
+  SVC_ArgN;                                                                    \
+  svcRtx##f();                                                                 \
+  SVC_Call0N;                                                                  \
+}
+
+#define SVC0_0(f,t)                                                            \
+__STATIC_INLINE t __svc##f (void) {                                            \
+  SVC_ArgN;                                                                    \
+  t __r0 = svcRtx##f();                                                        \
+  SVC_Call0(t, __r0);                                                          \
+  return __r0;                                                                 \
+}
+
+#define SVC0_1N(f,t,t1)                                                        \
+__STATIC_INLINE t __svc##f (t1 a1) {                                           \
+  SVC_ArgN;                                                                    \
+  SVC_ArgR(0,a1);                                                              \
+  svcRtx##f(a1);                                                               \
+  SVC_Call0N;                                                                  \
+}
+
+#define SVC0_1(f,t,t1)                                                         \
+__STATIC_INLINE t __svc##f (t1 a1) {                                           \
+  SVC_ArgN;                                                                    \
+  SVC_ArgR(0,a1);                                                              \
+  t __r0 = svcRtx##f(a1);                                                      \
+  SVC_Call0(t, __r0);                                                          \
+  return __r0;                                                                 \
+}
+
+#define SVC0_2(f,t,t1,t2)                                                      \
+__STATIC_INLINE t __svc##f (t1 a1, t2 a2) {                                    \
+  SVC_ArgN;                                                                    \
+  SVC_ArgR(0,a1);                                                              \
+  SVC_ArgR(1,a2);                                                              \
+  t __r0 = svcRtx##f(a1,a2);                                                   \
+  SVC_Call0(t, __r0);                                                          \
+  return __r0;                                                                 \
+}
+
+#define SVC0_3(f,t,t1,t2,t3)                                                   \
+__STATIC_INLINE t __svc##f (t1 a1, t2 a2, t3 a3) {                             \
+  SVC_ArgN;                                                                    \
+  SVC_ArgR(0,a1);                                                              \
+  SVC_ArgR(1,a2);                                                              \
+  SVC_ArgR(2,a3);                                                              \
+  t __r0 = svcRtx##f(a1,a2,a3);                                                \
+  SVC_Call0(t, __r0);                                                          \
+  return __r0;                                                                 \
+}
+
+#define SVC0_4(f,t,t1,t2,t3,t4)                                                \
+__STATIC_INLINE t __svc##f (t1 a1, t2 a2, t3 a3, t4 a4) {                      \
+  SVC_ArgN;                                                                    \
+  SVC_ArgR(0,a1);                                                              \
+  SVC_ArgR(1,a2);                                                              \
+  SVC_ArgR(2,a3);                                                              \
+  SVC_ArgR(3,a4);                                                              \
+  t __r0 = svcRtx##f(a1,a2,a3,a4);                                             \
+  SVC_Call0(t, __r0);                                                          \
+  return __r0;                                                                 \
+}
+
+//lint -restore [MISRA Note 10]
+
+
+//  ==== Exclusive Access Operation ====
+
+#if (EXCLUSIVE_ACCESS == 1)
+
+//lint ++flb "Library Begin" [MISRA Note 12]
+
+/// Atomic Access Operation: Write (8-bit)
+/// \param[in]  mem             Memory address
+/// \param[in]  val             Value to write
+/// \return                     Previous value
+__STATIC_INLINE uint8_t atomic_wr8 (uint8_t *mem, uint8_t val) {
+  return __atomic_exchange_n(mem, val, __ATOMIC_SEQ_CST);
+}
+
+/// Atomic Access Operation: Set bits (32-bit)
+/// \param[in]  mem             Memory address
+/// \param[in]  bits            Bit mask
+/// \return                     New value
+__STATIC_INLINE uint32_t atomic_set32 (uint32_t *mem, uint32_t bits) {
+  return __atomic_or_fetch(mem, bits, __ATOMIC_SEQ_CST);
+}
+
+/// Atomic Access Operation: Clear bits (32-bit)
+/// \param[in]  mem             Memory address
+/// \param[in]  bits            Bit mask
+/// \return                     Previous value
+__STATIC_INLINE uint32_t atomic_clr32 (uint32_t *mem, uint32_t bits) {
+  return __atomic_fetch_and(mem, ~bits, __ATOMIC_SEQ_CST);
+}
+
+/// Atomic Access Operation: Check if all specified bits (32-bit) are active and clear them
+/// \param[in]  mem             Memory address
+/// \param[in]  bits            Bit mask
+/// \return                     Active bits before clearing or 0 if not active
+__STATIC_INLINE uint32_t atomic_chk32_all (uint32_t *mem, uint32_t bits) {
+  uint32_t val = __atomic_load_n(mem, __ATOMIC_SEQ_CST);
+
+  do {
+    if ((val & bits) != bits) {
+      return 0U;
+    }
+  } while (!__atomic_compare_exchange_n(mem, &val, val & ~bits, false,
+                                        __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST));
+  return val;
+}
+
+/// Atomic Access Operation: Check if any specified bits (32-bit) are active and clear them
+/// \param[in]  mem             Memory address
+/// \param[in]  bits            Bit mask
+/// \return                     Active bits before clearing or 0 if not active
+__STATIC_INLINE uint32_t atomic_chk32_any (uint32_t *mem, uint32_t bits) {
+  uint32_t val = __atomic_load_n(mem, __ATOMIC_SEQ_CST);
+
+  do {
+    if ((val & bits) == 0U) {
+      return 0U;
+    }
+  } while (!__atomic_compare_exchange_n(mem, &val, val & ~bits, false,
+                                        __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST));
+  return val;
+}
+
+/// Atomic Access Operation: Increment (32-bit)
+/// \param[in]  mem             Memory address
+/// \return                     Previous value
+__STATIC_INLINE uint32_t atomic_inc32 (uint32_t *mem) {
+  return __atomic_fetch_add(mem, 1U, __ATOMIC_SEQ_CST);
+}
+
+/// Atomic Access Operation: Increment (16-bit) if Less Than
+/// \param[in]  mem             Memory address
+/// \param[in]  max             Maximum value
+/// \return                     Previous value
+__STATIC_INLINE uint16_t atomic_inc16_lt (uint16_t *mem, uint16_t max) {
+  uint16_t val = __atomic_load_n(mem, __ATOMIC_SEQ_CST);
+
+  do {
+    if (val >= max) {
+      break;
+    }
+  } while (!__atomic_compare_exchange_n(mem, &val, (uint16_t)(val + 1U), false,
+                                        __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST));
+  return val;
+}
+
+/// Atomic Access Operation: Increment (16-bit) and clear on Limit
+/// \param[in]  mem             Memory address
+/// \param[in]  max             Maximum value
+/// \return                     Previous value
+__STATIC_INLINE uint16_t atomic_inc16_lim (uint16_t *mem, uint16_t lim) {
+  uint16_t val = __atomic_load_n(mem, __ATOMIC_SEQ_CST);
+  uint16_t new_val;
+
+  do {
+    new_val = (uint16_t)(val + 1U);
+    if (new_val >= lim) {
+      new_val = 0U;
+    }
+  } while (!__atomic_compare_exchange_n(mem, &val, new_val, false,
+                                        __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST));
+  return val;
+}
+
+/// Atomic Access Operation: Decrement (32-bit)
+/// \param[in]  mem             Memory address
+/// \return                     Previous value
+__STATIC_INLINE uint32_t atomic_dec32 (uint32_t *mem) {
+  return __atomic_fetch_sub(mem, 1U, __ATOMIC_SEQ_CST);
+}
+
+/// Atomic Access Operation: Decrement (32-bit) if Not Zero
+/// \param[in]  mem             Memory address
+/// \return                     Previous value
+__STATIC_INLINE uint32_t atomic_dec32_nz (uint32_t *mem) {
+  uint32_t val = __atomic_load_n(mem, __ATOMIC_SEQ_CST);
+
+  do {
+    if (val == 0U) {
+      break;
+    }
+  } while (!__atomic_compare_exchange_n(mem, &val, val - 1U, false,
+                                        __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST));
+  return val;
+}
+
+/// Atomic Access Operation: Decrement (16-bit) if Not Zero
+/// \param[in]  mem             Memory address
+/// \return                     Previous value
+__STATIC_INLINE uint16_t atomic_dec16_nz (uint16_t *mem) {
+  uint16_t val = __atomic_load_n(mem, __ATOMIC_SEQ_CST);
+
+  do {
+    if (val == 0U) {
+      break;
+    }
+  } while (!__atomic_compare_exchange_n(mem, &val, (uint16_t)(val - 1U), false,
+                                        __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST));
+  return val;
+}
+
+/// Atomic Access Operation: Link Get
+/// \param[in]  root            Root address
+/// \return                     Link
+__STATIC_INLINE void *atomic_link_get (void **root) {
+  void *ret = __atomic_load_n(root, __ATOMIC_SEQ_CST);
+
+  do {
+    if (ret == NULL) {
+      break;
+    }
+  } while (!__atomic_compare_exchange_n(root, &ret, *((void **)ret), false,
+                                        __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST));
+  return ret;
+}
+
+/// Atomic Access Operation: Link Put
+/// \param[in]  root            Root address
+/// \param[in]  lnk             Link
+__STATIC_INLINE void atomic_link_put (void **root, void *link) {
+  void *val = __atomic_load_n(root, __ATOMIC_SEQ_CST);
+
+  do {
+    *((void **)link) = val;
+  } while (!__atomic_compare_exchange_n(root, &val, link, false,
+                                        __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST));
+}
+
+/// Atomic Access Operation: Write Pointer if NULL
+/// \param[in]  mem             Memory address
+/// \param[in]  ptr             Pointer to write
+/// \return                     Previous value (NULL when written)
+__STATIC_INLINE void *atomic_ptr_set (void **mem, void *ptr) {
+  void *ret = NULL;
+
+  (void)__atomic_compare_exchange_n(mem, &ret, ptr, false,
+                                    __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+  return ret;
+}
+
+/// Atomic Access Operation: Compare and Swap Pointer
+/// \param[in]  mem             Memory address
+/// \param[in]  cmp             Expected pointer
+/// \param[in]  ptr             Pointer to write
+/// \return                     Previous value (cmp when written)
+__STATIC_INLINE void *atomic_ptr_cas (void **mem, void *cmp, void *ptr) {
+  void *ret = cmp;
+
+  (void)__atomic_compare_exchange_n(mem, &ret, ptr, false,
+                                    __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+  return ret;
+}
+
+//lint --flb "Library End" [MISRA Note 12]
+
+#endif  // (EXCLUSIVE_ACCESS == 1)
+
+
+#endif  // RTX_CORE_POSIX_H_
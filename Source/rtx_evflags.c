@@ -139,16 +139,16 @@ static uint32_t EventFlagsCheck (os_event_flags_t *ef, uint32_t flags, uint32_t
 static bool_t IsEventFlagsPtrValid (const os_event_flags_t *ef) {
 #ifdef RTX_OBJ_PTR_CHECK
   //lint --e{923} --e{9078} "cast from pointer to unsigned int" [MISRA Note 7]
-  uint32_t cb_start  = (uint32_t)&__os_evflags_cb_start__;
-  uint32_t cb_length = (uint32_t)&__os_evflags_cb_length__;
+  uintptr_t cb_start  = (uintptr_t)&__os_evflags_cb_start__;
+  uintptr_t cb_length = (uintptr_t)&__os_evflags_cb_length__;
 
   // Check the section boundaries
-  if (((uint32_t)ef - cb_start) >= cb_length) {
+  if (((uintptr_t)ef - cb_start) >= cb_length) {
     //lint -e{904} "Return statement before end of function" [MISRA Note 1]
     return FALSE;
   }
   // Check the object alignment
-  if ((((uint32_t)ef - cb_start) % sizeof(os_event_flags_t)) != 0U) {
+  if ((((uintptr_t)ef - cb_start) % sizeof(os_event_flags_t)) != 0U) {
     //lint -e{904} "Return statement before end of function" [MISRA Note 1]
     return FALSE;
   }
@@ -163,12 +163,151 @@ static bool_t IsEventFlagsPtrValid (const os_event_flags_t *ef) {
 }
 
 
+#ifdef RTX_EVFLAGS_WAIT_INDEX
+/// Get Event Flags wait list index of a waiting Thread.
+/// \param[in]  ef              event flags object.
+/// \param[in]  thread          thread object.
+/// \return Event Flag number or osRtxEventFlagsLimit (any of several Event Flags).
+static uint32_t EventFlagsWaitIndex (const os_event_flags_t *ef, const os_thread_t *thread) {
+  uint32_t flags;
+
+  flags = thread->wait_flags;
+  if ((thread->flags_options & osFlagsWaitAll) != 0U) {
+    // Index by an Event Flag that is not set (checked again when it is set)
+    if ((flags & ~ef->event_flags) != 0U) {
+      flags &= ~ef->event_flags;
+    }
+  } else if ((flags & (flags - 1U)) != 0U) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return osRtxEventFlagsLimit;
+  } else {
+    // Single Event Flag
+  }
+
+  return (31U - (uint32_t)CountLeadingZeros(flags & (0U - flags)));
+}
+
+/// Wakeup Threads waiting for Event Flags (highest Priority first).
+/// \param[in]  ef              event flags object.
+/// \param[in]  event_flags     event flags after setting.
+/// \return event flags after the last wakeup.
+static uint32_t EventFlagsWakeup (os_event_flags_t *ef, uint32_t event_flags) {
+  os_thread_t *thread;
+  os_thread_t *thread_any;
+  uint32_t     event_flags0;
+  uint32_t     wait_map;
+  uint32_t     n;
+
+  // Threads waiting for any of several Event Flags are checked in list order
+  thread_any = ef->wait_list[osRtxEventFlagsLimit];
+  for (;;) {
+    // Select highest Priority Thread of the lists of set Event Flags
+    thread   = thread_any;
+    wait_map = ef->wait_flags & ef->event_flags;
+    while (wait_map != 0U) {
+      n = 31U - (uint32_t)CountLeadingZeros(wait_map & (0U - wait_map));
+      wait_map &= wait_map - 1U;
+      if ((thread == NULL) || osRtxThreadPrecedes(ef->wait_list[n], thread)) {
+        thread = ef->wait_list[n];
+      }
+    }
+    if (thread == NULL) {
+      break;
+    }
+    if (thread == thread_any) {
+      thread_any = thread->wait_next;
+    }
+    event_flags0 = EventFlagsCheck(ef, thread->wait_flags, thread->flags_options);
+    if (event_flags0 != 0U) {
+      if ((thread->flags_options & osFlagsNoClear) == 0U) {
+        event_flags = event_flags0 & ~thread->wait_flags;
+      } else {
+        event_flags = event_flags0;
+      }
+      osRtxThreadListRemove(thread);
+      osRtxThreadWaitExit(thread, event_flags0, FALSE);
+      EvrRtxEventFlagsWaitCompleted(ef, thread->wait_flags, thread->flags_options, event_flags0);
+    } else if ((thread->flags_options & osFlagsWaitAll) != 0U) {
+      // Move Thread to the list of an Event Flag that is not set
+      osRtxEventFlagsWaitUnlink(thread);
+      osRtxEventFlagsWaitLink(thread);
+    } else {
+      // Event Flag cleared by an earlier Thread or not set
+    }
+  }
+
+  return event_flags;
+}
+#endif
+
+
 //  ==== Library functions ====
 
+#ifdef RTX_EVFLAGS_WAIT_INDEX
+/// Link a waiting Thread into the Event Flags wait list of its flags (sorted by Priority).
+/// \param[in]  thread          thread object (in Event Flags Threads list).
+void osRtxEventFlagsWaitLink (os_thread_t *thread) {
+  os_event_flags_t *ef;
+  os_thread_t      *prev, *next;
+  uint32_t          n;
+
+  ef   = osRtxEventFlagsObject(osRtxObject(thread->list_root));
+  n    = EventFlagsWaitIndex(ef, thread);
+  prev = NULL;
+  next = ef->wait_list[n];
+  while ((next != NULL) && !osRtxThreadPrecedes(thread, next)) {
+    prev = next;
+    next = next->wait_next;
+  }
+  thread->wait_index = (uint8_t)n;
+  thread->wait_prev  = prev;
+  thread->wait_next  = next;
+  if (next != NULL) {
+    next->wait_prev = thread;
+  }
+  if (prev != NULL) {
+    prev->wait_next = thread;
+  } else {
+    ef->wait_list[n] = thread;
+    if (n < osRtxEventFlagsLimit) {
+      ef->wait_flags |= 1UL << n;
+    }
+  }
+}
+
+/// Unlink a waiting Thread from the Event Flags wait list.
+/// \param[in]  thread          thread object (in Event Flags Threads list).
+void osRtxEventFlagsWaitUnlink (os_thread_t *thread) {
+  os_event_flags_t *ef;
+  uint32_t          n;
+
+  ef = osRtxEventFlagsObject(osRtxObject(thread->list_root));
+  n  = thread->wait_index;
+  if (thread->wait_next != NULL) {
+    thread->wait_next->wait_prev = thread->wait_prev;
+  }
+  if (thread->wait_prev != NULL) {
+    thread->wait_prev->wait_next = thread->wait_next;
+  } else {
+    ef->wait_list[n] = thread->wait_next;
+    if ((ef->wait_list[n] == NULL) && (n < osRtxEventFlagsLimit)) {
+      ef->wait_flags &= ~(1UL << n);
+    }
+  }
+  thread->wait_next = NULL;
+  thread->wait_prev = NULL;
+}
+#endif
+
 /// Destroy an Event Flags object.
 /// \param[in]  ef              event flags object.
 static void osRtxEventFlagsDestroy (os_event_flags_t *ef) {
 
+  // Complete pending post ISR processing
+  if (ef->post_next != NULL) {
+    osRtxPostProcessFlush();
+  }
+
   // Mark object as invalid
   ef->id = osRtxIdInvalid;
 
@@ -201,8 +340,8 @@ void osRtxEventFlagsDeleteClass (uint32_t safety_class, uint32_t mode) {
   uint32_t          length;
 
   //lint --e{923} --e{9078} "cast from pointer to unsigned int" [MISRA Note 7]
-  ef     = (os_event_flags_t *)(uint32_t)&__os_evflags_cb_start__;
-  length =                     (uint32_t)&__os_evflags_cb_length__;
+  ef     = (os_event_flags_t *)(uintptr_t)&__os_evflags_cb_start__;
+  length =                     (uint32_t)(uintptr_t)&__os_evflags_cb_length__;
   while (length >= sizeof(os_event_flags_t)) {
     if (   (ef->id == osRtxIdEventFlags) &&
         ((((mode & osSafetyWithSameClass)  != 0U) &&
@@ -213,6 +352,9 @@ void osRtxEventFlagsDeleteClass (uint32_t safety_class, uint32_t mode) {
         thread = osRtxThreadListGet(osRtxObject(ef));
         osRtxThreadWaitExit(thread, (uint32_t)osErrorResource, FALSE);
       }
+#ifdef RTX_THREAD_WAIT_ANY
+      osRtxThreadWaitAnyDelete(osRtxObject(ef), FALSE);
+#endif
       osRtxEventFlagsDestroy(ef);
     }
     length -= sizeof(os_event_flags_t);
@@ -227,22 +369,40 @@ void osRtxEventFlagsDeleteClass (uint32_t safety_class, uint32_t mode) {
 /// Event Flags post ISR processing.
 /// \param[in]  ef              event flags object.
 static void osRtxEventFlagsPostProcess (os_event_flags_t *ef) {
+#ifndef RTX_EVFLAGS_WAIT_INDEX
   os_thread_t *thread;
   os_thread_t *thread_next;
   uint32_t     event_flags;
+  uint32_t     wait_flags;
+#endif
 
-  // Check if Threads are waiting for Event Flags
-  thread = ef->thread_list;
-  while (thread != NULL) {
-    thread_next = thread->thread_next;
-    event_flags = EventFlagsCheck(ef, thread->wait_flags, thread->flags_options);
-    if (event_flags != 0U) {
-      osRtxThreadListRemove(thread);
-      osRtxThreadWaitExit(thread, event_flags, FALSE);
-      EvrRtxEventFlagsWaitCompleted(ef, thread->wait_flags, thread->flags_options, event_flags);
+#ifdef RTX_EVFLAGS_WAIT_INDEX
+  // Wakeup Threads waiting for the set Event Flags
+  (void)EventFlagsWakeup(ef, ef->event_flags);
+#else
+  // Check if Threads are waiting for any of the Event Flags
+  if ((ef->wait_flags & ef->event_flags) != 0U) {
+    wait_flags = 0U;
+    thread = ef->thread_list;
+    while (thread != NULL) {
+      thread_next = thread->thread_next;
+      event_flags = EventFlagsCheck(ef, thread->wait_flags, thread->flags_options);
+      if (event_flags != 0U) {
+        osRtxThreadListRemove(thread);
+        osRtxThreadWaitExit(thread, event_flags, FALSE);
+        EvrRtxEventFlagsWaitCompleted(ef, thread->wait_flags, thread->flags_options, event_flags);
+      } else {
+        wait_flags |= thread->wait_flags;
+      }
+      thread = thread_next;
     }
-    thread = thread_next;
+    ef->wait_flags = wait_flags;
   }
+#endif
+#ifdef RTX_THREAD_WAIT_ANY
+  // Wakeup Threads waiting for multiple Objects
+  osRtxThreadWaitAnyNotify(osRtxObject(ef), FALSE);
+#endif
 }
 
 
@@ -335,6 +495,11 @@ static osEventFlagsId_t svcRtxEventFlagsNew (const osEventFlagsAttr_t *attr) {
     ef->name        = name;
     ef->thread_list = NULL;
     ef->event_flags = 0U;
+    ef->wait_flags  = 0U;
+#ifdef RTX_EVFLAGS_WAIT_INDEX
+    (void)memset(ef->wait_list, 0, sizeof(ef->wait_list));
+#endif
+    ef->post_next   = NULL;
 #ifdef RTX_SAFETY_CLASS
     if ((attr_bits & osSafetyClass_Valid) != 0U) {
       ef->attr     |= (uint8_t)((attr_bits & osSafetyClass_Msk) >>
@@ -379,10 +544,15 @@ static const char *svcRtxEventFlagsGetName (osEventFlagsId_t ef_id) {
 /// \note API identical to osEventFlagsSet
 static uint32_t svcRtxEventFlagsSet (osEventFlagsId_t ef_id, uint32_t flags) {
   os_event_flags_t *ef = osRtxEventFlagsId(ef_id);
+#if (!defined(RTX_EVFLAGS_WAIT_INDEX) || defined(RTX_SAFETY_CLASS))
   os_thread_t      *thread;
+#endif
+#ifndef RTX_EVFLAGS_WAIT_INDEX
   os_thread_t      *thread_next;
-  uint32_t          event_flags;
   uint32_t          event_flags0;
+  uint32_t          wait_flags;
+#endif
+  uint32_t          event_flags;
 
   // Check parameters
   if (!IsEventFlagsPtrValid(ef) || (ef->id != osRtxIdEventFlags) ||
@@ -406,23 +576,38 @@ static uint32_t svcRtxEventFlagsSet (osEventFlagsId_t ef_id, uint32_t flags) {
   // Set Event Flags
   event_flags = EventFlagsSet(ef, flags);
 
-  // Check if Threads are waiting for Event Flags
-  thread = ef->thread_list;
-  while (thread != NULL) {
-    thread_next = thread->thread_next;
-    event_flags0 = EventFlagsCheck(ef, thread->wait_flags, thread->flags_options);
-    if (event_flags0 != 0U) {
-      if ((thread->flags_options & osFlagsNoClear) == 0U) {
-        event_flags = event_flags0 & ~thread->wait_flags;
+#ifdef RTX_EVFLAGS_WAIT_INDEX
+  // Wakeup Threads waiting for the set Event Flags
+  event_flags = EventFlagsWakeup(ef, event_flags);
+#else
+  // Check if Threads are waiting for any of the set Event Flags
+  if ((ef->wait_flags & flags) != 0U) {
+    wait_flags = 0U;
+    thread = ef->thread_list;
+    while (thread != NULL) {
+      thread_next = thread->thread_next;
+      event_flags0 = EventFlagsCheck(ef, thread->wait_flags, thread->flags_options);
+      if (event_flags0 != 0U) {
+        if ((thread->flags_options & osFlagsNoClear) == 0U) {
+          event_flags = event_flags0 & ~thread->wait_flags;
+        } else {
+          event_flags = event_flags0;
+        }
+        osRtxThreadListRemove(thread);
+        osRtxThreadWaitExit(thread, event_flags0, FALSE);
+        EvrRtxEventFlagsWaitCompleted(ef, thread->wait_flags, thread->flags_options, event_flags0);
       } else {
-        event_flags = event_flags0;
+        wait_flags |= thread->wait_flags;
       }
-      osRtxThreadListRemove(thread);
-      osRtxThreadWaitExit(thread, event_flags0, FALSE);
-      EvrRtxEventFlagsWaitCompleted(ef, thread->wait_flags, thread->flags_options, event_flags0);
+      thread = thread_next;
     }
-    thread = thread_next;
+    ef->wait_flags = wait_flags;
   }
+#endif
+#ifdef RTX_THREAD_WAIT_ANY
+  // Wakeup Threads waiting for multiple Objects
+  osRtxThreadWaitAnyNotify(osRtxObject(ef), FALSE);
+#endif
   osRtxThreadDispatch(NULL);
 
   EvrRtxEventFlagsSetDone(ef, event_flags);
@@ -520,10 +705,13 @@ static uint32_t svcRtxEventFlagsWait (osEventFlagsId_t ef_id, uint32_t flags, ui
       // Suspend current Thread
       if (osRtxThreadWaitEnter(osRtxThreadWaitingEventFlags, timeout)) {
         thread = osRtxThreadGetRunning();
-        osRtxThreadListPut(osRtxObject(ef), thread);
         // Store waiting flags and options
         thread->wait_flags = flags;
         thread->flags_options = (uint8_t)options;
+        osRtxThreadListPut(osRtxObject(ef), thread);
+#ifndef RTX_EVFLAGS_WAIT_INDEX
+        ef->wait_flags |= flags;
+#endif
       } else {
         EvrRtxEventFlagsWaitTimeout(ef);
       }
@@ -569,6 +757,10 @@ static osStatus_t svcRtxEventFlagsDelete (osEventFlagsId_t ef_id) {
     } while (ef->thread_list != NULL);
     osRtxThreadDispatch(NULL);
   }
+#ifdef RTX_THREAD_WAIT_ANY
+  // Unblock Threads waiting for multiple Objects
+  osRtxThreadWaitAnyDelete(osRtxObject(ef), TRUE);
+#endif
 
   osRtxEventFlagsDestroy(ef);
 
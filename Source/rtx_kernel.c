@@ -31,6 +31,11 @@ osRtxInfo_t osRtxInfo __attribute__((section(".data.os"))) =
 //lint -e{785} "Initialize only OS ID, OS Version and Kernel State"
 { .os_id = osRtxKernelId, .version = osRtxVersionKernel, .kernel.state = osRtxKernelInactive };
 
+#ifdef RTX_HR_TIMER
+//  OS Tick interval [counts] (OS Tick timer period varies with High-Resolution Timer compare)
+uint32_t osRtxKernelTickInterval;
+#endif
+
 
 //  ==== Helper functions ====
 
@@ -64,10 +69,21 @@ static void KernelUnblock (void) {
 
 // Get Kernel sleep time
 static uint32_t GetKernelSleepTime (void) {
+#if (!defined(RTX_TIMING_WHEEL) || defined(RTX_THREAD_WATCHDOG))
   const os_thread_t *thread;
+#endif
+#ifndef RTX_TIMING_WHEEL
   const os_timer_t  *timer;
+#endif
+#if (defined(RTX_TIMING_WHEEL) || defined(RTX_THREAD_BUDGET))
+  uint32_t           tick;
+#endif
   uint32_t           delay;
 
+#ifdef RTX_TIMING_WHEEL
+  // Check Thread Delay timing wheel
+  delay = osRtxWheelNext(&osRtxThreadWheel);
+#else
   delay = osWaitForever;
 
   // Check Thread Delay list
@@ -75,6 +91,7 @@ static uint32_t GetKernelSleepTime (void) {
   if (thread != NULL) {
     delay = thread->delay;
   }
+#endif
 
 #ifdef RTX_THREAD_WATCHDOG
   // Check Thread Watchdog list
@@ -86,6 +103,21 @@ static uint32_t GetKernelSleepTime (void) {
   }
 #endif
 
+#ifdef RTX_THREAD_BUDGET
+  // Check Thread Budget replenishment
+  tick = osRtxThreadBudgetNext();
+  if (tick < delay) {
+    delay = tick;
+  }
+#endif
+
+#ifdef RTX_TIMING_WHEEL
+  // Check Active Timer timing wheel
+  tick = osRtxWheelNext(&osRtxTimerWheel);
+  if (tick < delay) {
+    delay = tick;
+  }
+#else
   // Check Active Timer list
   timer = osRtxInfo.timer.list;
   if (timer != NULL) {
@@ -93,10 +125,79 @@ static uint32_t GetKernelSleepTime (void) {
       delay = timer->tick;
     }
   }
+#endif
 
   return delay;
 }
 
+/// Advance Kernel time without expiry of Thread Delays, Timers and Watchdogs.
+/// \param[in]  ticks           number of ticks (less than Kernel sleep time).
+static void KernelSkipTicks (uint32_t ticks) {
+#if (!defined(RTX_TIMING_WHEEL) || defined(RTX_THREAD_WATCHDOG))
+  os_thread_t *thread;
+#endif
+#ifndef RTX_TIMING_WHEEL
+  os_timer_t  *timer;
+#endif
+
+#ifdef RTX_TIMING_WHEEL
+  // Advance timing wheels (no Slot is due within skipped ticks)
+  osRtxThreadWheel.time += ticks;
+  osRtxTimerWheel.time  += ticks;
+#else
+  // Update Thread Delay ticks
+  thread = osRtxInfo.thread.delay_list;
+  if (thread != NULL) {
+    thread->delay -= ticks;
+  }
+
+  // Update Timer ticks
+  timer = osRtxInfo.timer.list;
+  if (timer != NULL) {
+    timer->tick -= ticks;
+  }
+#endif
+
+#ifdef RTX_THREAD_WATCHDOG
+  // Update Thread Watchdog ticks
+  thread = osRtxInfo.thread.wdog_list;
+  if (thread != NULL) {
+    thread->wdog_tick -= ticks;
+  }
+#endif
+
+  osRtxInfo.kernel.tick += ticks;
+}
+
+/// Process one Kernel Tick for Thread Delays, Timers and Watchdogs.
+static void KernelTick (void) {
+
+  osRtxInfo.kernel.tick++;
+
+  // Process Thread Delays
+  osRtxThreadDelayTick();
+
+#ifdef RTX_THREAD_EDF
+  // Check Thread Deadlines
+  osRtxThreadDeadlineTick();
+#endif
+
+  // Process Timers
+  if (osRtxInfo.timer.tick != NULL) {
+    osRtxInfo.timer.tick();
+  }
+
+#ifdef RTX_THREAD_WATCHDOG
+  // Process Watchdog Timers
+  osRtxThreadWatchdogTick();
+#endif
+
+#ifdef RTX_THREAD_BUDGET
+  // Replenish Thread Budgets
+  osRtxThreadBudgetReplenish();
+#endif
+}
+
 
 //  ==== Service Calls ====
 
@@ -278,11 +379,17 @@ static osStatus_t svcRtxKernelStart (void) {
   }
   osRtxInfo.tick_irqn = OS_Tick_GetIRQn();
 
+#ifdef RTX_HR_TIMER
+  // Setup High-Resolution Timer compare
+  osRtxKernelTickInterval = OS_Tick_GetInterval();
+  osRtxHrTimerSetup();
+#endif
+
   // Enable RTOS Tick
   OS_Tick_Enable();
 
   // Switch to Ready Thread with highest Priority
-  thread = osRtxThreadListGet(&osRtxInfo.thread.ready);
+  thread = osRtxThreadReadyGet();
   osRtxThreadSwitch(thread);
 
   osRtxInfo.kernel.state = osRtxKernelRunning;
@@ -393,6 +500,9 @@ static int32_t svcRtxKernelRestoreLock (int32_t lock) {
 /// \note API identical to osKernelSuspend
 static uint32_t svcRtxKernelSuspend (void) {
   uint32_t delay;
+#ifdef RTX_HR_TIMER
+  uint32_t tick;
+#endif
 
   if (osRtxInfo.kernel.state != osRtxKernelRunning) {
     EvrRtxKernelError(osRtxErrorKernelNotRunning);
@@ -416,6 +526,21 @@ static uint32_t svcRtxKernelSuspend (void) {
 
   delay = GetKernelSleepTime();
 
+#ifdef RTX_HR_TIMER
+  // Wake up in the tick period of the first High-Resolution Timer
+  tick = osRtxHrTimerNext();
+  if (tick < delay) {
+    delay = tick;
+  }
+#endif
+
+#ifdef RTX_WORK_QUEUE
+  // Do not sleep while soft IRQ Work Items are pending
+  if (osRtxWorkPending()) {
+    delay = 0U;
+  }
+#endif
+
   EvrRtxKernelSuspended(delay);
 
   return delay;
@@ -424,10 +549,8 @@ static uint32_t svcRtxKernelSuspend (void) {
 /// Resume the RTOS Kernel scheduler.
 /// \note API identical to osKernelResume
 static void svcRtxKernelResume (uint32_t sleep_ticks) {
-  os_thread_t *thread;
-  os_timer_t  *timer;
-  uint32_t     delay;
-  uint32_t     ticks, kernel_tick;
+  uint32_t delay;
+  uint32_t ticks, kernel_tick;
 
   if (osRtxInfo.kernel.state != osRtxKernelSuspended) {
     EvrRtxKernelResumed();
@@ -435,51 +558,26 @@ static void svcRtxKernelResume (uint32_t sleep_ticks) {
     return;
   }
 
-  delay = GetKernelSleepTime();
-  if (sleep_ticks >= delay) {
-    ticks = delay - 1U;
-  } else {
-    ticks = sleep_ticks;
-  }
-
-  // Update Thread Delay sleep ticks
-  thread = osRtxInfo.thread.delay_list;
-  if (thread != NULL) {
-    thread->delay -= ticks;
-  }
-
-  // Update Timer sleep ticks
-  timer = osRtxInfo.timer.list;
-  if (timer != NULL) {
-    timer->tick -= ticks;
-  }
-
-#ifdef RTX_THREAD_WATCHDOG
-  // Update Thread Watchdog sleep ticks
-  thread = osRtxInfo.thread.wdog_list;
-  if (thread != NULL) {
-    thread->wdog_tick -= ticks;
+#ifdef RTX_TIMER_RESUME_MERGE
+  // Periodic Timers expire only once within the sleep
+  if (osRtxInfo.timer.tick != NULL) {
+    osRtxTimerResume(sleep_ticks);
   }
 #endif
 
+  // Skip ticks without expiry and process only ticks with due entries
   kernel_tick = osRtxInfo.kernel.tick + sleep_ticks;
-  osRtxInfo.kernel.tick += ticks;
-
   while (osRtxInfo.kernel.tick != kernel_tick) {
-    osRtxInfo.kernel.tick++;
-
-    // Process Thread Delays
-    osRtxThreadDelayTick();
-
-    // Process Timers
-    if (osRtxInfo.timer.tick != NULL) {
-      osRtxInfo.timer.tick();
+    ticks = kernel_tick - osRtxInfo.kernel.tick;
+    delay = GetKernelSleepTime();
+    if (delay > ticks) {
+      KernelSkipTicks(ticks);
+    } else {
+      if (delay > 1U) {
+        KernelSkipTicks(delay - 1U);
+      }
+      KernelTick();
     }
-
-#ifdef RTX_THREAD_WATCHDOG
-    // Process Watchdog Timers
-    osRtxThreadWatchdogTick();
-#endif
   }
 
   osRtxInfo.kernel.state = osRtxKernelRunning;
@@ -488,6 +586,11 @@ static void svcRtxKernelResume (uint32_t sleep_ticks) {
 
   KernelUnblock();
 
+#ifdef RTX_HR_TIMER
+  // Process High-Resolution Timers (skipped ticks are not processed by the tick handler)
+  osRtxHrTimerTick();
+#endif
+
   EvrRtxKernelResumed();
 }
 
@@ -604,9 +707,9 @@ static osStatus_t svcRtxKernelDestroyClass (uint32_t safety_class, uint32_t mode
   }
 
   // Threads in Delay List
-  thread = osRtxInfo.thread.delay_list;
+  thread = osRtxThreadDelayFirst();
   while (thread != NULL) {
-    thread_next = thread->delay_next;
+    thread_next = osRtxThreadDelayNext(thread);
     if ((((mode & osSafetyWithSameClass)  != 0U) &&
          ((thread->attr >> osRtxAttrClass_Pos) == (uint8_t)safety_class)) ||
         (((mode & osSafetyWithLowerClass) != 0U) &&
@@ -662,7 +765,7 @@ static osStatus_t svcRtxKernelDestroyClass (uint32_t safety_class, uint32_t mode
     osRtxMutexOwnerRelease(thread->mutex_list);
     osRtxThreadJoinWakeup(thread);
     // Switch to next Ready Thread
-    osRtxThreadSwitch(osRtxThreadListGet(&osRtxInfo.thread.ready));
+    osRtxThreadSwitch(osRtxThreadReadyGet());
     // Update Stack Pointer
     thread->sp = __get_PSP();
 #ifdef RTX_STACK_CHECK
@@ -705,16 +808,7 @@ static uint32_t svcRtxKernelGetTickFreq (void) {
 /// Get the RTOS kernel system timer count.
 /// \note API identical to osKernelGetSysTimerCount
 static uint32_t svcRtxKernelGetSysTimerCount (void) {
-  uint32_t tick;
-  uint32_t count;
-
-  tick  = (uint32_t)osRtxInfo.kernel.tick;
-  count = OS_Tick_GetCount();
-  if (OS_Tick_GetOverflow() != 0U) {
-    count = OS_Tick_GetCount();
-    tick++;
-  }
-  count += tick * OS_Tick_GetInterval();
+  uint32_t count = osRtxKernelSysTimerCount();
   EvrRtxKernelGetSysTimerCount(count);
   return count;
 }
@@ -727,6 +821,41 @@ static uint32_t svcRtxKernelGetSysTimerFreq (void) {
   return freq;
 }
 
+/// Get the RTOS kernel run time information.
+/// \note API identical to osRtxKernelGetRunTime
+static osStatus_t svcRtxKernelGetRunTime (osRtxKernelRunTime_t *run_time) {
+#ifdef RTX_THREAD_RUN_TIME
+  const os_thread_t *thread;
+
+  // Check parameters
+  if (run_time == NULL) {
+    EvrRtxKernelError((int32_t)osErrorParameter);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return osErrorParameter;
+  }
+
+  // Check if Kernel is started
+  thread = osRtxInfo.thread.idle;
+  if (thread == NULL) {
+    EvrRtxKernelError(osRtxErrorKernelNotRunning);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return osError;
+  }
+
+  // Account time of the running Thread
+  osRtxThreadRunTimeUpdate();
+
+  run_time->total_time = ((uint64_t)osRtxInfo.thread.run_time.time_hi << 32) |
+                                    osRtxInfo.thread.run_time.time;
+  run_time->idle_time  = ((uint64_t)thread->run_time_hi << 32) | thread->run_time;
+
+  return osOK;
+#else
+  (void)run_time;
+  return osError;
+#endif
+}
+
 //  Service Calls definitions
 //lint ++flb "Library Begin" [MISRA Note 11]
 SVC0_0 (KernelInitialize,       osStatus_t)
@@ -744,6 +873,7 @@ SVC0_0 (KernelGetTickCount,     uint32_t)
 SVC0_0 (KernelGetTickFreq,      uint32_t)
 SVC0_0 (KernelGetSysTimerCount, uint32_t)
 SVC0_0 (KernelGetSysTimerFreq,  uint32_t)
+SVC0_1 (KernelGetRunTime,       osStatus_t, osRtxKernelRunTime_t *)
 //lint --flb "Library End"
 
 
@@ -756,6 +886,34 @@ SVC0_0 (KernelGetSysTimerFreq,  uint32_t)
 __WEAK void osRtxKernelBeforeInit (void) {
 }
 
+/// Get the RTOS kernel system timer count (kernel context).
+/// \return RTOS kernel current system timer count as 32-bit value.
+uint32_t osRtxKernelSysTimerCount (void) {
+  uint32_t tick;
+  uint32_t count;
+#ifdef RTX_HR_TIMER
+  uint32_t primask = __get_PRIMASK();
+
+  // OS Tick timer period is split by a pending High-Resolution Timer compare
+  __disable_irq();
+  tick  = (uint32_t)osRtxInfo.kernel.tick;
+  count = OS_Tick_CompareGetCount();
+  if (primask == 0U) {
+    __enable_irq();
+  }
+  count += tick * osRtxKernelTickInterval;
+#else
+  tick  = (uint32_t)osRtxInfo.kernel.tick;
+  count = OS_Tick_GetCount();
+  if (OS_Tick_GetOverflow() != 0U) {
+    count = OS_Tick_GetCount();
+    tick++;
+  }
+  count += tick * OS_Tick_GetInterval();
+#endif
+  return count;
+}
+
 /// RTOS Kernel Error Notification Handler
 /// \note API identical to osRtxErrorNotify
 uint32_t osRtxKernelErrorNotify (uint32_t code, void *object_id) {
@@ -970,3 +1128,47 @@ uint32_t osKernelGetSysTimerFreq (void) {
   }
   return freq;
 }
+
+/// Get the RTOS kernel run time information.
+osStatus_t osRtxKernelGetRunTime (osRtxKernelRunTime_t *run_time) {
+  osStatus_t status;
+
+  if (IsException() || IsIrqMasked()) {
+    EvrRtxKernelError((int32_t)osErrorISR);
+    status = osErrorISR;
+  } else {
+    status = __svcKernelGetRunTime(run_time);
+  }
+  return status;
+}
+
+/// Sleep until the next timed event with the Kernel Tick stopped (Idle Thread).
+void osRtxKernelIdleSleep (void) {
+  uint32_t ticks;
+  uint32_t sleep_ticks;
+  bool_t   sleep;
+
+  ticks = osKernelSuspend();
+
+  sleep       = FALSE;
+  sleep_ticks = 0U;
+  if (ticks > 1U) {
+    __disable_irq();
+    // Skip sleep when ISR requests are waiting for post processing
+    if (osRtxInfo.kernel.pendSV == 0U) {
+      if (OS_Tick_SleepEnter(ticks) != 0U) {
+        __WFI();
+        sleep_ticks = OS_Tick_SleepExit();
+        sleep = TRUE;
+      }
+    }
+    __enable_irq();
+  }
+
+  osKernelResume(sleep_ticks);
+
+  if (sleep == FALSE) {
+    // Wait for the next tick or interrupt
+    __WFI();
+  }
+}
@@ -37,6 +37,14 @@
 #endif
 #include "rtx_evr.h"
 
+// Section of read-only data referenced by the debugger (on a position
+// independent host executable addresses are relocated at load time)
+#if defined(__unix__)
+#define OS_RODATA_SECTION   ".data.rel.ro"
+#else
+#define OS_RODATA_SECTION   ".rodata"
+#endif
+
 
 // System Configuration
 // ====================
@@ -217,12 +225,14 @@ static const osThreadAttr_t os_timer_thread_attr = {
   0U
 };
 
+#ifndef RTX_TIMER_EXPIRED_LIST
+
 // Timer Message Queue Control Block
 static osRtxMessageQueue_t os_timer_mq_cb \
 __attribute__((section(".bss.os.msgqueue.cb")));
 
 // Timer Message Queue Data
-static uint32_t os_timer_mq_data[osRtxMessageQueueMemSize(OS_TIMER_CB_QUEUE,8)/4] \
+static uint64_t os_timer_mq_data[(osRtxMessageQueueMemSize(OS_TIMER_CB_QUEUE,sizeof(osRtxTimerFinfo_t))+7)/8] \
 __attribute__((section(".bss.os.msgqueue.mem")));
 
 // Timer Message Queue Attributes
@@ -239,12 +249,52 @@ static const osMessageQueueAttr_t os_timer_mq_attr = {
   (uint32_t)sizeof(os_timer_mq_data)
 };
 
+#endif  // RTX_TIMER_EXPIRED_LIST
+
 extern int32_t osRtxTimerSetup  (void);
 extern void    osRtxTimerThread (void *argument);
 
 #endif  // ((OS_TIMER_THREAD_STACK_SIZE != 0) && (OS_TIMER_CB_QUEUE != 0))
 
 
+// Deferred Work Configuration
+// ===========================
+
+#ifdef RTX_WORK_QUEUE
+
+#if ((OS_WORK_BATCH < 1) || (OS_WORK_BATCH > 256))
+#error "Invalid Work Batch size!"
+#endif
+
+#if (((OS_WORK_THREAD_STACK_SIZE % 8) != 0) || (OS_WORK_THREAD_STACK_SIZE < 96))
+#error "Invalid Work Thread Stack size!"
+#endif
+
+// Work Thread Control Block
+static osRtxThread_t os_work_thread_cb \
+__attribute__((section(".bss.os.thread.cb")));
+
+// Work Thread Stack
+static uint64_t os_work_thread_stack[OS_WORK_THREAD_STACK_SIZE/8] \
+__attribute__((section(".bss.os.thread.work.stack")));
+
+// Work Thread Attributes
+static const osThreadAttr_t os_work_thread_attr = {
+  "osRtxWork",
+  osThreadDetached | osThreadPrivileged,
+  &os_work_thread_cb,
+  (uint32_t)sizeof(os_work_thread_cb),
+  &os_work_thread_stack[0],
+  (uint32_t)sizeof(os_work_thread_stack),
+  //lint -e{9030} -e{9034} "cast from signed to enum"
+  (osPriority_t)OS_WORK_THREAD_PRIO,
+  0U,
+  0U
+};
+
+#endif  // RTX_WORK_QUEUE
+
+
 // Event Flags Configuration
 // =========================
 
@@ -440,7 +490,7 @@ __STATIC_INLINE void evr_initialize (void) {
 
 const osRtxConfig_t osRtxConfig \
 __USED \
-__attribute__((section(".rodata"))) =
+__attribute__((section(OS_RODATA_SECTION))) =
 {
   //lint -e{835} "Zero argument to operator"
   0U   // Flags
@@ -453,6 +503,9 @@ __attribute__((section(".rodata"))) =
 #if (OS_STACK_WATERMARK != 0)
   | osRtxConfigStackWatermark
 #endif
+#if (defined(OS_TICKLESS_IDLE) && (OS_TICKLESS_IDLE != 0))
+  | osRtxConfigTicklessIdle
+#endif
 #ifdef RTX_SAFETY_FEATURES
   | osRtxConfigSafetyFeatures
  #ifdef RTX_SAFETY_CLASS
@@ -552,12 +605,24 @@ __attribute__((section(".rodata"))) =
   &os_timer_thread_attr,
   osRtxTimerThread,
   osRtxTimerSetup,
+#ifdef RTX_TIMER_EXPIRED_LIST
+  NULL,
+  0U,
+#else
   &os_timer_mq_attr,
-  (uint32_t)OS_TIMER_CB_QUEUE
+  (uint32_t)OS_TIMER_CB_QUEUE,
+#endif
 #else
   NULL,
   NULL,
   NULL,
+  NULL,
+  0U,
+#endif
+#ifdef RTX_WORK_QUEUE
+  &os_work_thread_attr,
+  (uint32_t)OS_WORK_BATCH
+#else
   NULL,
   0U
 #endif
@@ -655,7 +720,7 @@ extern const uint32_t * const os_cb_sections[];
 //lint -esym(765,os_cb_sections) "Global scope"
 const uint32_t * const os_cb_sections[] \
 __USED \
-__attribute__((section(".rodata"))) =
+__attribute__((section(OS_RODATA_SECTION))) =
 {
   &__os_thread_cb_start__,
   &__os_thread_cb_end__,
@@ -120,6 +120,26 @@ extern const uint32_t __os_msgqueue_cb_length__  __attribute__((weak));
 #endif
 
 
+//  ==== Timing Wheel definitions ====
+
+#ifdef RTX_TIMING_WHEEL
+#define osRtxWheelLevels        8U      // Number of Levels
+#define osRtxWheelLevelBits     4U      // Slot index bits per Level
+#define osRtxWheelLevelSlots    16U     // Number of Slots per Level
+#define osRtxWheelOverflow      (osRtxWheelLevels * osRtxWheelLevelSlots)
+#define osRtxWheelSlots         (osRtxWheelOverflow + 1U)
+
+// Timing Wheel (Expiry times are absolute Wheel times)
+typedef struct {
+  uint32_t time;                        // Wheel time
+  uint16_t map[osRtxWheelLevels + 1U];  // Occupied Slots (one bit per Slot)
+} os_wheel_t;
+
+// Timing Wheels for Thread Delays and Timers
+extern os_wheel_t osRtxThreadWheel;
+extern os_wheel_t osRtxTimerWheel;
+#endif
+
 //  ==== Inline functions ====
 
 // Thread ID
@@ -237,27 +257,77 @@ __STATIC_INLINE void osRtxThreadSetRunning (os_thread_t *thread) {
   osRtxInfo.thread.run.curr = thread;
 }
 
+#ifdef RTX_TIMING_WHEEL
+// Timing Wheel Slot at specified Level for specified time
+__STATIC_INLINE uint32_t osRtxWheelSlotAt (uint32_t time, uint32_t level) {
+  return ((level * osRtxWheelLevelSlots) +
+          ((time >> (level * osRtxWheelLevelBits)) & (osRtxWheelLevelSlots - 1U)));
+}
+
+// Timing Wheel highest Level due at specified time
+__STATIC_INLINE uint32_t osRtxWheelLevelDue (uint32_t time) {
+  uint32_t level;
+  if (time == 0U) {
+    level = osRtxWheelLevels - 1U;
+  } else {
+    level = (31U - CountLeadingZeros(time & (0U - time))) / osRtxWheelLevelBits;
+  }
+  return level;
+}
+
+// Timing Wheel Slot Occupied Set/Clear
+__STATIC_INLINE void osRtxWheelMapSet (os_wheel_t *wheel, uint32_t slot) {
+  wheel->map[slot / osRtxWheelLevelSlots] |= (uint16_t)(1U << (slot % osRtxWheelLevelSlots));
+}
+__STATIC_INLINE void osRtxWheelMapClr (os_wheel_t *wheel, uint32_t slot) {
+  wheel->map[slot / osRtxWheelLevelSlots] &= (uint16_t)~(1U << (slot % osRtxWheelLevelSlots));
+}
+#endif
+
 
 //  ==== Library functions ====
 
 // Kernel Library functions
 extern void         osRtxKernelBeforeInit  (void);
+extern uint32_t     osRtxKernelSysTimerCount (void);
+#ifdef RTX_HR_TIMER
+extern uint32_t     osRtxKernelTickInterval;
+#endif
 
 // Thread Library functions
 extern void         osRtxThreadListPut     (os_object_t *object, os_thread_t *thread);
 extern os_thread_t *osRtxThreadListGet     (os_object_t *object);
+extern bool_t       osRtxThreadPrecedes    (const os_thread_t *thread, const os_thread_t *other);
 extern void         osRtxThreadListSort    (os_thread_t *thread);
 extern void         osRtxThreadListRemove  (os_thread_t *thread);
 extern void         osRtxThreadReadyPut    (os_thread_t *thread);
+extern os_thread_t *osRtxThreadReadyGet    (void);
 //lint -esym(759,osRtxThreadDelayRemove)    "Prototype in header"
 //lint -esym(765,osRtxThreadDelayRemove)    "Global scope"
 extern void         osRtxThreadDelayRemove (os_thread_t *thread);
 extern void         osRtxThreadDelayTick   (void);
-extern uint32_t    *osRtxThreadRegPtr      (const os_thread_t *thread);
+extern os_thread_t *osRtxThreadDelayFirst  (void);
+extern os_thread_t *osRtxThreadDelayNext   (const os_thread_t *thread);
+extern uintptr_t   *osRtxThreadRegPtr      (const os_thread_t *thread);
 extern void         osRtxThreadSwitch      (os_thread_t *thread);
 extern void         osRtxThreadDispatch    (os_thread_t *thread);
-extern void         osRtxThreadWaitExit    (os_thread_t *thread, uint32_t ret_val, bool_t dispatch);
+extern void         osRtxThreadWaitExit    (os_thread_t *thread, uintptr_t ret_val, bool_t dispatch);
 extern bool_t       osRtxThreadWaitEnter   (uint8_t state, uint32_t timeout);
+#ifdef RTX_THREAD_RUN_TIME
+extern void         osRtxThreadRunTimeUpdate (void);
+#endif
+#ifdef RTX_THREAD_EDF
+extern void         osRtxThreadDeadlineTick (void);
+#endif
+#ifdef RTX_THREAD_BUDGET
+extern void         osRtxThreadBudgetTick  (void);
+extern void         osRtxThreadBudgetReplenish (void);
+extern uint32_t     osRtxThreadBudgetNext  (void);
+#endif
+#ifdef RTX_THREAD_WAIT_ANY
+extern void         osRtxThreadWaitAnyNotify (os_object_t *object, bool_t dispatch);
+extern void         osRtxThreadWaitAnyDelete (const os_object_t *object, bool_t dispatch);
+#endif
 #ifdef RTX_STACK_CHECK
 extern bool_t       osRtxThreadStackCheck  (const os_thread_t *thread);
 #endif
@@ -279,15 +349,24 @@ extern bool_t       osRtxThreadStartup     (void);
 // Timer Library functions
 extern int32_t osRtxTimerSetup       (void);
 extern void    osRtxTimerThread      (void *argument);
+#ifdef RTX_TIMER_RESUME_MERGE
+extern void    osRtxTimerResume      (uint32_t ticks);
+#endif
 #ifdef RTX_SAFETY_CLASS
 extern void    osRtxTimerDeleteClass (uint32_t safety_class, uint32_t mode);
 #endif
+#ifdef RTX_HR_TIMER
+extern void     osRtxHrTimerSetup (void);
+extern void     osRtxHrTimerTick  (void);
+extern uint32_t osRtxHrTimerNext  (void);
+#endif
 
 // Mutex Library functions
-extern void osRtxMutexOwnerRelease (os_mutex_t *mutex_list);
-extern void osRtxMutexOwnerRestore (const os_mutex_t *mutex, const os_thread_t *thread_wakeup);
+extern void   osRtxMutexOwnerRelease   (os_mutex_t *mutex_list);
+extern void   osRtxMutexOwnerRestore   (const os_mutex_t *mutex, const os_thread_t *thread_wakeup);
+extern int8_t osRtxMutexThreadPriority (const os_thread_t *thread);
 #ifdef RTX_SAFETY_CLASS
-extern void osRtxMutexDeleteClass  (uint32_t safety_class, uint32_t mode);
+extern void   osRtxMutexDeleteClass    (uint32_t safety_class, uint32_t mode);
 #endif
 
 // Semaphore Library functions
@@ -296,6 +375,10 @@ extern void osRtxSemaphoreDeleteClass (uint32_t safety_class, uint32_t mode);
 #endif
 
 // Event Flags Library functions
+#ifdef RTX_EVFLAGS_WAIT_INDEX
+extern void osRtxEventFlagsWaitLink   (os_thread_t *thread);
+extern void osRtxEventFlagsWaitUnlink (os_thread_t *thread);
+#endif
 #ifdef RTX_SAFETY_CLASS
 extern void osRtxEventFlagsDeleteClass(uint32_t safety_class, uint32_t mode);
 #endif
@@ -320,9 +403,21 @@ extern void    osRtxMessageQueueDeleteClass(uint32_t safety_class, uint32_t mode
 #endif
 
 // System Library functions
-extern void osRtxTick_Handler   (void);
-extern void osRtxPendSV_Handler (void);
-extern void osRtxPostProcess    (os_object_t *object);
+extern void osRtxTick_Handler     (void);
+extern void osRtxPendSV_Handler   (void);
+extern void osRtxPostProcess      (os_object_t *object);
+extern void osRtxPostProcessFlush (void);
+#ifdef RTX_TIMING_WHEEL
+extern uint32_t osRtxWheelSlot  (const os_wheel_t *wheel, uint32_t time);
+extern uint32_t osRtxWheelNext  (const os_wheel_t *wheel);
+#endif
+#ifdef RTX_WORK_QUEUE
+extern void   osRtxWorkThread  (void *argument);
+extern bool_t osRtxWorkPending (void);
+#endif
+#ifdef RTX_EXECUTION_ZONE
+extern void osZoneSetup_Callback  (uint32_t zone);
+#endif
 
 
 #endif  // RTX_LIB_H_
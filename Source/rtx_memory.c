@@ -42,6 +42,39 @@ typedef struct mem_block_s {
 #define MB_INFO_LEN_MASK        0xFFFFFFFCU     // Length mask
 #define MB_INFO_TYPE_MASK       0x00000003U     // Type mask
 
+#ifdef RTX_MEMORY_TLSF
+//  Memory Block Info (TLSF): Length = <31:3>:'000', Previous Free = <2>, Type = <1:0>
+//  Free Memory Block has Info = 0 and a footer (pointer to block header) in the last word
+#define MB_INFO_PREV_FREE       0x00000004U     // Previous physical block is free
+#define MB_INFO_SIZE_MASK       0xFFFFFFF8U     // Size mask
+
+//  Free Memory Block structure
+typedef struct mem_free_s {
+  struct mem_block_s *next;     // Next Memory Block (physical)
+  uint32_t            info;     // Block Info (0 = free block)
+  struct mem_free_s  *free_next;// Next Free Memory Block in segregated list
+  struct mem_free_s  *free_prev;// Previous Free Memory Block in segregated list
+} mem_free_t;
+
+//  Minimum block size (header, links and footer)
+#define MB_TLSF_MIN_SIZE        ((uint32_t)((sizeof(mem_free_t) + sizeof(mem_block_t *) + 7U) & ~7U))
+
+//  TLSF Control structure (located in the first Memory Block)
+#define MB_TLSF_SL_BITS         3U              // Second level index bits
+#define MB_TLSF_SL_COUNT        8U              // Number of second level lists
+#define MB_TLSF_FL_MAX          28U             // Maximum number of first level classes
+#define MB_TLSF_SMALL_SIZE      64U             // Block sizes below are mapped linearly
+
+typedef struct {
+  uint32_t    fl_map;                   // First level bitmap
+  uint32_t    fl_count;                 // Number of first level classes
+  uint8_t     sl_map[MB_TLSF_FL_MAX];   // Second level bitmaps
+} mem_tlsf_t;
+
+//  Offset of the free list heads after the TLSF Control structure (pointer aligned)
+#define MB_TLSF_LIST_OFFSET     ((uint32_t)((sizeof(mem_tlsf_t) + sizeof(void *) - 1U) & ~(sizeof(void *) - 1U)))
+#endif
+
 //  Memory Head Pointer
 __STATIC_INLINE mem_head_t *MemHeadPtr (void *mem) {
   //lint -e{9079} -e{9087} "conversion from pointer to void to pointer to other type" [MISRA Note 6]
@@ -50,17 +83,159 @@ __STATIC_INLINE mem_head_t *MemHeadPtr (void *mem) {
 
 //  Memory Block Pointer
 __STATIC_INLINE mem_block_t *MemBlockPtr (void *mem, uint32_t offset) {
-  uint32_t     addr;
+  uintptr_t    addr;
   mem_block_t *ptr;
 
   //lint --e{923} --e{9078} "cast between pointer and unsigned int" [MISRA Note 8]
-  addr = (uint32_t)mem + offset;
+  addr = (uintptr_t)mem + offset;
   ptr  = (mem_block_t *)addr;
 
   return ptr;
 }
 
 
+#ifdef RTX_MEMORY_TLSF
+
+//  ==== TLSF Helper functions ====
+
+//  TLSF Control Pointer
+__STATIC_INLINE mem_tlsf_t *MemTlsfPtr (void *mem) {
+  return ((mem_tlsf_t *)MemBlockPtr(mem, sizeof(mem_head_t) + sizeof(mem_block_t)));
+}
+
+//  TLSF Free List Head Pointer
+__STATIC_INLINE mem_free_t **MemTlsfList (mem_tlsf_t *tlsf, uint32_t fl, uint32_t sl) {
+  //lint -e{740} -e{826} -e{9087} "cast from pointer to control structure to pointer to list array"
+  mem_free_t **list = (mem_free_t **)((void *)((uint8_t *)tlsf + MB_TLSF_LIST_OFFSET));
+  return (&list[(fl * MB_TLSF_SL_COUNT) + sl]);
+}
+
+//  Free Memory Block Pointer
+__STATIC_INLINE mem_free_t *MemFreePtr (mem_block_t *block) {
+  //lint -e{740} -e{826} "cast from pointer to block header to pointer to free block"
+  return ((mem_free_t *)((void *)block));
+}
+
+//  Memory Block Size (distance to next physical block)
+__STATIC_INLINE uint32_t MemBlockSize (const mem_block_t *block) {
+  //lint -e{923} -e{9078} "cast from pointer to unsigned int" [MISRA Note 8]
+  return ((uint32_t)((uintptr_t)block->next - (uintptr_t)block));
+}
+
+//  Index of lowest bit set in a non-zero value
+__STATIC_INLINE uint32_t MemLowestBit (uint32_t value) {
+  return (31U - (uint32_t)CountLeadingZeros(value & (0U - value)));
+}
+
+/// Map block size to first and second level index.
+/// \param[in]  size            block size.
+/// \param[out] fl              first level index.
+/// \param[out] sl              second level index.
+static void MemTlsfMapping (uint32_t size, uint32_t *fl, uint32_t *sl) {
+  uint32_t msb;
+
+  if (size < MB_TLSF_SMALL_SIZE) {
+    *fl = 0U;
+    *sl = size >> 3;
+  } else {
+    msb = 31U - (uint32_t)CountLeadingZeros(size);
+    *fl = msb - (MB_TLSF_SL_BITS + 2U);
+    *sl = (size >> (msb - MB_TLSF_SL_BITS)) & (MB_TLSF_SL_COUNT - 1U);
+  }
+}
+
+/// Insert a Free Memory Block into segregated list and mark it free.
+/// \param[in]  tlsf            TLSF control structure.
+/// \param[in]  block           memory block.
+static void MemTlsfInsert (mem_tlsf_t *tlsf, mem_block_t *block) {
+  mem_free_t  *free_block = MemFreePtr(block);
+  mem_free_t **list;
+  mem_block_t *next;
+  uint32_t     size, fl, sl;
+
+  size = MemBlockSize(block);
+  MemTlsfMapping(size, &fl, &sl);
+
+  list = MemTlsfList(tlsf, fl, sl);
+  free_block->info      = 0U;
+  free_block->free_prev = NULL;
+  free_block->free_next = *list;
+  if (*list != NULL) {
+    (*list)->free_prev = free_block;
+  }
+  *list = free_block;
+  tlsf->fl_map     |= 1UL << fl;
+  tlsf->sl_map[fl] |= (uint8_t)(1U << sl);
+
+  // Footer and Previous Free flag in next block (last block holds max used memory)
+  next = block->next;
+  *((mem_block_t **)((void *)next) - 1) = block;
+  if (next->next != NULL) {
+    next->info |= MB_INFO_PREV_FREE;
+  }
+}
+
+/// Remove a Free Memory Block from segregated list.
+/// \param[in]  tlsf            TLSF control structure.
+/// \param[in]  block           memory block.
+static void MemTlsfRemove (mem_tlsf_t *tlsf, mem_block_t *block) {
+  mem_free_t  *free_block = MemFreePtr(block);
+  mem_free_t **list;
+  uint32_t     fl, sl;
+
+  MemTlsfMapping(MemBlockSize(block), &fl, &sl);
+
+  list = MemTlsfList(tlsf, fl, sl);
+  if (free_block->free_next != NULL) {
+    free_block->free_next->free_prev = free_block->free_prev;
+  }
+  if (free_block->free_prev != NULL) {
+    free_block->free_prev->free_next = free_block->free_next;
+  } else {
+    *list = free_block->free_next;
+    if (*list == NULL) {
+      tlsf->sl_map[fl] &= (uint8_t)~(1U << sl);
+      if (tlsf->sl_map[fl] == 0U) {
+        tlsf->fl_map &= ~(1UL << fl);
+      }
+    }
+  }
+}
+
+/// Find a Free Memory Block which fits the requested size.
+/// \param[in]  tlsf            TLSF control structure.
+/// \param[in]  size            block size.
+/// \return free memory block or NULL when no block is available.
+static mem_block_t *MemTlsfFind (mem_tlsf_t *tlsf, uint32_t size) {
+  uint32_t fl, sl, map;
+
+  // Round up to the next list boundary so that any block in the list fits
+  if (size >= MB_TLSF_SMALL_SIZE) {
+    size += (1UL << ((31U - (uint32_t)CountLeadingZeros(size)) - MB_TLSF_SL_BITS)) - 1U;
+  }
+  MemTlsfMapping(size, &fl, &sl);
+  if (fl >= tlsf->fl_count) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return NULL;
+  }
+
+  map = (uint32_t)tlsf->sl_map[fl] & (0xFFFFFFFFU << sl);
+  if (map == 0U) {
+    map = tlsf->fl_map & (0xFFFFFFFEU << fl);
+    if (map == 0U) {
+      //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+      return NULL;
+    }
+    fl  = MemLowestBit(map);
+    map = tlsf->sl_map[fl];
+  }
+  sl = MemLowestBit(map);
+
+  //lint -e{740} -e{826} "cast from pointer to free block to pointer to block header"
+  return ((mem_block_t *)((void *)(*MemTlsfList(tlsf, fl, sl))));
+}
+
+
 //  ==== Library functions ====
 
 /// Initialize Memory Pool with variable block size.
@@ -70,10 +245,196 @@ __STATIC_INLINE mem_block_t *MemBlockPtr (void *mem, uint32_t offset) {
 __WEAK uint32_t osRtxMemoryInit (void *mem, uint32_t size) {
   mem_head_t  *head;
   mem_block_t *ptr;
+  mem_tlsf_t  *tlsf;
+  uint32_t     fl, sl;
+  uint32_t     ctrl_size;
+
+  // Determine TLSF control block size
+  MemTlsfMapping(size, &fl, &sl);
+  ctrl_size  = sizeof(mem_block_t) + MB_TLSF_LIST_OFFSET +
+               ((fl + 1U) * MB_TLSF_SL_COUNT * sizeof(mem_free_t *));
+  ctrl_size  = (ctrl_size + 7U) & ~((uint32_t)7U);
 
   // Check parameters
   //lint -e{923} "cast from pointer to unsigned int" [MISRA Note 7]
-  if ((mem == NULL) || (((uint32_t)mem & 7U) != 0U) || ((size & 7U) != 0U) ||
+  if ((mem == NULL) || (((uintptr_t)mem & 7U) != 0U) || ((size & 7U) != 0U) ||
+      (size < (sizeof(mem_head_t) + ctrl_size + MB_TLSF_MIN_SIZE + sizeof(mem_block_t)))) {
+    EvrRtxMemoryInit(mem, size, 0U);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return 0U;
+  }
+
+  // Initialize memory pool header
+  head = MemHeadPtr(mem);
+  head->size = size;
+  head->used = sizeof(mem_head_t) + ctrl_size + sizeof(mem_block_t);
+
+  // Initialize first block (TLSF control) and last block header
+  ptr = MemBlockPtr(mem, sizeof(mem_head_t));
+  ptr->next = MemBlockPtr(ptr, ctrl_size);
+  ptr->info = ctrl_size;
+  ptr->next->next = MemBlockPtr(mem, size - sizeof(mem_block_t));
+  ptr->next->next->next = NULL;
+  ptr->next->next->info = head->used;
+
+  // Initialize TLSF control and insert remaining memory as free block
+  tlsf = MemTlsfPtr(mem);
+  (void)memset(tlsf, 0, ctrl_size - sizeof(mem_block_t));
+  tlsf->fl_count = fl + 1U;
+  MemTlsfInsert(tlsf, ptr->next);
+
+  EvrRtxMemoryInit(mem, size, 1U);
+
+  return 1U;
+}
+
+/// Allocate a memory block from a Memory Pool.
+/// \param[in]  mem             pointer to memory pool.
+/// \param[in]  size            size of a memory block in bytes.
+/// \param[in]  type            memory block type: 0 - generic, 1 - control block
+/// \return allocated memory block or NULL in case of no memory is available.
+__WEAK void *osRtxMemoryAlloc (void *mem, uint32_t size, uint32_t type) {
+  mem_tlsf_t  *tlsf;
+  mem_block_t *p, *p_new;
+  uint32_t     block_size;
+  uint32_t     hole_size;
+
+  // Check parameters
+  if ((mem == NULL) || (size == 0U) || ((type & ~MB_INFO_TYPE_MASK) != 0U) ||
+      (size > (MemHeadPtr(mem))->size)) {
+    EvrRtxMemoryAlloc(mem, size, type, NULL);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return NULL;
+  }
+
+  // Add block header to size
+  block_size = size + sizeof(mem_block_t);
+  // Make sure that block is 8-byte aligned
+  block_size = (block_size + 7U) & ~((uint32_t)7U);
+  // Make sure that block can be released as free block
+  if (block_size < MB_TLSF_MIN_SIZE) {
+    block_size = MB_TLSF_MIN_SIZE;
+  }
+
+  // Search for free block big enough
+  tlsf = MemTlsfPtr(mem);
+  p = MemTlsfFind(tlsf, block_size);
+  if (p == NULL) {
+    // Failed (no free block)
+    EvrRtxMemoryAlloc(mem, size, type, NULL);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return NULL;
+  }
+  MemTlsfRemove(tlsf, p);
+
+  // Split block when the remaining hole can hold a free block
+  hole_size = MemBlockSize(p) - block_size;
+  if (hole_size >= MB_TLSF_MIN_SIZE) {
+    p_new = MemBlockPtr(p, block_size);
+    p_new->next = p->next;
+    p->next = p_new;
+    MemTlsfInsert(tlsf, p_new);
+  } else {
+    block_size = MemBlockSize(p);
+    if (p->next->next != NULL) {
+      p->next->info &= ~MB_INFO_PREV_FREE;
+    }
+  }
+  p->info = block_size | type;
+
+  // Update used memory
+  (MemHeadPtr(mem))->used += block_size;
+
+  // Update max used memory
+  p_new = MemBlockPtr(mem, (MemHeadPtr(mem))->size - sizeof(mem_block_t));
+  if (p_new->info < (MemHeadPtr(mem))->used) {
+    p_new->info = (MemHeadPtr(mem))->used;
+  }
+
+  p = MemBlockPtr(p, sizeof(mem_block_t));
+
+  EvrRtxMemoryAlloc(mem, size, type, p);
+
+  return p;
+}
+
+/// Return an allocated memory block back to a Memory Pool.
+/// \param[in]  mem             pointer to memory pool.
+/// \param[in]  block           memory block to be returned to the memory pool.
+/// \return 1 - success, 0 - failure.
+__WEAK uint32_t osRtxMemoryFree (void *mem, void *block) {
+  mem_tlsf_t  *tlsf;
+  mem_block_t *p, *p_prev, *p_next;
+  uintptr_t    addr, first, last;
+
+  // Check parameters
+  if ((mem == NULL) || (block == NULL)) {
+    EvrRtxMemoryFree(mem, block, 0U);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return 0U;
+  }
+
+  // Memory block header
+  p = MemBlockPtr(block, 0U);
+  p--;
+
+  // Check that block header is valid (allocated block inside memory pool)
+  //lint --e{923} --e{9078} "cast from pointer to unsigned int" [MISRA Note 7]
+  addr  = (uintptr_t)p;
+  first = (uintptr_t)(MemBlockPtr(mem, sizeof(mem_head_t))->next);
+  last  = (uintptr_t)mem + (MemHeadPtr(mem))->size - sizeof(mem_block_t);
+  if ((addr < first) || (addr >= last) || ((addr & 7U) != 0U) ||
+      ((p->info & MB_INFO_SIZE_MASK) == 0U) ||
+      ((uintptr_t)p->next != (addr + (p->info & MB_INFO_SIZE_MASK)))) {
+    EvrRtxMemoryFree(mem, block, 0U);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return 0U;
+  }
+
+  // Update used memory
+  (MemHeadPtr(mem))->used -= p->info & MB_INFO_SIZE_MASK;
+
+  tlsf = MemTlsfPtr(mem);
+
+  // Merge with next block when free
+  p_next = p->next;
+  if ((p_next->next != NULL) && (p_next->info == 0U)) {
+    MemTlsfRemove(tlsf, p_next);
+    p->next = p_next->next;
+  }
+
+  // Merge with previous block when free
+  if ((p->info & MB_INFO_PREV_FREE) != 0U) {
+    p_prev = *((mem_block_t **)((void *)p) - 1);
+    MemTlsfRemove(tlsf, p_prev);
+    p_prev->next = p->next;
+    p->info = 0U;
+    p = p_prev;
+  }
+
+  // Free block
+  MemTlsfInsert(tlsf, p);
+
+  EvrRtxMemoryFree(mem, block, 1U);
+
+  return 1U;
+}
+
+#else   // RTX_MEMORY_TLSF
+
+//  ==== Library functions ====
+
+/// Initialize Memory Pool with variable block size.
+/// \param[in]  mem             pointer to memory pool.
+/// \param[in]  size            size of a memory pool in bytes.
+/// \return 1 - success, 0 - failure.
+__WEAK uint32_t osRtxMemoryInit (void *mem, uint32_t size) {
+  mem_head_t  *head;
+  mem_block_t *ptr;
+
+  // Check parameters
+  //lint -e{923} "cast from pointer to unsigned int" [MISRA Note 7]
+  if ((mem == NULL) || (((uintptr_t)mem & 7U) != 0U) || ((size & 7U) != 0U) ||
       (size < (sizeof(mem_head_t) + (2U*sizeof(mem_block_t))))) {
     EvrRtxMemoryInit(mem, size, 0U);
     //lint -e{904} "Return statement before end of function" [MISRA Note 1]
@@ -124,7 +485,7 @@ __WEAK void *osRtxMemoryAlloc (void *mem, uint32_t size, uint32_t type) {
   p = MemBlockPtr(mem, sizeof(mem_head_t));
   for (;;) {
     //lint -e{923} -e{9078} "cast from pointer to unsigned int"
-    hole_size  = (uint32_t)p->next - (uint32_t)p;
+    hole_size  = (uint32_t)((uintptr_t)p->next - (uintptr_t)p);
     hole_size -= p->info & MB_INFO_LEN_MASK;
     if (hole_size >= block_size) {
       // Hole found
@@ -216,3 +577,5 @@ __WEAK uint32_t osRtxMemoryFree (void *mem, void *block) {
 
   return 1U;
 }
+
+#endif  // RTX_MEMORY_TLSF
@@ -42,16 +42,16 @@ __attribute__((section(".data.os.mempool.obj"))) =
 static bool_t IsMemoryPoolPtrValid (const os_memory_pool_t *mp) {
 #ifdef RTX_OBJ_PTR_CHECK
   //lint --e{923} --e{9078} "cast from pointer to unsigned int" [MISRA Note 7]
-  uint32_t cb_start  = (uint32_t)&__os_mempool_cb_start__;
-  uint32_t cb_length = (uint32_t)&__os_mempool_cb_length__;
+  uintptr_t cb_start  = (uintptr_t)&__os_mempool_cb_start__;
+  uintptr_t cb_length = (uintptr_t)&__os_mempool_cb_length__;
 
   // Check the section boundaries
-  if (((uint32_t)mp - cb_start) >= cb_length) {
+  if (((uintptr_t)mp - cb_start) >= cb_length) {
     //lint -e{904} "Return statement before end of function" [MISRA Note 1]
     return FALSE;
   }
   // Check the object alignment
-  if ((((uint32_t)mp - cb_start) % sizeof(os_memory_pool_t)) != 0U) {
+  if ((((uintptr_t)mp - cb_start) % sizeof(os_memory_pool_t)) != 0U) {
     //lint -e{904} "Return statement before end of function" [MISRA Note 1]
     return FALSE;
   }
@@ -188,6 +188,11 @@ osStatus_t osRtxMemoryPoolFree (os_mp_info_t *mp_info, void *block) {
 /// \param[in]  mp              memory pool object.
 static void osRtxMemoryPoolDestroy (os_memory_pool_t *mp) {
 
+  // Complete pending post ISR processing
+  if (mp->post_next != NULL) {
+    osRtxPostProcessFlush();
+  }
+
   // Mark object as invalid
   mp->id = osRtxIdInvalid;
 
@@ -225,8 +230,8 @@ void osRtxMemoryPoolDeleteClass  (uint32_t safety_class, uint32_t mode) {
   uint32_t          length;
 
   //lint --e{923} --e{9078} "cast from pointer to unsigned int" [MISRA Note 7]
-  mp     = (os_memory_pool_t *)(uint32_t)&__os_mempool_cb_start__;
-  length =                     (uint32_t)&__os_mempool_cb_length__;
+  mp     = (os_memory_pool_t *)(uintptr_t)&__os_mempool_cb_start__;
+  length =                     (uint32_t)(uintptr_t)&__os_mempool_cb_length__;
   while (length >= sizeof(os_memory_pool_t)) {
     if (   (mp->id == osRtxIdMemoryPool) &&
         ((((mode & osSafetyWithSameClass)  != 0U) &&
@@ -254,17 +259,18 @@ static void osRtxMemoryPoolPostProcess (os_memory_pool_t *mp) {
   void        *block;
   os_thread_t *thread;
 
-  // Check if Thread is waiting to allocate memory
-  if (mp->thread_list != NULL) {
+  // Check if Threads are waiting to allocate memory (frees may be coalesced)
+  while (mp->thread_list != NULL) {
     // Allocate memory
     block = osRtxMemoryPoolAlloc(&mp->mp_info);
-    if (block != NULL) {
-      // Wakeup waiting Thread with highest Priority
-      thread = osRtxThreadListGet(osRtxObject(mp));
-      //lint -e{923} "cast from pointer to unsigned int"
-      osRtxThreadWaitExit(thread, (uint32_t)block, FALSE);
-      EvrRtxMemoryPoolAllocated(mp, block);
+    if (block == NULL) {
+      break;
     }
+    // Wakeup waiting Thread with highest Priority
+    thread = osRtxThreadListGet(osRtxObject(mp));
+    //lint -e{923} "cast from pointer to unsigned int"
+    osRtxThreadWaitExit(thread, (uintptr_t)block, FALSE);
+    EvrRtxMemoryPoolAllocated(mp, block);
   }
 }
 
@@ -296,7 +302,7 @@ static osMemoryPoolId_t svcRtxMemoryPoolNew (uint32_t block_count, uint32_t bloc
   }
 
   b_count =  block_count;
-  b_size  = (block_size + 3U) & ~3UL;
+  b_size  = (block_size + (uint32_t)sizeof(void *) - 1U) & ~((uint32_t)sizeof(void *) - 1U);
   size    =  b_count * b_size;
 
   // Process attributes
@@ -338,7 +344,7 @@ static osMemoryPoolId_t svcRtxMemoryPoolNew (uint32_t block_count, uint32_t bloc
     }
     if (mp_mem != NULL) {
       //lint -e{923} "cast from pointer to unsigned int" [MISRA Note 7]
-      if ((((uint32_t)mp_mem & 3U) != 0U) || (mp_size < size)) {
+      if ((((uintptr_t)mp_mem & 3U) != 0U) || (mp_size < size)) {
         EvrRtxMemoryPoolError(NULL, osRtxErrorInvalidDataMemory);
         //lint -e{904} "Return statement before end of function" [MISRA Note 1]
         return NULL;
@@ -418,6 +424,7 @@ static osMemoryPoolId_t svcRtxMemoryPoolNew (uint32_t block_count, uint32_t bloc
     mp->attr        = 0U;
     mp->name        = name;
     mp->thread_list = NULL;
+    mp->post_next   = NULL;
 #ifdef RTX_SAFETY_CLASS
     if ((attr_bits & osSafetyClass_Valid) != 0U) {
       mp->attr     |= (uint8_t)((attr_bits & osSafetyClass_Msk) >>
@@ -546,7 +553,7 @@ static osStatus_t svcRtxMemoryPoolFree (osMemoryPoolId_t mp_id, void *block) {
         // Wakeup waiting Thread with highest Priority
         thread = osRtxThreadListGet(osRtxObject(mp));
         //lint -e{923} "cast from pointer to unsigned int"
-        osRtxThreadWaitExit(thread, (uint32_t)block0, TRUE);
+        osRtxThreadWaitExit(thread, (uintptr_t)block0, TRUE);
         EvrRtxMemoryPoolAllocated(mp, block0);
       }
     }
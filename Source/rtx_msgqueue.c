@@ -155,202 +155,832 @@ static void MessageQueueRemove (os_message_queue_t *mq, const os_message_t *msg)
   }
 }
 
-/// Verify that Message Queue object pointer is valid.
-/// \param[in]  mq              message queue object.
-/// \return true - valid, false - invalid.
-static bool_t IsMessageQueuePtrValid (const os_message_queue_t *mq) {
-#ifdef RTX_OBJ_PTR_CHECK
-  //lint --e{923} --e{9078} "cast from pointer to unsigned int" [MISRA Note 7]
-  uint32_t cb_start  = (uint32_t)&__os_msgqueue_cb_start__;
-  uint32_t cb_length = (uint32_t)&__os_msgqueue_cb_length__;
+/// Get the pending link of a Message put or removed from ISR.
+/// \param[in]  msg             message object.
+/// \return pointer to message link.
+static void **MessageQueuePendLink (os_message_t *msg) {
+  void **link;
 
-  // Check the section boundaries
-  if (((uint32_t)mq - cb_start) >= cb_length) {
-    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
-    return FALSE;
-  }
-  // Check the object alignment
-  if ((((uint32_t)mq - cb_start) % sizeof(os_message_queue_t)) != 0U) {
-    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
-    return FALSE;
+  if (msg->flags != 0U) {
+    // Removed Message is still in Queue: link is stored in its data (copied out)
+    //lint -e{9079} -e{9087} "cast between pointers to different object types"
+    link = (void **)(void *)&msg[1];
+  } else {
+    // New Message is not in Queue yet
+    //lint -e{9079} -e{9087} "cast between pointers to different object types"
+    link = (void **)(void *)&msg->next;
   }
+
+  return link;
+}
+
+/// Put a Message put or removed from ISR into pending list of Queue.
+/// \param[in]  mq              message queue object.
+/// \param[in]  msg             message object.
+static void MessageQueuePendPut (os_message_queue_t *mq, os_message_t *msg) {
+#if (EXCLUSIVE_ACCESS == 0)
+  uint32_t primask = __get_PRIMASK();
 #else
-  // Check NULL pointer
-  if (mq == NULL) {
-    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
-    return FALSE;
+  void    *head;
+#endif
+  void   **link;
+
+  link = MessageQueuePendLink(msg);
+
+#if (EXCLUSIVE_ACCESS == 0)
+  __disable_irq();
+
+  *link = mq->msg_pend;
+  mq->msg_pend = msg;
+
+  if (primask == 0U) {
+    __enable_irq();
   }
+#else
+  do {
+    head  = mq->msg_pend;
+    *link = head;
+  } while (atomic_ptr_cas(&mq->msg_pend, head, msg) != head);
 #endif
-  return TRUE;
 }
 
+/// Get all Messages from pending list of Queue.
+/// \param[in]  mq              message queue object.
+/// \return first message in order put into pending list or NULL.
+static os_message_t *MessageQueuePendGet (os_message_queue_t *mq) {
+#if (EXCLUSIVE_ACCESS == 0)
+  uint32_t      primask = __get_PRIMASK();
+#endif
+  os_message_t *msg;
+  os_message_t *prev;
+  void         *next;
+  void        **link;
 
-//  ==== Library functions ====
+#if (EXCLUSIVE_ACCESS == 0)
+  __disable_irq();
 
-/// Destroy a Message Queue object.
-/// \param[in]  mq              message queue object.
-static void osRtxMessageQueueDestroy (os_message_queue_t *mq) {
+  msg = mq->msg_pend;
+  mq->msg_pend = NULL;
 
-  // Mark object as invalid
-  mq->id = osRtxIdInvalid;
+  if (primask == 0U) {
+    __enable_irq();
+  }
+#else
+  do {
+    msg = mq->msg_pend;
+  } while (atomic_ptr_cas(&mq->msg_pend, msg, NULL) != msg);
+#endif
 
-  // Free data memory
-  if ((mq->flags & osRtxFlagSystemMemory) != 0U) {
-    (void)osRtxMemoryFree(osRtxInfo.mem.mq_data, mq->mp_info.block_base);
+  // Reverse list into order put
+  prev = NULL;
+  while (msg != NULL) {
+    link  = MessageQueuePendLink(msg);
+    next  = *link;
+    *link = prev;
+    prev  = msg;
+    msg   = next;
   }
 
-  // Free object memory
-  if ((mq->flags & osRtxFlagSystemObject) != 0U) {
-#ifdef RTX_OBJ_PTR_CHECK
-    (void)osRtxMemoryPoolFree(osRtxInfo.mpi.message_queue, mq);
-#else
-    if (osRtxInfo.mpi.message_queue != NULL) {
-      (void)osRtxMemoryPoolFree(osRtxInfo.mpi.message_queue, mq);
+  return prev;
+}
+
+/// Get a Message slot of FIFO ring buffer.
+/// \param[in]  mq              message queue object.
+/// \param[in]  index           slot index.
+/// \return message object.
+__STATIC_INLINE os_message_t *MessageQueueFifoSlot (const os_message_queue_t *mq, uint32_t index) {
+  //lint -e{923} -e{9078} "cast between pointer and unsigned int" [MISRA Note 7]
+  return (os_message_t *)((uintptr_t)mq->mp_info.block_base + (index * mq->mp_info.block_size));
+}
+
+/// Put a Message into FIFO ring buffer.
+/// \param[in]  mq              message queue object.
+/// \param[in]  msg_ptr         pointer to buffer with message to put into a queue.
+/// \param[in]  msg_prio        message priority.
+/// \return true - success, false - ring buffer full.
+static bool_t MessageQueueFifoPut (os_message_queue_t *mq, const void *msg_ptr, uint8_t msg_prio) {
+#if (EXCLUSIVE_ACCESS == 0)
+  uint32_t      primask = __get_PRIMASK();
+#endif
+  os_message_t *msg;
+  uint32_t      index;
+
+  if ((mq->attr & osRtxAttrFifoSP) != 0U) {
+    // Single producer: slot at write index must be free
+    index = mq->fifo_tail;
+    msg   = MessageQueueFifoSlot(mq, index);
+    if (msg->flags != 0U) {
+      //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+      return FALSE;
+    }
+    index++;
+    if (index == mq->mp_info.max_blocks) {
+      index = 0U;
+    }
+    mq->fifo_tail = (uint16_t)index;
+  } else {
+    // Multiple producers: reserve a slot and claim the write index
+#if (EXCLUSIVE_ACCESS == 0)
+    __disable_irq();
+
+    if (mq->fifo_count < mq->mp_info.max_blocks) {
+      mq->fifo_count++;
+      index = mq->fifo_tail;
+      if ((index + 1U) < mq->mp_info.max_blocks) {
+        mq->fifo_tail = (uint16_t)(index + 1U);
+      } else {
+        mq->fifo_tail = 0U;
+      }
     } else {
-      (void)osRtxMemoryFree(osRtxInfo.mem.common, mq);
+      index = mq->mp_info.max_blocks;
+    }
+
+    if (primask == 0U) {
+      __enable_irq();
+    }
+
+    if (index == mq->mp_info.max_blocks) {
+      //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+      return FALSE;
     }
+#else
+    if (atomic_inc16_lt(&mq->fifo_count, (uint16_t)mq->mp_info.max_blocks) >= mq->mp_info.max_blocks) {
+      //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+      return FALSE;
+    }
+    index = atomic_inc16_lim(&mq->fifo_tail, (uint16_t)mq->mp_info.max_blocks);
 #endif
-#ifdef RTX_OBJ_MEM_USAGE
-    osRtxMessageQueueMemUsage.cnt_free++;
+    msg = MessageQueueFifoSlot(mq, index);
+  }
+
+  // Copy Message and publish it
+  (void)memcpy(&msg[1], msg_ptr, mq->msg_size);
+  msg->priority = msg_prio;
+  __DMB();
+  msg->flags = 1U;
+
+  return TRUE;
+}
+
+/// Get a Message from FIFO ring buffer.
+/// \param[in]  mq              message queue object.
+/// \param[out] msg_ptr         pointer to buffer for message to get from a queue or NULL.
+/// \param[out] msg_prio        pointer to buffer for message priority or NULL.
+/// \return true - success, false - ring buffer empty.
+static bool_t MessageQueueFifoGet (os_message_queue_t *mq, void *msg_ptr, uint8_t *msg_prio) {
+#if (EXCLUSIVE_ACCESS == 0)
+  uint32_t      primask = __get_PRIMASK();
 #endif
+  os_message_t *msg;
+  uint32_t      index;
+
+  index = mq->fifo_head;
+  msg   = MessageQueueFifoSlot(mq, index);
+  if (msg->flags == 0U) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return FALSE;
   }
+  __DMB();
 
-  EvrRtxMessageQueueDestroyed(mq);
+  // Copy Message
+  if (msg_ptr != NULL) {
+    (void)memcpy(msg_ptr, &msg[1], mq->msg_size);
+  }
+  if (msg_prio != NULL) {
+    *msg_prio = msg->priority;
+  }
+
+  // Release slot
+  index++;
+  if (index == mq->mp_info.max_blocks) {
+    index = 0U;
+  }
+  mq->fifo_head = (uint16_t)index;
+  __DMB();
+  msg->flags = 0U;
+
+  if ((mq->attr & osRtxAttrFifoSP) == 0U) {
+#if (EXCLUSIVE_ACCESS == 0)
+    __disable_irq();
+
+    mq->fifo_count--;
+
+    if (primask == 0U) {
+      __enable_irq();
+    }
+#else
+    (void)atomic_dec16_nz(&mq->fifo_count);
+#endif
+  }
+
+  return TRUE;
 }
 
-#ifdef RTX_SAFETY_CLASS
-/// Delete a Message Queue safety class.
-/// \param[in]  safety_class    safety class.
-/// \param[in]  mode            safety mode.
-void osRtxMessageQueueDeleteClass (uint32_t safety_class, uint32_t mode) {
-  os_message_queue_t *mq;
-  os_thread_t        *thread;
-  uint32_t            length;
+/// Get number of Messages in FIFO ring buffer.
+/// \param[in]  mq              message queue object.
+/// \return number of messages (including messages being put).
+static uint32_t MessageQueueFifoCount (const os_message_queue_t *mq) {
+  uint32_t head, tail;
+  uint32_t count;
 
-  //lint --e{923} --e{9078} "cast from pointer to unsigned int" [MISRA Note 7]
-  mq     = (os_message_queue_t *)(uint32_t)&__os_msgqueue_cb_start__;
-  length =                       (uint32_t)&__os_msgqueue_cb_length__;
-  while (length >= sizeof(os_message_queue_t)) {
-    if (   (mq->id == osRtxIdMessageQueue) &&
-        ((((mode & osSafetyWithSameClass)  != 0U) &&
-          ((mq->attr >> osRtxAttrClass_Pos) == (uint8_t)safety_class)) ||
-         (((mode & osSafetyWithLowerClass) != 0U) &&
-          ((mq->attr >> osRtxAttrClass_Pos) <  (uint8_t)safety_class)))) {
-      while (mq->thread_list != NULL) {
-        thread = osRtxThreadListGet(osRtxObject(mq));
-        osRtxThreadWaitExit(thread, (uint32_t)osErrorResource, FALSE);
+  if ((mq->attr & osRtxAttrFifoSP) == 0U) {
+    count = mq->fifo_count;
+  } else {
+    head = mq->fifo_head;
+    tail = mq->fifo_tail;
+    if (tail != head) {
+      if (tail < head) {
+        tail += mq->mp_info.max_blocks;
+      }
+      count = tail - head;
+    } else {
+      // Ring buffer is either empty or full
+      if (MessageQueueFifoSlot(mq, head)->flags != 0U) {
+        count = mq->mp_info.max_blocks;
+      } else {
+        count = 0U;
       }
-      osRtxMessageQueueDestroy(mq);
     }
-    length -= sizeof(os_message_queue_t);
-    mq++;
   }
+
+  return count;
 }
-#endif
 
+/// Get a Thread with Highest Priority waiting to receive a Message.
+/// \param[in]  mq              message queue object.
+/// \return thread object or NULL.
+static os_thread_t *MessageQueueReceiver (const os_message_queue_t *mq) {
+  os_thread_t *thread;
+
+  thread = mq->thread_list;
+  while ((thread != NULL) &&
+         (thread->state != osRtxThreadWaitingMessageGet) &&
+         (thread->state != osRtxThreadWaitingMessageRecv)) {
+    thread = thread->thread_next;
+  }
 
-//  ==== Post ISR processing ====
+  return thread;
+}
 
-/// Message Queue post ISR processing.
-/// \param[in]  msg             message object.
-static void osRtxMessageQueuePostProcess (os_message_t *msg) {
-  os_message_queue_t *mq;
-  os_message_t       *msg0;
-  os_thread_t        *thread;
-  const uint32_t     *reg;
-  const void         *ptr_src;
-        void         *ptr_dst;
+/// Get a Thread with Highest Priority waiting to send a Message.
+/// \param[in]  mq              message queue object.
+/// \return thread object or NULL.
+static os_thread_t *MessageQueueSender (const os_message_queue_t *mq) {
+  os_thread_t *thread;
+
+  thread = mq->thread_list;
+  while ((thread != NULL) &&
+         (thread->state != osRtxThreadWaitingMessagePut) &&
+         (thread->state != osRtxThreadWaitingMessageLoan)) {
+    thread = thread->thread_next;
+  }
 
-  if (msg->flags != 0U) {
-    // Remove Message
-    //lint -e{9079} -e{9087} "cast between pointers to different object types"
-    mq = *((os_message_queue_t **)(void *)&msg[1]);
-    MessageQueueRemove(mq, msg);
-    // Free memory
-    msg->id = osRtxIdInvalid;
-    (void)osRtxMemoryPoolFree(&mq->mp_info, msg);
-    // Check if Thread is waiting to send a Message
-    if (mq->thread_list != NULL) {
-      // Try to allocate memory
-      //lint -e{9079} "conversion from pointer to void to pointer to other type" [MISRA Note 5]
-      msg0 = osRtxMemoryPoolAlloc(&mq->mp_info);
-      if (msg0 != NULL) {
-        // Wakeup waiting Thread with highest Priority
-        thread = osRtxThreadListGet(osRtxObject(mq));
-        osRtxThreadWaitExit(thread, (uint32_t)osOK, FALSE);
-        // Copy Message (R1: const void *msg_ptr, R2: uint8_t msg_prio)
-        reg = osRtxThreadRegPtr(thread);
+  return thread;
+}
+
+/// Resume Threads waiting on FIFO Message Queue and update the waiting flags.
+/// \param[in]  mq              message queue object.
+/// \param[in]  dispatch        dispatch flag.
+static void MessageQueueFifoWakeup (os_message_queue_t *mq, bool_t dispatch) {
+  os_thread_t    *thread;
+  const uintptr_t *reg;
+  uint8_t         wait;
+  bool_t          progress;
+
+  do {
+    progress = FALSE;
+    // Pass Message to Thread waiting to receive (R1: void *msg_ptr, R2: uint8_t *msg_prio)
+    thread = MessageQueueReceiver(mq);
+    if (thread != NULL) {
+      reg = osRtxThreadRegPtr(thread);
+      //lint -e{923} -e{9078} "cast from unsigned int to pointer"
+      if (MessageQueueFifoGet(mq, (void *)reg[1], (uint8_t *)reg[2])) {
+        osRtxThreadListRemove(thread);
+        osRtxThreadWaitExit(thread, (uint32_t)osOK, dispatch);
         //lint -e{923} "cast from unsigned int to pointer"
-        ptr_src = (const void *)reg[1];
-        (void)memcpy(&msg0[1], ptr_src, mq->msg_size);
-        // Store Message into Queue
-        msg0->id       = osRtxIdMessage;
-        msg0->flags    = 0U;
-        msg0->priority = (uint8_t)reg[2];
-        MessageQueuePut(mq, msg0);
-        EvrRtxMessageQueueInserted(mq, ptr_src);
+        EvrRtxMessageQueueRetrieved(mq, (void *)reg[1]);
+        progress = TRUE;
       }
     }
-  } else {
-    // New Message
-    //lint -e{9079} -e{9087} "cast between pointers to different object types"
-    mq = (void *)msg->next;
-    //lint -e{9087} "cast between pointers to different object types"
-    ptr_src = (const void *)msg->prev;
-    // Check if Thread is waiting to receive a Message
-    if ((mq->thread_list != NULL) && (mq->thread_list->state == osRtxThreadWaitingMessageGet)) {
-      EvrRtxMessageQueueInserted(mq, ptr_src);
-      // Wakeup waiting Thread with highest Priority
-      thread = osRtxThreadListGet(osRtxObject(mq));
-      osRtxThreadWaitExit(thread, (uint32_t)osOK, FALSE);
-      // Copy Message (R1: void *msg_ptr, R2: uint8_t *msg_prio)
+    // Take Message from Thread waiting to send (R1: const void *msg_ptr, R2: uint8_t msg_prio)
+    thread = MessageQueueSender(mq);
+    if (thread != NULL) {
       reg = osRtxThreadRegPtr(thread);
       //lint -e{923} "cast from unsigned int to pointer"
-      ptr_dst = (void *)reg[1];
-      (void)memcpy(ptr_dst, &msg[1], mq->msg_size);
-      if (reg[2] != 0U) {
-        //lint -e{923} -e{9078} "cast from unsigned int to pointer"
-        *((uint8_t *)reg[2]) = msg->priority;
+      if (MessageQueueFifoPut(mq, (const void *)reg[1], (uint8_t)reg[2])) {
+        osRtxThreadListRemove(thread);
+        osRtxThreadWaitExit(thread, (uint32_t)osOK, dispatch);
+        //lint -e{923} "cast from unsigned int to pointer"
+        EvrRtxMessageQueueInserted(mq, (const void *)reg[1]);
+        progress = TRUE;
+      }
+    }
+  } while (progress);
+
+  wait = 0U;
+  if (MessageQueueReceiver(mq) != NULL) {
+    wait |= osRtxMessageQueueWaitGet;
+  }
+  if (MessageQueueSender(mq) != NULL) {
+    wait |= osRtxMessageQueueWaitPut;
+  }
+  mq->fifo_wait = wait;
+}
+
+/// Put a Message into FIFO Queue or timeout if Queue is full.
+/// \param[in]  mq              message queue object.
+/// \param[in]  msg_ptr         pointer to buffer with message to put into a queue.
+/// \param[in]  msg_prio        message priority.
+/// \param[in]  timeout         \ref CMSIS_RTOS_TimeOutValue or 0 in case of no time-out.
+/// \return status code that indicates the execution status of the function.
+static osStatus_t MessageQueueFifoSend (os_message_queue_t *mq, const void *msg_ptr, uint8_t msg_prio, uint32_t timeout) {
+  osStatus_t status;
+  bool_t     done;
+
+  done = MessageQueueFifoPut(mq, msg_ptr, msg_prio);
+  if (!done && (timeout != 0U)) {
+    // Announce waiting sender before the final check
+    mq->fifo_wait |= osRtxMessageQueueWaitPut;
+    __DMB();
+    done = MessageQueueFifoPut(mq, msg_ptr, msg_prio);
+  }
+
+  if (done) {
+    EvrRtxMessageQueueInserted(mq, msg_ptr);
+    if (mq->fifo_wait != 0U) {
+      MessageQueueFifoWakeup(mq, TRUE);
+    }
+    status = osOK;
+  } else {
+    // Ring buffer full
+    if (timeout != 0U) {
+      EvrRtxMessageQueuePutPending(mq, msg_ptr, timeout);
+      // Suspend current Thread
+      if (osRtxThreadWaitEnter(osRtxThreadWaitingMessagePut, timeout)) {
+        osRtxThreadListPut(osRtxObject(mq), osRtxThreadGetRunning());
+      } else {
+        EvrRtxMessageQueuePutTimeout(mq);
       }
-      EvrRtxMessageQueueRetrieved(mq, ptr_dst);
-      // Free memory
-      msg->id = osRtxIdInvalid;
-      (void)osRtxMemoryPoolFree(&mq->mp_info, msg);
+      status = osErrorTimeout;
     } else {
-      EvrRtxMessageQueueInserted(mq, ptr_src);
-      MessageQueuePut(mq, msg);
+      EvrRtxMessageQueueNotInserted(mq, msg_ptr);
+      status = osErrorResource;
     }
   }
+
+  return status;
 }
 
+/// Get a Message from FIFO Queue or timeout if Queue is empty.
+/// \param[in]  mq              message queue object.
+/// \param[out] msg_ptr         pointer to buffer for message to get from a queue.
+/// \param[out] msg_prio        pointer to buffer for message priority or NULL.
+/// \param[in]  timeout         \ref CMSIS_RTOS_TimeOutValue or 0 in case of no time-out.
+/// \return status code that indicates the execution status of the function.
+static osStatus_t MessageQueueFifoReceive (os_message_queue_t *mq, void *msg_ptr, uint8_t *msg_prio, uint32_t timeout) {
+  osStatus_t status;
+  bool_t     done;
+
+  done = MessageQueueFifoGet(mq, msg_ptr, msg_prio);
+  if (!done && (timeout != 0U)) {
+    // Announce waiting receiver before the final check
+    mq->fifo_wait |= osRtxMessageQueueWaitGet;
+    __DMB();
+    done = MessageQueueFifoGet(mq, msg_ptr, msg_prio);
+  }
 
-//  ==== Service Calls ====
+  if (done) {
+    EvrRtxMessageQueueRetrieved(mq, msg_ptr);
+    if (mq->fifo_wait != 0U) {
+      MessageQueueFifoWakeup(mq, TRUE);
+    }
+    status = osOK;
+  } else {
+    // Ring buffer empty
+    if (timeout != 0U) {
+      EvrRtxMessageQueueGetPending(mq, msg_ptr, timeout);
+      // Suspend current Thread
+      if (osRtxThreadWaitEnter(osRtxThreadWaitingMessageGet, timeout)) {
+        osRtxThreadListPut(osRtxObject(mq), osRtxThreadGetRunning());
+      } else {
+        EvrRtxMessageQueueGetTimeout(mq);
+      }
+      status = osErrorTimeout;
+    } else {
+      EvrRtxMessageQueueNotRetrieved(mq, msg_ptr);
+      status = osErrorResource;
+    }
+  }
 
-/// Create and Initialize a Message Queue object.
-/// \note API identical to osMessageQueueNew
-static osMessageQueueId_t svcRtxMessageQueueNew (uint32_t msg_count, uint32_t msg_size, const osMessageQueueAttr_t *attr) {
-  os_message_queue_t *mq;
-#ifdef RTX_SAFETY_CLASS
-  const os_thread_t  *thread = osRtxThreadGetRunning();
-#endif
-  uint32_t            attr_bits;
-  void               *mq_mem;
-  uint32_t            mq_size;
-  uint32_t            block_size;
-  uint32_t            size;
-  uint8_t             flags;
-  const char         *name;
+  return status;
+}
 
-  // Check parameters
-  if ((msg_count == 0U) || (msg_size == 0U) ||
-      ((__CLZ(msg_count) + __CLZ(msg_size)) < 32U)) {
-    EvrRtxMessageQueueError(NULL, (int32_t)osErrorParameter);
+/// Pass Message memory to a Thread waiting to send a Message.
+/// \param[in]  mq              message queue object.
+/// \param[in]  msg             message object.
+/// \param[in]  dispatch        dispatch flag.
+/// \return message object to be delivered or NULL.
+static os_message_t *MessageQueueSenderWakeup (os_message_queue_t *mq, os_message_t *msg, bool_t dispatch) {
+  os_thread_t    *thread;
+  const uintptr_t *reg;
+  const void     *ptr;
+
+  thread = MessageQueueSender(mq);
+  if (thread == NULL) {
+    // Free memory
+    msg->id = osRtxIdInvalid;
+    (void)osRtxMemoryPoolFree(&mq->mp_info, msg);
     //lint -e{904} "Return statement before end of function" [MISRA Note 1]
     return NULL;
   }
 
-  block_size = ((msg_size + 3U) & ~3UL) + sizeof(os_message_t);
-  size       = msg_count * block_size;
+  msg->id = osRtxIdMessage;
+  osRtxThreadListRemove(thread);
+  if (thread->state == osRtxThreadWaitingMessageLoan) {
+    // Loan Message memory to waiting Thread
+    msg->flags    = 1U;
+    msg->priority = 0U;
+    //lint -e{923} "cast from pointer to unsigned int"
+    osRtxThreadWaitExit(thread, (uintptr_t)&msg[1], dispatch);
+    msg = NULL;
+  } else {
+    // Wakeup waiting Thread
+    osRtxThreadWaitExit(thread, (uint32_t)osOK, dispatch);
+    // Copy Message (R1: const void *msg_ptr, R2: uint8_t msg_prio)
+    reg = osRtxThreadRegPtr(thread);
+    //lint -e{923} "cast from unsigned int to pointer"
+    ptr = (const void *)reg[1];
+    (void)memcpy(&msg[1], ptr, mq->msg_size);
+    msg->flags    = 0U;
+    msg->priority = (uint8_t)reg[2];
+    EvrRtxMessageQueueInserted(mq, ptr);
+  }
+
+  return msg;
+}
+
+/// Deliver a Message to a waiting Thread or put it into Queue.
+/// \param[in]  mq              message queue object.
+/// \param[in]  msg             message object.
+/// \param[in]  dispatch        dispatch flag.
+static void MessageQueueDeliver (os_message_queue_t *mq, os_message_t *msg, bool_t dispatch) {
+  os_thread_t    *thread;
+  const uintptr_t *reg;
+  void           *ptr;
+
+  do {
+    thread = MessageQueueReceiver(mq);
+    if (thread == NULL) {
+      MessageQueuePut(mq, msg);
+      msg = NULL;
+#ifdef RTX_THREAD_WAIT_ANY
+      // Wakeup Threads waiting for multiple Objects
+      osRtxThreadWaitAnyNotify(osRtxObject(mq), dispatch);
+#endif
+    } else {
+      osRtxThreadListRemove(thread);
+      if (thread->state == osRtxThreadWaitingMessageRecv) {
+        // Pass Message to waiting Thread (R1: uint8_t *msg_prio)
+        msg->flags = 1U;
+        //lint -e{923} "cast from pointer to unsigned int"
+        osRtxThreadWaitExit(thread, (uintptr_t)&msg[1], dispatch);
+        reg = osRtxThreadRegPtr(thread);
+        if (reg[1] != 0U) {
+          //lint -e{923} -e{9078} "cast from unsigned int to pointer"
+          *((uint8_t *)reg[1]) = msg->priority;
+        }
+        EvrRtxMessageQueueRetrieved(mq, &msg[1]);
+        msg = NULL;
+      } else {
+        // Wakeup waiting Thread
+        osRtxThreadWaitExit(thread, (uint32_t)osOK, dispatch);
+        // Copy Message (R1: void *msg_ptr, R2: uint8_t *msg_prio)
+        reg = osRtxThreadRegPtr(thread);
+        //lint -e{923} "cast from unsigned int to pointer"
+        ptr = (void *)reg[1];
+        (void)memcpy(ptr, &msg[1], mq->msg_size);
+        if (reg[2] != 0U) {
+          //lint -e{923} -e{9078} "cast from unsigned int to pointer"
+          *((uint8_t *)reg[2]) = msg->priority;
+        }
+        EvrRtxMessageQueueRetrieved(mq, ptr);
+        // Reuse Message memory for a waiting sender
+        msg = MessageQueueSenderWakeup(mq, msg, dispatch);
+      }
+    }
+  } while (msg != NULL);
+}
+
+/// Free a Message or pass its memory to a Thread waiting to send a Message.
+/// \param[in]  mq              message queue object.
+/// \param[in]  msg             message object.
+/// \param[in]  dispatch        dispatch flag.
+static void MessageQueueFree (os_message_queue_t *mq, os_message_t *msg, bool_t dispatch) {
+
+  msg = MessageQueueSenderWakeup(mq, msg, dispatch);
+  if (msg != NULL) {
+    MessageQueueDeliver(mq, msg, dispatch);
+  }
+}
+
+/// Insert a Message by passing it to a waiting Thread or putting it into Queue.
+/// \param[in]  mq              message queue object.
+/// \param[in]  msg_ptr         pointer to buffer with message to put into a queue.
+/// \param[in]  msg_prio        message priority.
+/// \param[in]  dispatch        dispatch flag.
+/// \return true - inserted, false - no memory available.
+static bool_t MessageQueueInsert (os_message_queue_t *mq, const void *msg_ptr, uint8_t msg_prio, bool_t dispatch) {
+  os_message_t   *msg;
+  os_thread_t    *thread;
+  const uintptr_t *reg;
+  void           *ptr;
+
+  // Check if Thread is waiting to receive a Message
+  thread = MessageQueueReceiver(mq);
+  if ((thread != NULL) && (thread->state == osRtxThreadWaitingMessageGet)) {
+    EvrRtxMessageQueueInserted(mq, msg_ptr);
+    // Wakeup waiting Thread with highest Priority
+    osRtxThreadListRemove(thread);
+    osRtxThreadWaitExit(thread, (uint32_t)osOK, dispatch);
+    // Copy Message (R1: void *msg_ptr, R2: uint8_t *msg_prio)
+    reg = osRtxThreadRegPtr(thread);
+    //lint -e{923} "cast from unsigned int to pointer"
+    ptr = (void *)reg[1];
+    (void)memcpy(ptr, msg_ptr, mq->msg_size);
+    if (reg[2] != 0U) {
+      //lint -e{923} -e{9078} "cast from unsigned int to pointer"
+      *((uint8_t *)reg[2]) = msg_prio;
+    }
+    EvrRtxMessageQueueRetrieved(mq, ptr);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return TRUE;
+  }
+
+  // Try to allocate memory
+  //lint -e{9079} "conversion from pointer to void to pointer to other type" [MISRA Note 5]
+  msg = osRtxMemoryPoolAlloc(&mq->mp_info);
+  if (msg == NULL) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return FALSE;
+  }
+
+  // Copy Message
+  (void)memcpy(&msg[1], msg_ptr, mq->msg_size);
+  // Put Message into Queue
+  msg->id       = osRtxIdMessage;
+  msg->flags    = 0U;
+  msg->priority = msg_prio;
+  EvrRtxMessageQueueInserted(mq, msg_ptr);
+  MessageQueueDeliver(mq, msg, dispatch);
+
+  return TRUE;
+}
+
+/// Retrieve a Message with highest Priority from Queue.
+/// \param[in]  mq              message queue object.
+/// \param[out] msg_ptr         pointer to buffer for message to get from a queue.
+/// \param[out] msg_prio        pointer to buffer for message priority or NULL.
+/// \param[in]  dispatch        dispatch flag.
+/// \return true - retrieved, false - no message available.
+static bool_t MessageQueueRetrieve (os_message_queue_t *mq, void *msg_ptr, uint8_t *msg_prio, bool_t dispatch) {
+  os_message_t *msg;
+
+  // Get Message from Queue
+  msg = MessageQueueGet(mq);
+  if (msg == NULL) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return FALSE;
+  }
+
+  MessageQueueRemove(mq, msg);
+  // Copy Message
+  (void)memcpy(msg_ptr, &msg[1], mq->msg_size);
+  if (msg_prio != NULL) {
+    *msg_prio = msg->priority;
+  }
+  EvrRtxMessageQueueRetrieved(mq, msg_ptr);
+  // Free memory or pass it to a Thread waiting to send a Message
+  MessageQueueFree(mq, msg, dispatch);
+
+  return TRUE;
+}
+
+/// Get a loaned or received Message object from its data pointer.
+/// \param[in]  mq              message queue object.
+/// \param[in]  msg_ptr         pointer to message data.
+/// \return message object or NULL.
+static os_message_t *MessageQueueBlock (const os_message_queue_t *mq, const void *msg_ptr) {
+  os_message_t *msg;
+  uintptr_t     block;
+
+  // FIFO ring buffer slots are not loaned
+  if ((mq->attr & osRtxAttrFifo) != 0U) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return NULL;
+  }
+
+  //lint --e{923} --e{9078} "cast from pointer to unsigned int" [MISRA Note 7]
+  block = (uintptr_t)msg_ptr - sizeof(os_message_t);
+  if ((block < (uintptr_t)mq->mp_info.block_base) ||
+      (block >= (uintptr_t)mq->mp_info.block_lim) ||
+      (((block - (uintptr_t)mq->mp_info.block_base) % mq->mp_info.block_size) != 0U)) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return NULL;
+  }
+
+  //lint -e{923} -e{9079} "cast from unsigned int to pointer"
+  msg = (os_message_t *)block;
+  if ((msg->id != osRtxIdMessage) || (msg->flags == 0U)) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return NULL;
+  }
+
+  return msg;
+}
+
+/// Wakeup a Thread waiting on a deleted Message Queue.
+/// \param[in]  thread          thread object.
+static void MessageQueueWaitAbort (os_thread_t *thread) {
+  uint32_t ret_val;
+
+  if ((thread->state == osRtxThreadWaitingMessageLoan) ||
+      (thread->state == osRtxThreadWaitingMessageRecv)) {
+    ret_val = 0U;
+  } else {
+    ret_val = (uint32_t)osErrorResource;
+  }
+  osRtxThreadWaitExit(thread, ret_val, FALSE);
+}
+
+/// Verify that Message Queue object pointer is valid.
+/// \param[in]  mq              message queue object.
+/// \return true - valid, false - invalid.
+static bool_t IsMessageQueuePtrValid (const os_message_queue_t *mq) {
+#ifdef RTX_OBJ_PTR_CHECK
+  //lint --e{923} --e{9078} "cast from pointer to unsigned int" [MISRA Note 7]
+  uintptr_t cb_start  = (uintptr_t)&__os_msgqueue_cb_start__;
+  uintptr_t cb_length = (uintptr_t)&__os_msgqueue_cb_length__;
+
+  // Check the section boundaries
+  if (((uintptr_t)mq - cb_start) >= cb_length) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return FALSE;
+  }
+  // Check the object alignment
+  if ((((uintptr_t)mq - cb_start) % sizeof(os_message_queue_t)) != 0U) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return FALSE;
+  }
+#else
+  // Check NULL pointer
+  if (mq == NULL) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return FALSE;
+  }
+#endif
+  return TRUE;
+}
+
+
+//  ==== Library functions ====
+
+/// Destroy a Message Queue object.
+/// \param[in]  mq              message queue object.
+static void osRtxMessageQueueDestroy (os_message_queue_t *mq) {
+
+  // Complete pending post ISR processing
+  if (mq->post_next != NULL) {
+    osRtxPostProcessFlush();
+  }
+
+  // Mark object as invalid
+  mq->id = osRtxIdInvalid;
+
+  // Free data memory
+  if ((mq->flags & osRtxFlagSystemMemory) != 0U) {
+    (void)osRtxMemoryFree(osRtxInfo.mem.mq_data, mq->mp_info.block_base);
+  }
+
+  // Free object memory
+  if ((mq->flags & osRtxFlagSystemObject) != 0U) {
+#ifdef RTX_OBJ_PTR_CHECK
+    (void)osRtxMemoryPoolFree(osRtxInfo.mpi.message_queue, mq);
+#else
+    if (osRtxInfo.mpi.message_queue != NULL) {
+      (void)osRtxMemoryPoolFree(osRtxInfo.mpi.message_queue, mq);
+    } else {
+      (void)osRtxMemoryFree(osRtxInfo.mem.common, mq);
+    }
+#endif
+#ifdef RTX_OBJ_MEM_USAGE
+    osRtxMessageQueueMemUsage.cnt_free++;
+#endif
+  }
+
+  EvrRtxMessageQueueDestroyed(mq);
+}
+
+#ifdef RTX_SAFETY_CLASS
+/// Delete a Message Queue safety class.
+/// \param[in]  safety_class    safety class.
+/// \param[in]  mode            safety mode.
+void osRtxMessageQueueDeleteClass (uint32_t safety_class, uint32_t mode) {
+  os_message_queue_t *mq;
+  os_thread_t        *thread;
+  uint32_t            length;
+
+  //lint --e{923} --e{9078} "cast from pointer to unsigned int" [MISRA Note 7]
+  mq     = (os_message_queue_t *)(uintptr_t)&__os_msgqueue_cb_start__;
+  length =                       (uint32_t)(uintptr_t)&__os_msgqueue_cb_length__;
+  while (length >= sizeof(os_message_queue_t)) {
+    if (   (mq->id == osRtxIdMessageQueue) &&
+        ((((mode & osSafetyWithSameClass)  != 0U) &&
+          ((mq->attr >> osRtxAttrClass_Pos) == (uint8_t)safety_class)) ||
+         (((mode & osSafetyWithLowerClass) != 0U) &&
+          ((mq->attr >> osRtxAttrClass_Pos) <  (uint8_t)safety_class)))) {
+      while (mq->thread_list != NULL) {
+        thread = osRtxThreadListGet(osRtxObject(mq));
+        MessageQueueWaitAbort(thread);
+      }
+#ifdef RTX_THREAD_WAIT_ANY
+      osRtxThreadWaitAnyDelete(osRtxObject(mq), FALSE);
+#endif
+      osRtxMessageQueueDestroy(mq);
+    }
+    length -= sizeof(os_message_queue_t);
+    mq++;
+  }
+}
+#endif
+
+
+//  ==== Post ISR processing ====
+
+/// Message Queue post ISR processing.
+/// \param[in]  mq              message queue object.
+static void osRtxMessageQueuePostProcess (os_message_queue_t *mq) {
+  os_message_t *msg;
+  void         *next;
+
+  // Process Messages in order put or removed from ISR
+  msg = MessageQueuePendGet(mq);
+  while (msg != NULL) {
+    next = *MessageQueuePendLink(msg);
+    if (msg->flags != 0U) {
+      // Remove Message
+      MessageQueueRemove(mq, msg);
+      // Free memory or pass it to a Thread waiting to send a Message
+      MessageQueueFree(mq, msg, FALSE);
+    } else {
+      // New Message
+      //lint -e{9087} "cast between pointers to different object types"
+      EvrRtxMessageQueueInserted(mq, (const void *)msg->prev);
+      // Pass Message to a waiting Thread or put it into Queue
+      MessageQueueDeliver(mq, msg, FALSE);
+    }
+    msg = next;
+  }
+}
+
+/// Message Queue FIFO post ISR processing.
+/// \param[in]  mq              message queue object.
+static void osRtxMessageQueueFifoPostProcess (os_message_queue_t *mq) {
+
+  if (mq->fifo_wait != 0U) {
+    MessageQueueFifoWakeup(mq, FALSE);
+  }
+}
+
+
+//  ==== Service Calls ====
+
+/// Create and Initialize a Message Queue object.
+/// \note API identical to osMessageQueueNew
+static osMessageQueueId_t svcRtxMessageQueueNew (uint32_t msg_count, uint32_t msg_size, const osMessageQueueAttr_t *attr) {
+  os_message_queue_t *mq;
+#ifdef RTX_SAFETY_CLASS
+  const os_thread_t  *thread = osRtxThreadGetRunning();
+#endif
+  uint32_t            attr_bits;
+  void               *mq_mem;
+  uint32_t            mq_size;
+  uint32_t            block_size;
+  uint32_t            size;
+  uint32_t            n;
+  uint8_t             flags;
+  const char         *name;
+
+  // Check parameters
+  if ((msg_count == 0U) || (msg_size == 0U) ||
+      ((__CLZ(msg_count) + __CLZ(msg_size)) < 32U)) {
+    EvrRtxMessageQueueError(NULL, (int32_t)osErrorParameter);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return NULL;
+  }
+
+  block_size = ((msg_size + (uint32_t)sizeof(void *) - 1U) & ~((uint32_t)sizeof(void *) - 1U)) +
+               sizeof(os_message_t);
+  size       = msg_count * block_size;
 
   // Process attributes
   if (attr != NULL) {
@@ -391,7 +1021,7 @@ static osMessageQueueId_t svcRtxMessageQueueNew (uint32_t msg_count, uint32_t ms
     }
     if (mq_mem != NULL) {
       //lint -e{923} "cast from pointer to unsigned int" [MISRA Note 7]
-      if ((((uint32_t)mq_mem & 3U) != 0U) || (mq_size < size)) {
+      if ((((uintptr_t)mq_mem & 3U) != 0U) || (mq_size < size)) {
         EvrRtxMessageQueueError(NULL, osRtxErrorInvalidDataMemory);
         //lint -e{904} "Return statement before end of function" [MISRA Note 1]
         return NULL;
@@ -405,13 +1035,18 @@ static osMessageQueueId_t svcRtxMessageQueueNew (uint32_t msg_count, uint32_t ms
     }
   } else {
     name      = NULL;
-#ifdef RTX_SAFETY_CLASS
     attr_bits = 0U;
-#endif
     mq        = NULL;
     mq_mem    = NULL;
   }
 
+  // Check FIFO ring buffer limits
+  if (((attr_bits & osRtxMessageQueueFifo) != 0U) && (msg_count > 0xFFFFU)) {
+    EvrRtxMessageQueueError(NULL, (int32_t)osErrorParameter);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return NULL;
+  }
+
   // Allocate object memory if not provided
   if (mq == NULL) {
     if (osRtxInfo.mpi.message_queue != NULL) {
@@ -475,6 +1110,13 @@ static osMessageQueueId_t svcRtxMessageQueueNew (uint32_t msg_count, uint32_t ms
     mq->msg_count   = 0U;
     mq->msg_first   = NULL;
     mq->msg_last    = NULL;
+    mq->fifo_head   = 0U;
+    mq->fifo_tail   = 0U;
+    mq->fifo_count  = 0U;
+    mq->fifo_wait   = 0U;
+    mq->post_next   = NULL;
+    mq->msg_pend    = NULL;
+    mq->attr       |= (uint8_t)(attr_bits & osRtxMessageQueueFifoSPSC);
 #ifdef RTX_SAFETY_CLASS
     if ((attr_bits & osSafetyClass_Valid) != 0U) {
       mq->attr     |= (uint8_t)((attr_bits & osSafetyClass_Msk) >>
@@ -487,47 +1129,426 @@ static osMessageQueueId_t svcRtxMessageQueueNew (uint32_t msg_count, uint32_t ms
     }
 #endif
     (void)osRtxMemoryPoolInit(&mq->mp_info, msg_count, block_size, mq_mem);
+    if ((mq->attr & osRtxAttrFifo) != 0U) {
+      // Mark FIFO ring buffer slots as free
+      for (n = 0U; n < msg_count; n++) {
+        MessageQueueFifoSlot(mq, n)->flags = 0U;
+      }
+    }
 
     // Register post ISR processing function
-    osRtxInfo.post_process.message = osRtxMessageQueuePostProcess;
+    osRtxInfo.post_process.message      = osRtxMessageQueuePostProcess;
+    osRtxInfo.post_process.message_fifo = osRtxMessageQueueFifoPostProcess;
 
     EvrRtxMessageQueueCreated(mq, mq->name);
   } else {
     EvrRtxMessageQueueError(NULL, (int32_t)osErrorNoMemory);
   }
 
-  return mq;
+  return mq;
+}
+
+/// Get name of a Message Queue object.
+/// \note API identical to osMessageQueueGetName
+static const char *svcRtxMessageQueueGetName (osMessageQueueId_t mq_id) {
+  os_message_queue_t *mq = osRtxMessageQueueId(mq_id);
+
+  // Check parameters
+  if (!IsMessageQueuePtrValid(mq) || (mq->id != osRtxIdMessageQueue)) {
+    EvrRtxMessageQueueGetName(mq, NULL);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return NULL;
+  }
+
+  EvrRtxMessageQueueGetName(mq, mq->name);
+
+  return mq->name;
+}
+
+/// Put a Message into a Queue or timeout if Queue is full.
+/// \note API identical to osMessageQueuePut
+static osStatus_t svcRtxMessageQueuePut (osMessageQueueId_t mq_id, const void *msg_ptr, uint8_t msg_prio, uint32_t timeout) {
+  os_message_queue_t *mq = osRtxMessageQueueId(mq_id);
+#ifdef RTX_SAFETY_CLASS
+  const os_thread_t  *thread;
+#endif
+  osStatus_t          status;
+
+  // Check parameters
+  if (!IsMessageQueuePtrValid(mq) || (mq->id != osRtxIdMessageQueue) || (msg_ptr == NULL)) {
+    EvrRtxMessageQueueError(mq, (int32_t)osErrorParameter);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return osErrorParameter;
+  }
+
+#ifdef RTX_SAFETY_CLASS
+  // Check running thread safety class
+  thread = osRtxThreadGetRunning();
+  if ((thread != NULL) &&
+      ((thread->attr >> osRtxAttrClass_Pos) < (mq->attr >> osRtxAttrClass_Pos))) {
+    EvrRtxMessageQueueError(mq, (int32_t)osErrorSafetyClass);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return osErrorSafetyClass;
+  }
+#endif
+
+  // Use FIFO ring buffer
+  if ((mq->attr & osRtxAttrFifo) != 0U) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return MessageQueueFifoSend(mq, msg_ptr, msg_prio, timeout);
+  }
+
+  // Pass Message to a waiting Thread or put it into Queue
+  if (MessageQueueInsert(mq, msg_ptr, msg_prio, TRUE)) {
+    status = osOK;
+  } else {
+    // No memory available
+    if (timeout != 0U) {
+      EvrRtxMessageQueuePutPending(mq, msg_ptr, timeout);
+      // Suspend current Thread
+      if (osRtxThreadWaitEnter(osRtxThreadWaitingMessagePut, timeout)) {
+        osRtxThreadListPut(osRtxObject(mq), osRtxThreadGetRunning());
+      } else {
+        EvrRtxMessageQueuePutTimeout(mq);
+      }
+      status = osErrorTimeout;
+    } else {
+      EvrRtxMessageQueueNotInserted(mq, msg_ptr);
+      status = osErrorResource;
+    }
+  }
+
+  return status;
+}
+
+/// Get a Message from a Queue or timeout if Queue is empty.
+/// \note API identical to osMessageQueueGet
+static osStatus_t svcRtxMessageQueueGet (osMessageQueueId_t mq_id, void *msg_ptr, uint8_t *msg_prio, uint32_t timeout) {
+  os_message_queue_t *mq = osRtxMessageQueueId(mq_id);
+#ifdef RTX_SAFETY_CLASS
+  const os_thread_t  *thread;
+#endif
+  osStatus_t          status;
+
+  // Check parameters
+  if (!IsMessageQueuePtrValid(mq) || (mq->id != osRtxIdMessageQueue) || (msg_ptr == NULL)) {
+    EvrRtxMessageQueueError(mq, (int32_t)osErrorParameter);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return osErrorParameter;
+  }
+
+#ifdef RTX_SAFETY_CLASS
+  // Check running thread safety class
+  thread = osRtxThreadGetRunning();
+  if ((thread != NULL) &&
+      ((thread->attr >> osRtxAttrClass_Pos) < (mq->attr >> osRtxAttrClass_Pos))) {
+    EvrRtxMessageQueueError(mq, (int32_t)osErrorSafetyClass);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return osErrorSafetyClass;
+  }
+#endif
+
+  // Use FIFO ring buffer
+  if ((mq->attr & osRtxAttrFifo) != 0U) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return MessageQueueFifoReceive(mq, msg_ptr, msg_prio, timeout);
+  }
+
+  // Get Message from Queue
+  if (MessageQueueRetrieve(mq, msg_ptr, msg_prio, TRUE)) {
+    status = osOK;
+  } else {
+    // No Message available
+    if (timeout != 0U) {
+      EvrRtxMessageQueueGetPending(mq, msg_ptr, timeout);
+      // Suspend current Thread
+      if (osRtxThreadWaitEnter(osRtxThreadWaitingMessageGet, timeout)) {
+        osRtxThreadListPut(osRtxObject(mq), osRtxThreadGetRunning());
+      } else {
+        EvrRtxMessageQueueGetTimeout(mq);
+      }
+      status = osErrorTimeout;
+    } else {
+      EvrRtxMessageQueueNotRetrieved(mq, msg_ptr);
+      status = osErrorResource;
+    }
+  }
+
+  return status;
+}
+
+/// Get maximum number of messages in a Message Queue.
+/// \note API identical to osMessageQueueGetCapacity
+static uint32_t svcRtxMessageQueueGetCapacity (osMessageQueueId_t mq_id) {
+  os_message_queue_t *mq = osRtxMessageQueueId(mq_id);
+
+  // Check parameters
+  if (!IsMessageQueuePtrValid(mq) || (mq->id != osRtxIdMessageQueue)) {
+    EvrRtxMessageQueueGetCapacity(mq, 0U);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return 0U;
+  }
+
+  EvrRtxMessageQueueGetCapacity(mq, mq->mp_info.max_blocks);
+
+  return mq->mp_info.max_blocks;
+}
+
+/// Get maximum message size in a Memory Pool.
+/// \note API identical to osMessageQueueGetMsgSize
+static uint32_t svcRtxMessageQueueGetMsgSize (osMessageQueueId_t mq_id) {
+  os_message_queue_t *mq = osRtxMessageQueueId(mq_id);
+
+  // Check parameters
+  if (!IsMessageQueuePtrValid(mq) || (mq->id != osRtxIdMessageQueue)) {
+    EvrRtxMessageQueueGetMsgSize(mq, 0U);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return 0U;
+  }
+
+  EvrRtxMessageQueueGetMsgSize(mq, mq->msg_size);
+
+  return mq->msg_size;
+}
+
+/// Get number of queued messages in a Message Queue.
+/// \note API identical to osMessageQueueGetCount
+static uint32_t svcRtxMessageQueueGetCount (osMessageQueueId_t mq_id) {
+  os_message_queue_t *mq = osRtxMessageQueueId(mq_id);
+  uint32_t            count;
+
+  // Check parameters
+  if (!IsMessageQueuePtrValid(mq) || (mq->id != osRtxIdMessageQueue)) {
+    EvrRtxMessageQueueGetCount(mq, 0U);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return 0U;
+  }
+
+  if ((mq->attr & osRtxAttrFifo) != 0U) {
+    count = MessageQueueFifoCount(mq);
+  } else {
+    count = mq->msg_count;
+  }
+
+  EvrRtxMessageQueueGetCount(mq, count);
+
+  return count;
+}
+
+/// Get number of available slots for messages in a Message Queue.
+/// \note API identical to osMessageQueueGetSpace
+static uint32_t svcRtxMessageQueueGetSpace (osMessageQueueId_t mq_id) {
+  os_message_queue_t *mq = osRtxMessageQueueId(mq_id);
+  uint32_t            space;
+
+  // Check parameters
+  if (!IsMessageQueuePtrValid(mq) || (mq->id != osRtxIdMessageQueue)) {
+    EvrRtxMessageQueueGetSpace(mq, 0U);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return 0U;
+  }
+
+  if ((mq->attr & osRtxAttrFifo) != 0U) {
+    space = mq->mp_info.max_blocks - MessageQueueFifoCount(mq);
+    EvrRtxMessageQueueGetSpace(mq, space);
+  } else {
+    space = mq->mp_info.max_blocks - mq->mp_info.used_blocks;
+    EvrRtxMessageQueueGetSpace(mq, mq->mp_info.max_blocks - mq->msg_count);
+  }
+
+  return space;
+}
+
+/// Reset a Message Queue to initial empty state.
+/// \note API identical to osMessageQueueReset
+static osStatus_t svcRtxMessageQueueReset (osMessageQueueId_t mq_id) {
+  os_message_queue_t *mq = osRtxMessageQueueId(mq_id);
+  os_message_t       *msg;
+#ifdef RTX_SAFETY_CLASS
+  const os_thread_t  *thread;
+#endif
+
+  // Check parameters
+  if (!IsMessageQueuePtrValid(mq) || (mq->id != osRtxIdMessageQueue)) {
+    EvrRtxMessageQueueError(mq, (int32_t)osErrorParameter);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return osErrorParameter;
+  }
+
+#ifdef RTX_SAFETY_CLASS
+  // Check running thread safety class
+  thread = osRtxThreadGetRunning();
+  if ((thread != NULL) &&
+      ((thread->attr >> osRtxAttrClass_Pos) < (mq->attr >> osRtxAttrClass_Pos))) {
+    EvrRtxMessageQueueError(mq, (int32_t)osErrorSafetyClass);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return osErrorSafetyClass;
+  }
+#endif
+
+  // Remove Messages from FIFO ring buffer
+  if ((mq->attr & osRtxAttrFifo) != 0U) {
+    while (MessageQueueFifoGet(mq, NULL, NULL)) {
+      EvrRtxMessageQueueRetrieved(mq, NULL);
+    }
+    if (mq->fifo_wait != 0U) {
+      MessageQueueFifoWakeup(mq, FALSE);
+      osRtxThreadDispatch(NULL);
+    }
+    EvrRtxMessageQueueResetDone(mq);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return osOK;
+  }
+
+  // Remove Messages from Queue
+  for (;;) {
+    // Get Message from Queue
+    msg = MessageQueueGet(mq);
+    if (msg == NULL) {
+      break;
+    }
+    MessageQueueRemove(mq, msg);
+    EvrRtxMessageQueueRetrieved(mq, NULL);
+    // Free memory
+    msg->id = osRtxIdInvalid;
+    (void)osRtxMemoryPoolFree(&mq->mp_info, msg);
+  }
+
+  // Check if Threads are waiting to send Messages
+  if (MessageQueueSender(mq) != NULL) {
+    do {
+      // Try to allocate memory
+      //lint -e{9079} "conversion from pointer to void to pointer to other type" [MISRA Note 5]
+      msg = osRtxMemoryPoolAlloc(&mq->mp_info);
+      if (msg != NULL) {
+        // Pass memory to waiting Thread with highest Priority
+        MessageQueueFree(mq, msg, FALSE);
+      }
+    } while ((msg != NULL) && (MessageQueueSender(mq) != NULL));
+    osRtxThreadDispatch(NULL);
+  }
+
+  EvrRtxMessageQueueResetDone(mq);
+
+  return osOK;
+}
+
+/// Delete a Message Queue object.
+/// \note API identical to osMessageQueueDelete
+static osStatus_t svcRtxMessageQueueDelete (osMessageQueueId_t mq_id) {
+  os_message_queue_t *mq = osRtxMessageQueueId(mq_id);
+  os_thread_t        *thread;
+
+  // Check parameters
+  if (!IsMessageQueuePtrValid(mq) || (mq->id != osRtxIdMessageQueue)) {
+    EvrRtxMessageQueueError(mq, (int32_t)osErrorParameter);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return osErrorParameter;
+  }
+
+#ifdef RTX_SAFETY_CLASS
+  // Check running thread safety class
+  thread = osRtxThreadGetRunning();
+  if ((thread != NULL) &&
+      ((thread->attr >> osRtxAttrClass_Pos) < (mq->attr >> osRtxAttrClass_Pos))) {
+    EvrRtxMessageQueueError(mq, (int32_t)osErrorSafetyClass);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return osErrorSafetyClass;
+  }
+#endif
+
+  // Unblock waiting threads
+  if (mq->thread_list != NULL) {
+    do {
+      thread = osRtxThreadListGet(osRtxObject(mq));
+      MessageQueueWaitAbort(thread);
+    } while (mq->thread_list != NULL);
+    osRtxThreadDispatch(NULL);
+  }
+#ifdef RTX_THREAD_WAIT_ANY
+  // Unblock Threads waiting for multiple Objects
+  osRtxThreadWaitAnyDelete(osRtxObject(mq), TRUE);
+#endif
+
+  osRtxMessageQueueDestroy(mq);
+
+  return osOK;
 }
 
-/// Get name of a Message Queue object.
-/// \note API identical to osMessageQueueGetName
-static const char *svcRtxMessageQueueGetName (osMessageQueueId_t mq_id) {
+/// Loan a Message memory slot from a Queue or timeout if Queue is full.
+/// \note API identical to osRtxMessageQueueLoan
+static void *svcRtxMessageQueueLoan (osMessageQueueId_t mq_id, uint32_t timeout) {
   os_message_queue_t *mq = osRtxMessageQueueId(mq_id);
+  os_message_t       *msg;
+#ifdef RTX_SAFETY_CLASS
+  const os_thread_t  *thread;
+#endif
+  void               *ptr;
 
   // Check parameters
-  if (!IsMessageQueuePtrValid(mq) || (mq->id != osRtxIdMessageQueue)) {
-    EvrRtxMessageQueueGetName(mq, NULL);
+  if (!IsMessageQueuePtrValid(mq) || (mq->id != osRtxIdMessageQueue) ||
+      ((mq->attr & osRtxAttrFifo) != 0U)) {
+    EvrRtxMessageQueueError(mq, (int32_t)osErrorParameter);
     //lint -e{904} "Return statement before end of function" [MISRA Note 1]
     return NULL;
   }
 
-  EvrRtxMessageQueueGetName(mq, mq->name);
+#ifdef RTX_SAFETY_CLASS
+  // Check running thread safety class
+  thread = osRtxThreadGetRunning();
+  if ((thread != NULL) &&
+      ((thread->attr >> osRtxAttrClass_Pos) < (mq->attr >> osRtxAttrClass_Pos))) {
+    EvrRtxMessageQueueError(mq, (int32_t)osErrorSafetyClass);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return NULL;
+  }
+#endif
 
-  return mq->name;
+  // Try to allocate memory
+  //lint -e{9079} "conversion from pointer to void to pointer to other type" [MISRA Note 5]
+  msg = osRtxMemoryPoolAlloc(&mq->mp_info);
+  if (msg != NULL) {
+    // Mark Message as loaned
+    msg->id       = osRtxIdMessage;
+    msg->flags    = 1U;
+    msg->priority = 0U;
+    ptr = &msg[1];
+  } else {
+    // No memory available
+    if (timeout != 0U) {
+      EvrRtxMessageQueuePutPending(mq, NULL, timeout);
+      // Suspend current Thread
+      if (osRtxThreadWaitEnter(osRtxThreadWaitingMessageLoan, timeout)) {
+        osRtxThreadListPut(osRtxObject(mq), osRtxThreadGetRunning());
+      } else {
+        EvrRtxMessageQueuePutTimeout(mq);
+      }
+    } else {
+      EvrRtxMessageQueueNotInserted(mq, NULL);
+    }
+    ptr = NULL;
+  }
+
+  return ptr;
 }
 
-/// Put a Message into a Queue or timeout if Queue is full.
-/// \note API identical to osMessageQueuePut
-static osStatus_t svcRtxMessageQueuePut (osMessageQueueId_t mq_id, const void *msg_ptr, uint8_t msg_prio, uint32_t timeout) {
+/// Commit a loaned Message into a Queue.
+/// \note API identical to osRtxMessageQueueCommit
+static osStatus_t svcRtxMessageQueueCommit (osMessageQueueId_t mq_id, void *msg_ptr, uint8_t msg_prio) {
   os_message_queue_t *mq = osRtxMessageQueueId(mq_id);
   os_message_t       *msg;
-  os_thread_t        *thread;
-  const uint32_t     *reg;
-  void               *ptr;
-  osStatus_t          status;
+#ifdef RTX_SAFETY_CLASS
+  const os_thread_t  *thread;
+#endif
 
   // Check parameters
-  if (!IsMessageQueuePtrValid(mq) || (mq->id != osRtxIdMessageQueue) || (msg_ptr == NULL)) {
+  if (!IsMessageQueuePtrValid(mq) || (mq->id != osRtxIdMessageQueue)) {
+    EvrRtxMessageQueueError(mq, (int32_t)osErrorParameter);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return osErrorParameter;
+  }
+  msg = MessageQueueBlock(mq, msg_ptr);
+  if (msg == NULL) {
     EvrRtxMessageQueueError(mq, (int32_t)osErrorParameter);
     //lint -e{904} "Return statement before end of function" [MISRA Note 1]
     return osErrorParameter;
@@ -544,73 +1565,31 @@ static osStatus_t svcRtxMessageQueuePut (osMessageQueueId_t mq_id, const void *m
   }
 #endif
 
-  // Check if Thread is waiting to receive a Message
-  if ((mq->thread_list != NULL) && (mq->thread_list->state == osRtxThreadWaitingMessageGet)) {
-    EvrRtxMessageQueueInserted(mq, msg_ptr);
-    // Wakeup waiting Thread with highest Priority
-    thread = osRtxThreadListGet(osRtxObject(mq));
-    osRtxThreadWaitExit(thread, (uint32_t)osOK, TRUE);
-    // Copy Message (R1: void *msg_ptr, R2: uint8_t *msg_prio)
-    reg = osRtxThreadRegPtr(thread);
-    //lint -e{923} "cast from unsigned int to pointer"
-    ptr = (void *)reg[1];
-    (void)memcpy(ptr, msg_ptr, mq->msg_size);
-    if (reg[2] != 0U) {
-      //lint -e{923} -e{9078} "cast from unsigned int to pointer"
-      *((uint8_t *)reg[2]) = msg_prio;
-    }
-    EvrRtxMessageQueueRetrieved(mq, ptr);
-    status = osOK;
-  } else {
-    // Try to allocate memory
-    //lint -e{9079} "conversion from pointer to void to pointer to other type" [MISRA Note 5]
-    msg = osRtxMemoryPoolAlloc(&mq->mp_info);
-    if (msg != NULL) {
-      // Copy Message
-      (void)memcpy(&msg[1], msg_ptr, mq->msg_size);
-      // Put Message into Queue
-      msg->id       = osRtxIdMessage;
-      msg->flags    = 0U;
-      msg->priority = msg_prio;
-      MessageQueuePut(mq, msg);
-      EvrRtxMessageQueueInserted(mq, msg_ptr);
-      status = osOK;
-    } else {
-      // No memory available
-      if (timeout != 0U) {
-        EvrRtxMessageQueuePutPending(mq, msg_ptr, timeout);
-        // Suspend current Thread
-        if (osRtxThreadWaitEnter(osRtxThreadWaitingMessagePut, timeout)) {
-          osRtxThreadListPut(osRtxObject(mq), osRtxThreadGetRunning());
-        } else {
-          EvrRtxMessageQueuePutTimeout(mq);
-        }
-        status = osErrorTimeout;
-      } else {
-        EvrRtxMessageQueueNotInserted(mq, msg_ptr);
-        status = osErrorResource;
-      }
-    }
-  }
+  // Pass Message to a waiting Thread or put it into Queue
+  msg->flags    = 0U;
+  msg->priority = msg_prio;
+  EvrRtxMessageQueueInserted(mq, msg_ptr);
+  MessageQueueDeliver(mq, msg, TRUE);
 
-  return status;
+  return osOK;
 }
 
-/// Get a Message from a Queue or timeout if Queue is empty.
-/// \note API identical to osMessageQueueGet
-static osStatus_t svcRtxMessageQueueGet (osMessageQueueId_t mq_id, void *msg_ptr, uint8_t *msg_prio, uint32_t timeout) {
+/// Receive a Message from a Queue without copying or timeout if Queue is empty.
+/// \note API identical to osRtxMessageQueueReceive
+static void *svcRtxMessageQueueReceive (osMessageQueueId_t mq_id, uint8_t *msg_prio, uint32_t timeout) {
   os_message_queue_t *mq = osRtxMessageQueueId(mq_id);
   os_message_t       *msg;
-  os_thread_t        *thread;
-  const uint32_t     *reg;
-  const void         *ptr;
-  osStatus_t          status;
+#ifdef RTX_SAFETY_CLASS
+  const os_thread_t  *thread;
+#endif
+  void               *ptr;
 
   // Check parameters
-  if (!IsMessageQueuePtrValid(mq) || (mq->id != osRtxIdMessageQueue) || (msg_ptr == NULL)) {
+  if (!IsMessageQueuePtrValid(mq) || (mq->id != osRtxIdMessageQueue) ||
+      ((mq->attr & osRtxAttrFifo) != 0U)) {
     EvrRtxMessageQueueError(mq, (int32_t)osErrorParameter);
     //lint -e{904} "Return statement before end of function" [MISRA Note 1]
-    return osErrorParameter;
+    return NULL;
   }
 
 #ifdef RTX_SAFETY_CLASS
@@ -620,7 +1599,7 @@ static osStatus_t svcRtxMessageQueueGet (osMessageQueueId_t mq_id, void *msg_ptr
       ((thread->attr >> osRtxAttrClass_Pos) < (mq->attr >> osRtxAttrClass_Pos))) {
     EvrRtxMessageQueueError(mq, (int32_t)osErrorSafetyClass);
     //lint -e{904} "Return statement before end of function" [MISRA Note 1]
-    return osErrorSafetyClass;
+    return NULL;
   }
 #endif
 
@@ -628,140 +1607,159 @@ static osStatus_t svcRtxMessageQueueGet (osMessageQueueId_t mq_id, void *msg_ptr
   msg = MessageQueueGet(mq);
   if (msg != NULL) {
     MessageQueueRemove(mq, msg);
-    // Copy Message
-    (void)memcpy(msg_ptr, &msg[1], mq->msg_size);
     if (msg_prio != NULL) {
       *msg_prio = msg->priority;
     }
-    EvrRtxMessageQueueRetrieved(mq, msg_ptr);
-    // Free memory
-    msg->id = osRtxIdInvalid;
-    (void)osRtxMemoryPoolFree(&mq->mp_info, msg);
-    // Check if Thread is waiting to send a Message
-    if (mq->thread_list != NULL) {
-      // Try to allocate memory
-      //lint -e{9079} "conversion from pointer to void to pointer to other type" [MISRA Note 5]
-      msg = osRtxMemoryPoolAlloc(&mq->mp_info);
-      if (msg != NULL) {
-        // Wakeup waiting Thread with highest Priority
-        thread = osRtxThreadListGet(osRtxObject(mq));
-        osRtxThreadWaitExit(thread, (uint32_t)osOK, TRUE);
-        // Copy Message (R1: const void *msg_ptr, R2: uint8_t msg_prio)
-        reg = osRtxThreadRegPtr(thread);
-        //lint -e{923} "cast from unsigned int to pointer"
-        ptr = (const void *)reg[1];
-        (void)memcpy(&msg[1], ptr, mq->msg_size);
-        // Store Message into Queue
-        msg->id       = osRtxIdMessage;
-        msg->flags    = 0U;
-        msg->priority = (uint8_t)reg[2];
-        MessageQueuePut(mq, msg);
-        EvrRtxMessageQueueInserted(mq, ptr);
-      }
-    }
-    status = osOK;
+    ptr = &msg[1];
+    EvrRtxMessageQueueRetrieved(mq, ptr);
   } else {
     // No Message available
     if (timeout != 0U) {
-      EvrRtxMessageQueueGetPending(mq, msg_ptr, timeout);
+      EvrRtxMessageQueueGetPending(mq, NULL, timeout);
       // Suspend current Thread
-      if (osRtxThreadWaitEnter(osRtxThreadWaitingMessageGet, timeout)) {
+      if (osRtxThreadWaitEnter(osRtxThreadWaitingMessageRecv, timeout)) {
         osRtxThreadListPut(osRtxObject(mq), osRtxThreadGetRunning());
       } else {
         EvrRtxMessageQueueGetTimeout(mq);
       }
-      status = osErrorTimeout;
     } else {
-      EvrRtxMessageQueueNotRetrieved(mq, msg_ptr);
-      status = osErrorResource;
+      EvrRtxMessageQueueNotRetrieved(mq, NULL);
     }
+    ptr = NULL;
   }
 
-  return status;
+  return ptr;
 }
 
-/// Get maximum number of messages in a Message Queue.
-/// \note API identical to osMessageQueueGetCapacity
-static uint32_t svcRtxMessageQueueGetCapacity (osMessageQueueId_t mq_id) {
+/// Release a received or loaned Message back to a Queue.
+/// \note API identical to osRtxMessageQueueRelease
+static osStatus_t svcRtxMessageQueueRelease (osMessageQueueId_t mq_id, void *msg_ptr) {
   os_message_queue_t *mq = osRtxMessageQueueId(mq_id);
+  os_message_t       *msg;
+#ifdef RTX_SAFETY_CLASS
+  const os_thread_t  *thread;
+#endif
 
   // Check parameters
   if (!IsMessageQueuePtrValid(mq) || (mq->id != osRtxIdMessageQueue)) {
-    EvrRtxMessageQueueGetCapacity(mq, 0U);
+    EvrRtxMessageQueueError(mq, (int32_t)osErrorParameter);
     //lint -e{904} "Return statement before end of function" [MISRA Note 1]
-    return 0U;
+    return osErrorParameter;
+  }
+  msg = MessageQueueBlock(mq, msg_ptr);
+  if (msg == NULL) {
+    EvrRtxMessageQueueError(mq, (int32_t)osErrorParameter);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return osErrorParameter;
   }
 
-  EvrRtxMessageQueueGetCapacity(mq, mq->mp_info.max_blocks);
+#ifdef RTX_SAFETY_CLASS
+  // Check running thread safety class
+  thread = osRtxThreadGetRunning();
+  if ((thread != NULL) &&
+      ((thread->attr >> osRtxAttrClass_Pos) < (mq->attr >> osRtxAttrClass_Pos))) {
+    EvrRtxMessageQueueError(mq, (int32_t)osErrorSafetyClass);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return osErrorSafetyClass;
+  }
+#endif
 
-  return mq->mp_info.max_blocks;
+  // Free memory or pass it to a Thread waiting to send a Message
+  MessageQueueFree(mq, msg, TRUE);
+
+  return osOK;
 }
 
-/// Get maximum message size in a Memory Pool.
-/// \note API identical to osMessageQueueGetMsgSize
-static uint32_t svcRtxMessageQueueGetMsgSize (osMessageQueueId_t mq_id) {
+/// Put multiple Messages into a Queue without waiting.
+/// \note API identical to osRtxMessageQueuePutN (without timeout)
+static uint32_t svcRtxMessageQueuePutN (osMessageQueueId_t mq_id, const void *msg_ptr, uint32_t msg_count, uint8_t msg_prio) {
   os_message_queue_t *mq = osRtxMessageQueueId(mq_id);
+#ifdef RTX_SAFETY_CLASS
+  const os_thread_t  *thread;
+#endif
+  const uint8_t      *ptr;
+  bool_t              dispatch;
+  uint32_t            count;
 
   // Check parameters
-  if (!IsMessageQueuePtrValid(mq) || (mq->id != osRtxIdMessageQueue)) {
-    EvrRtxMessageQueueGetMsgSize(mq, 0U);
+  if (!IsMessageQueuePtrValid(mq) || (mq->id != osRtxIdMessageQueue) || (msg_ptr == NULL)) {
+    EvrRtxMessageQueueError(mq, (int32_t)osErrorParameter);
     //lint -e{904} "Return statement before end of function" [MISRA Note 1]
     return 0U;
   }
 
-  EvrRtxMessageQueueGetMsgSize(mq, mq->msg_size);
-
-  return mq->msg_size;
-}
-
-/// Get number of queued messages in a Message Queue.
-/// \note API identical to osMessageQueueGetCount
-static uint32_t svcRtxMessageQueueGetCount (osMessageQueueId_t mq_id) {
-  os_message_queue_t *mq = osRtxMessageQueueId(mq_id);
-
-  // Check parameters
-  if (!IsMessageQueuePtrValid(mq) || (mq->id != osRtxIdMessageQueue)) {
-    EvrRtxMessageQueueGetCount(mq, 0U);
+#ifdef RTX_SAFETY_CLASS
+  // Check running thread safety class
+  thread = osRtxThreadGetRunning();
+  if ((thread != NULL) &&
+      ((thread->attr >> osRtxAttrClass_Pos) < (mq->attr >> osRtxAttrClass_Pos))) {
+    EvrRtxMessageQueueError(mq, (int32_t)osErrorSafetyClass);
     //lint -e{904} "Return statement before end of function" [MISRA Note 1]
     return 0U;
   }
+#endif
 
-  EvrRtxMessageQueueGetCount(mq, mq->msg_count);
+  //lint -e{9079} "conversion from pointer to void to pointer to other type" [MISRA Note 5]
+  ptr = msg_ptr;
 
-  return mq->msg_count;
-}
+  // Use FIFO ring buffer
+  if ((mq->attr & osRtxAttrFifo) != 0U) {
+    for (count = 0U; count < msg_count; count++) {
+      if (!MessageQueueFifoPut(mq, ptr, msg_prio)) {
+        break;
+      }
+      EvrRtxMessageQueueInserted(mq, ptr);
+      ptr = &ptr[mq->msg_size];
+    }
+    if (count == 0U) {
+      EvrRtxMessageQueueNotInserted(mq, msg_ptr);
+    } else if (mq->fifo_wait != 0U) {
+      MessageQueueFifoWakeup(mq, TRUE);
+    } else {
+      // No waiting Threads
+    }
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return count;
+  }
 
-/// Get number of available slots for messages in a Message Queue.
-/// \note API identical to osMessageQueueGetSpace
-static uint32_t svcRtxMessageQueueGetSpace (osMessageQueueId_t mq_id) {
-  os_message_queue_t *mq = osRtxMessageQueueId(mq_id);
+  // Threads can only be woken up when they are already waiting
+  dispatch = (mq->thread_list != NULL) ? TRUE : FALSE;
 
-  // Check parameters
-  if (!IsMessageQueuePtrValid(mq) || (mq->id != osRtxIdMessageQueue)) {
-    EvrRtxMessageQueueGetSpace(mq, 0U);
-    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
-    return 0U;
+  // Pass Messages to waiting Threads or put them into Queue
+  for (count = 0U; count < msg_count; count++) {
+    if (!MessageQueueInsert(mq, ptr, msg_prio, FALSE)) {
+      break;
+    }
+    ptr = &ptr[mq->msg_size];
+  }
+  if (count == 0U) {
+    EvrRtxMessageQueueNotInserted(mq, msg_ptr);
   }
 
-  EvrRtxMessageQueueGetSpace(mq, mq->mp_info.max_blocks - mq->msg_count);
+  if (dispatch) {
+    osRtxThreadDispatch(NULL);
+  }
 
-  return (mq->mp_info.max_blocks - mq->mp_info.used_blocks);
+  return count;
 }
 
-/// Reset a Message Queue to initial empty state.
-/// \note API identical to osMessageQueueReset
-static osStatus_t svcRtxMessageQueueReset (osMessageQueueId_t mq_id) {
+/// Get multiple Messages from a Queue without waiting.
+/// \note API identical to osRtxMessageQueueGetN (without timeout)
+static uint32_t svcRtxMessageQueueGetN (osMessageQueueId_t mq_id, void *msg_ptr, uint32_t msg_count, uint8_t *msg_prio) {
   os_message_queue_t *mq = osRtxMessageQueueId(mq_id);
-  os_message_t       *msg;
-  os_thread_t        *thread;
-  const uint32_t     *reg;
-  const void         *ptr;
+#ifdef RTX_SAFETY_CLASS
+  const os_thread_t  *thread;
+#endif
+  uint8_t            *ptr;
+  uint8_t            *prio;
+  bool_t              dispatch;
+  uint32_t            count;
 
   // Check parameters
-  if (!IsMessageQueuePtrValid(mq) || (mq->id != osRtxIdMessageQueue)) {
+  if (!IsMessageQueuePtrValid(mq) || (mq->id != osRtxIdMessageQueue) || (msg_ptr == NULL)) {
     EvrRtxMessageQueueError(mq, (int32_t)osErrorParameter);
     //lint -e{904} "Return statement before end of function" [MISRA Note 1]
-    return osErrorParameter;
+    return 0U;
   }
 
 #ifdef RTX_SAFETY_CLASS
@@ -771,91 +1769,75 @@ static osStatus_t svcRtxMessageQueueReset (osMessageQueueId_t mq_id) {
       ((thread->attr >> osRtxAttrClass_Pos) < (mq->attr >> osRtxAttrClass_Pos))) {
     EvrRtxMessageQueueError(mq, (int32_t)osErrorSafetyClass);
     //lint -e{904} "Return statement before end of function" [MISRA Note 1]
-    return osErrorSafetyClass;
+    return 0U;
   }
 #endif
 
-  // Remove Messages from Queue
-  for (;;) {
-    // Get Message from Queue
-    msg = MessageQueueGet(mq);
-    if (msg == NULL) {
+  //lint -e{9079} "conversion from pointer to void to pointer to other type" [MISRA Note 5]
+  ptr  = msg_ptr;
+  prio = msg_prio;
+
+  // Use FIFO ring buffer
+  if ((mq->attr & osRtxAttrFifo) != 0U) {
+    for (count = 0U; count < msg_count; count++) {
+      if (!MessageQueueFifoGet(mq, ptr, prio)) {
+        break;
+      }
+      EvrRtxMessageQueueRetrieved(mq, ptr);
+      ptr = &ptr[mq->msg_size];
+      if (prio != NULL) {
+        prio++;
+      }
+    }
+    if (count == 0U) {
+      EvrRtxMessageQueueNotRetrieved(mq, msg_ptr);
+    } else if (mq->fifo_wait != 0U) {
+      MessageQueueFifoWakeup(mq, TRUE);
+    } else {
+      // No waiting Threads
+    }
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return count;
+  }
+
+  // Threads can only be woken up when they are already waiting
+  dispatch = (mq->thread_list != NULL) ? TRUE : FALSE;
+
+  // Get Messages from Queue in Priority order (freed memory is passed to waiting senders)
+  for (count = 0U; count < msg_count; count++) {
+    if (!MessageQueueRetrieve(mq, ptr, prio, FALSE)) {
       break;
     }
-    MessageQueueRemove(mq, msg);
-    EvrRtxMessageQueueRetrieved(mq, NULL);
-    // Free memory
-    msg->id = osRtxIdInvalid;
-    (void)osRtxMemoryPoolFree(&mq->mp_info, msg);
+    ptr = &ptr[mq->msg_size];
+    if (prio != NULL) {
+      prio++;
+    }
+  }
+  if (count == 0U) {
+    EvrRtxMessageQueueNotRetrieved(mq, msg_ptr);
   }
 
-  // Check if Threads are waiting to send Messages
-  if ((mq->thread_list != NULL) && (mq->thread_list->state == osRtxThreadWaitingMessagePut)) {
-    do {
-      // Try to allocate memory
-      //lint -e{9079} "conversion from pointer to void to pointer to other type" [MISRA Note 5]
-      msg = osRtxMemoryPoolAlloc(&mq->mp_info);
-      if (msg != NULL) {
-        // Wakeup waiting Thread with highest Priority
-        thread = osRtxThreadListGet(osRtxObject(mq));
-        osRtxThreadWaitExit(thread, (uint32_t)osOK, FALSE);
-        // Copy Message (R1: const void *msg_ptr, R2: uint8_t msg_prio)
-        reg = osRtxThreadRegPtr(thread);
-        //lint -e{923} "cast from unsigned int to pointer"
-        ptr = (const void *)reg[1];
-        (void)memcpy(&msg[1], ptr, mq->msg_size);
-        // Store Message into Queue
-        msg->id       = osRtxIdMessage;
-        msg->flags    = 0U;
-        msg->priority = (uint8_t)reg[2];
-        MessageQueuePut(mq, msg);
-        EvrRtxMessageQueueInserted(mq, ptr);
-      }
-    } while ((msg != NULL) && (mq->thread_list != NULL));
+  if (dispatch) {
     osRtxThreadDispatch(NULL);
   }
 
-  EvrRtxMessageQueueResetDone(mq);
-
-  return osOK;
+  return count;
 }
 
-/// Delete a Message Queue object.
-/// \note API identical to osMessageQueueDelete
-static osStatus_t svcRtxMessageQueueDelete (osMessageQueueId_t mq_id) {
+/// Resume Threads waiting on a FIFO Message Queue.
+/// \note No API equivalent (called by osMessageQueuePut and osMessageQueueGet after a FIFO transfer)
+static void svcRtxMessageQueueFifoWakeup (osMessageQueueId_t mq_id) {
   os_message_queue_t *mq = osRtxMessageQueueId(mq_id);
-  os_thread_t        *thread;
 
   // Check parameters
-  if (!IsMessageQueuePtrValid(mq) || (mq->id != osRtxIdMessageQueue)) {
+  if (!IsMessageQueuePtrValid(mq) || (mq->id != osRtxIdMessageQueue) ||
+      ((mq->attr & osRtxAttrFifo) == 0U)) {
     EvrRtxMessageQueueError(mq, (int32_t)osErrorParameter);
     //lint -e{904} "Return statement before end of function" [MISRA Note 1]
-    return osErrorParameter;
-  }
-
-#ifdef RTX_SAFETY_CLASS
-  // Check running thread safety class
-  thread = osRtxThreadGetRunning();
-  if ((thread != NULL) &&
-      ((thread->attr >> osRtxAttrClass_Pos) < (mq->attr >> osRtxAttrClass_Pos))) {
-    EvrRtxMessageQueueError(mq, (int32_t)osErrorSafetyClass);
-    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
-    return osErrorSafetyClass;
-  }
-#endif
-
-  // Unblock waiting threads
-  if (mq->thread_list != NULL) {
-    do {
-      thread = osRtxThreadListGet(osRtxObject(mq));
-      osRtxThreadWaitExit(thread, (uint32_t)osErrorResource, FALSE);
-    } while (mq->thread_list != NULL);
-    osRtxThreadDispatch(NULL);
+    return;
   }
 
-  osRtxMessageQueueDestroy(mq);
-
-  return osOK;
+  MessageQueueFifoWakeup(mq, TRUE);
 }
 
 //  Service Calls definitions
@@ -870,6 +1852,13 @@ SVC0_1(MessageQueueGetCount,    uint32_t,           osMessageQueueId_t)
 SVC0_1(MessageQueueGetSpace,    uint32_t,           osMessageQueueId_t)
 SVC0_1(MessageQueueReset,       osStatus_t,         osMessageQueueId_t)
 SVC0_1(MessageQueueDelete,      osStatus_t,         osMessageQueueId_t)
+SVC0_2(MessageQueueLoan,        void *,             osMessageQueueId_t, uint32_t)
+SVC0_3(MessageQueueCommit,      osStatus_t,         osMessageQueueId_t, void *, uint8_t)
+SVC0_3(MessageQueueReceive,     void *,             osMessageQueueId_t, uint8_t *, uint32_t)
+SVC0_2(MessageQueueRelease,     osStatus_t,         osMessageQueueId_t, void *)
+SVC0_4(MessageQueuePutN,        uint32_t,           osMessageQueueId_t, const void *, uint32_t, uint8_t)
+SVC0_4(MessageQueueGetN,        uint32_t,           osMessageQueueId_t,       void *, uint32_t, uint8_t *)
+SVC0_1N(MessageQueueFifoWakeup, void,               osMessageQueueId_t)
 //lint --flb "Library End"
 
 
@@ -890,6 +1879,24 @@ osStatus_t isrRtxMessageQueuePut (osMessageQueueId_t mq_id, const void *msg_ptr,
     return osErrorParameter;
   }
 
+  // Use FIFO ring buffer
+  if ((mq->attr & osRtxAttrFifo) != 0U) {
+    if (MessageQueueFifoPut(mq, msg_ptr, msg_prio)) {
+      EvrRtxMessageQueueInserted(mq, msg_ptr);
+      __DMB();
+      if (mq->fifo_wait != 0U) {
+        // Register post ISR processing
+        osRtxPostProcess(osRtxObject(mq));
+      }
+      status = osOK;
+    } else {
+      EvrRtxMessageQueueNotInserted(mq, msg_ptr);
+      status = osErrorResource;
+    }
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return status;
+  }
+
   // Try to allocate memory
   //lint -e{9079} "conversion from pointer to void to pointer to other type" [MISRA Note 5]
   msg = osRtxMemoryPoolAlloc(&mq->mp_info);
@@ -902,9 +1909,8 @@ osStatus_t isrRtxMessageQueuePut (osMessageQueueId_t mq_id, const void *msg_ptr,
     // Register post ISR processing
     //lint -e{9079} -e{9087} "cast between pointers to different object types"
     *((const void **)(void *)&msg->prev) = msg_ptr;
-    //lint -e{9079} -e{9087} "cast between pointers to different object types"
-    *(      (void **)        &msg->next) = mq;
-    osRtxPostProcess(osRtxObject(msg));
+    MessageQueuePendPut(mq, msg);
+    osRtxPostProcess(osRtxObject(mq));
     EvrRtxMessageQueueInsertPending(mq, msg_ptr);
     status = osOK;
   } else {
@@ -931,6 +1937,24 @@ osStatus_t isrRtxMessageQueueGet (osMessageQueueId_t mq_id, void *msg_ptr, uint8
     return osErrorParameter;
   }
 
+  // Use FIFO ring buffer
+  if ((mq->attr & osRtxAttrFifo) != 0U) {
+    if (MessageQueueFifoGet(mq, msg_ptr, msg_prio)) {
+      EvrRtxMessageQueueRetrieved(mq, msg_ptr);
+      __DMB();
+      if (mq->fifo_wait != 0U) {
+        // Register post ISR processing
+        osRtxPostProcess(osRtxObject(mq));
+      }
+      status = osOK;
+    } else {
+      EvrRtxMessageQueueNotRetrieved(mq, msg_ptr);
+      status = osErrorResource;
+    }
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return status;
+  }
+
   // Get Message from Queue
   msg = MessageQueueGet(mq);
   if (msg != NULL) {
@@ -940,9 +1964,8 @@ osStatus_t isrRtxMessageQueueGet (osMessageQueueId_t mq_id, void *msg_ptr, uint8
       *msg_prio = msg->priority;
     }
     // Register post ISR processing
-    //lint -e{9079} -e{9087} "cast between pointers to different object types"
-    *((os_message_queue_t **)(void *)&msg[1]) = mq;
-    osRtxPostProcess(osRtxObject(msg));
+    MessageQueuePendPut(mq, msg);
+    osRtxPostProcess(osRtxObject(mq));
     EvrRtxMessageQueueRetrieved(mq, msg_ptr);
     status = osOK;
   } else {
@@ -954,6 +1977,274 @@ osStatus_t isrRtxMessageQueueGet (osMessageQueueId_t mq_id, void *msg_ptr, uint8
   return status;
 }
 
+/// Loan a Message memory slot from a Queue or timeout if Queue is full.
+/// \note API identical to osRtxMessageQueueLoan
+__STATIC_INLINE
+void *isrRtxMessageQueueLoan (osMessageQueueId_t mq_id, uint32_t timeout) {
+  os_message_queue_t *mq = osRtxMessageQueueId(mq_id);
+  os_message_t       *msg;
+  void               *ptr;
+
+  // Check parameters
+  if (!IsMessageQueuePtrValid(mq) || (mq->id != osRtxIdMessageQueue) ||
+      ((mq->attr & osRtxAttrFifo) != 0U) || (timeout != 0U)) {
+    EvrRtxMessageQueueError(mq, (int32_t)osErrorParameter);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return NULL;
+  }
+
+  // Try to allocate memory
+  //lint -e{9079} "conversion from pointer to void to pointer to other type" [MISRA Note 5]
+  msg = osRtxMemoryPoolAlloc(&mq->mp_info);
+  if (msg != NULL) {
+    // Mark Message as loaned
+    msg->id       = osRtxIdMessage;
+    msg->flags    = 1U;
+    msg->priority = 0U;
+    ptr = &msg[1];
+  } else {
+    // No memory available
+    EvrRtxMessageQueueNotInserted(mq, NULL);
+    ptr = NULL;
+  }
+
+  return ptr;
+}
+
+/// Commit a loaned Message into a Queue.
+/// \note API identical to osRtxMessageQueueCommit
+__STATIC_INLINE
+osStatus_t isrRtxMessageQueueCommit (osMessageQueueId_t mq_id, void *msg_ptr, uint8_t msg_prio) {
+  os_message_queue_t *mq = osRtxMessageQueueId(mq_id);
+  os_message_t       *msg;
+
+  // Check parameters
+  if (!IsMessageQueuePtrValid(mq) || (mq->id != osRtxIdMessageQueue)) {
+    EvrRtxMessageQueueError(mq, (int32_t)osErrorParameter);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return osErrorParameter;
+  }
+  msg = MessageQueueBlock(mq, msg_ptr);
+  if (msg == NULL) {
+    EvrRtxMessageQueueError(mq, (int32_t)osErrorParameter);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return osErrorParameter;
+  }
+
+  msg->flags    = 0U;
+  msg->priority = msg_prio;
+  // Register post ISR processing
+  //lint -e{9079} -e{9087} "cast between pointers to different object types"
+  *((const void **)(void *)&msg->prev) = msg_ptr;
+  MessageQueuePendPut(mq, msg);
+  osRtxPostProcess(osRtxObject(mq));
+  EvrRtxMessageQueueInsertPending(mq, msg_ptr);
+
+  return osOK;
+}
+
+/// Put multiple Messages into a Queue without waiting.
+/// \note API identical to osRtxMessageQueuePutN
+__STATIC_INLINE
+uint32_t isrRtxMessageQueuePutN (osMessageQueueId_t mq_id, const void *msg_ptr, uint32_t msg_count, uint8_t msg_prio, uint32_t timeout) {
+  os_message_queue_t *mq = osRtxMessageQueueId(mq_id);
+  const uint8_t      *ptr;
+  uint32_t            count;
+
+  // Check parameters
+  if (!IsMessageQueuePtrValid(mq) || (mq->id != osRtxIdMessageQueue) || (msg_ptr == NULL) || (timeout != 0U)) {
+    EvrRtxMessageQueueError(mq, (int32_t)osErrorParameter);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return 0U;
+  }
+
+  //lint -e{9079} "conversion from pointer to void to pointer to other type" [MISRA Note 5]
+  ptr = msg_ptr;
+
+  // Use FIFO ring buffer
+  if ((mq->attr & osRtxAttrFifo) != 0U) {
+    for (count = 0U; count < msg_count; count++) {
+      if (!MessageQueueFifoPut(mq, ptr, msg_prio)) {
+        break;
+      }
+      EvrRtxMessageQueueInserted(mq, ptr);
+      ptr = &ptr[mq->msg_size];
+    }
+    if (count == 0U) {
+      EvrRtxMessageQueueNotInserted(mq, msg_ptr);
+    } else {
+      __DMB();
+      if (mq->fifo_wait != 0U) {
+        // Register post ISR processing
+        osRtxPostProcess(osRtxObject(mq));
+      }
+    }
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return count;
+  }
+
+  // Each Message is registered for post ISR processing
+  for (count = 0U; count < msg_count; count++) {
+    if (isrRtxMessageQueuePut(mq_id, ptr, msg_prio, 0U) != osOK) {
+      break;
+    }
+    ptr = &ptr[mq->msg_size];
+  }
+
+  return count;
+}
+
+/// Get multiple Messages from a Queue without waiting.
+/// \note API identical to osRtxMessageQueueGetN
+__STATIC_INLINE
+uint32_t isrRtxMessageQueueGetN (osMessageQueueId_t mq_id, void *msg_ptr, uint32_t msg_count, uint8_t *msg_prio, uint32_t timeout) {
+  os_message_queue_t *mq = osRtxMessageQueueId(mq_id);
+  uint8_t            *ptr;
+  uint8_t            *prio;
+  uint32_t            count;
+
+  // Check parameters
+  if (!IsMessageQueuePtrValid(mq) || (mq->id != osRtxIdMessageQueue) || (msg_ptr == NULL) || (timeout != 0U)) {
+    EvrRtxMessageQueueError(mq, (int32_t)osErrorParameter);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return 0U;
+  }
+
+  //lint -e{9079} "conversion from pointer to void to pointer to other type" [MISRA Note 5]
+  ptr  = msg_ptr;
+  prio = msg_prio;
+
+  // Use FIFO ring buffer
+  if ((mq->attr & osRtxAttrFifo) != 0U) {
+    for (count = 0U; count < msg_count; count++) {
+      if (!MessageQueueFifoGet(mq, ptr, prio)) {
+        break;
+      }
+      EvrRtxMessageQueueRetrieved(mq, ptr);
+      ptr = &ptr[mq->msg_size];
+      if (prio != NULL) {
+        prio++;
+      }
+    }
+    if (count == 0U) {
+      EvrRtxMessageQueueNotRetrieved(mq, msg_ptr);
+    } else {
+      __DMB();
+      if (mq->fifo_wait != 0U) {
+        // Register post ISR processing
+        osRtxPostProcess(osRtxObject(mq));
+      }
+    }
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return count;
+  }
+
+  // Each Message is registered for post ISR processing
+  for (count = 0U; count < msg_count; count++) {
+    if (isrRtxMessageQueueGet(mq_id, ptr, prio, 0U) != osOK) {
+      break;
+    }
+    ptr = &ptr[mq->msg_size];
+    if (prio != NULL) {
+      prio++;
+    }
+  }
+
+  return count;
+}
+
+//  ==== Thread Fast Path ====
+
+/// Put a Message into a FIFO Queue from thread mode without a Service Call.
+/// \param[in]  mq_id           message queue ID obtained by \ref osMessageQueueNew.
+/// \param[in]  msg_ptr         pointer to buffer with message to put into a queue.
+/// \param[in]  msg_prio        message priority.
+/// \return true - message put, false - Service Call required.
+__STATIC_INLINE
+bool_t fastRtxMessageQueuePut (osMessageQueueId_t mq_id, const void *msg_ptr, uint8_t msg_prio) {
+#ifdef RTX_SAFETY_CLASS
+  (void)mq_id;
+  (void)msg_ptr;
+  (void)msg_prio;
+
+  // Safety class is checked by the Service Call
+  return FALSE;
+#else
+  os_message_queue_t *mq = osRtxMessageQueueId(mq_id);
+
+  // Check FIFO ring buffer
+  if (!IsMessageQueuePtrValid(mq) || (mq->id != osRtxIdMessageQueue) || (msg_ptr == NULL) ||
+      ((mq->attr & osRtxAttrFifo) == 0U)) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return FALSE;
+  }
+#if (EXCLUSIVE_ACCESS == 0)
+  // Multiple producers require exclusive access
+  if ((mq->attr & osRtxAttrFifoSP) == 0U) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return FALSE;
+  }
+#endif
+
+  if (!MessageQueueFifoPut(mq, msg_ptr, msg_prio)) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return FALSE;
+  }
+  EvrRtxMessageQueueInserted(mq, msg_ptr);
+  __DMB();
+  if (mq->fifo_wait != 0U) {
+    __svcMessageQueueFifoWakeup(mq);
+  }
+
+  return TRUE;
+#endif
+}
+
+/// Get a Message from a FIFO Queue from thread mode without a Service Call.
+/// \param[in]  mq_id           message queue ID obtained by \ref osMessageQueueNew.
+/// \param[out] msg_ptr         pointer to buffer for message to get from a queue.
+/// \param[out] msg_prio        pointer to buffer for message priority or NULL.
+/// \return true - message retrieved, false - Service Call required.
+__STATIC_INLINE
+bool_t fastRtxMessageQueueGet (osMessageQueueId_t mq_id, void *msg_ptr, uint8_t *msg_prio) {
+#ifdef RTX_SAFETY_CLASS
+  (void)mq_id;
+  (void)msg_ptr;
+  (void)msg_prio;
+
+  // Safety class is checked by the Service Call
+  return FALSE;
+#else
+  os_message_queue_t *mq = osRtxMessageQueueId(mq_id);
+
+  // Check FIFO ring buffer
+  if (!IsMessageQueuePtrValid(mq) || (mq->id != osRtxIdMessageQueue) || (msg_ptr == NULL) ||
+      ((mq->attr & osRtxAttrFifo) == 0U)) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return FALSE;
+  }
+#if (EXCLUSIVE_ACCESS == 0)
+  // Multiple producers require exclusive access
+  if ((mq->attr & osRtxAttrFifoSP) == 0U) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return FALSE;
+  }
+#endif
+
+  if (!MessageQueueFifoGet(mq, msg_ptr, msg_prio)) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return FALSE;
+  }
+  EvrRtxMessageQueueRetrieved(mq, msg_ptr);
+  __DMB();
+  if (mq->fifo_wait != 0U) {
+    __svcMessageQueueFifoWakeup(mq);
+  }
+
+  return TRUE;
+#endif
+}
+
 
 //  ==== Library functions ====
 
@@ -1008,7 +2299,11 @@ osStatus_t osMessageQueuePut (osMessageQueueId_t mq_id, const void *msg_ptr, uin
   if (IsException() || IsIrqMasked()) {
     status = isrRtxMessageQueuePut(mq_id, msg_ptr, msg_prio, timeout);
   } else {
-    status =  __svcMessageQueuePut(mq_id, msg_ptr, msg_prio, timeout);
+    if (fastRtxMessageQueuePut(mq_id, msg_ptr, msg_prio)) {
+      status = osOK;
+    } else {
+      status = __svcMessageQueuePut(mq_id, msg_ptr, msg_prio, timeout);
+    }
   }
   return status;
 }
@@ -1021,7 +2316,11 @@ osStatus_t osMessageQueueGet (osMessageQueueId_t mq_id, void *msg_ptr, uint8_t *
   if (IsException() || IsIrqMasked()) {
     status = isrRtxMessageQueueGet(mq_id, msg_ptr, msg_prio, timeout);
   } else {
-    status =  __svcMessageQueueGet(mq_id, msg_ptr, msg_prio, timeout);
+    if (fastRtxMessageQueueGet(mq_id, msg_ptr, msg_prio)) {
+      status = osOK;
+    } else {
+      status = __svcMessageQueueGet(mq_id, msg_ptr, msg_prio, timeout);
+    }
   }
   return status;
 }
@@ -1101,3 +2400,89 @@ osStatus_t osMessageQueueDelete (osMessageQueueId_t mq_id) {
   }
   return status;
 }
+
+/// Loan a Message memory slot from a Queue or timeout if Queue is full.
+void *osRtxMessageQueueLoan (osMessageQueueId_t mq_id, uint32_t timeout) {
+  void *msg_ptr;
+
+  if (IsException() || IsIrqMasked()) {
+    msg_ptr = isrRtxMessageQueueLoan(mq_id, timeout);
+  } else {
+    msg_ptr =  __svcMessageQueueLoan(mq_id, timeout);
+  }
+  return msg_ptr;
+}
+
+/// Commit a loaned Message into a Queue.
+osStatus_t osRtxMessageQueueCommit (osMessageQueueId_t mq_id, void *msg_ptr, uint8_t msg_prio) {
+  osStatus_t status;
+
+  if (IsException() || IsIrqMasked()) {
+    status = isrRtxMessageQueueCommit(mq_id, msg_ptr, msg_prio);
+  } else {
+    status =  __svcMessageQueueCommit(mq_id, msg_ptr, msg_prio);
+  }
+  return status;
+}
+
+/// Receive a Message from a Queue without copying or timeout if Queue is empty.
+void *osRtxMessageQueueReceive (osMessageQueueId_t mq_id, uint8_t *msg_prio, uint32_t timeout) {
+  void *msg_ptr;
+
+  if (IsException() || IsIrqMasked()) {
+    EvrRtxMessageQueueError(mq_id, (int32_t)osErrorISR);
+    msg_ptr = NULL;
+  } else {
+    msg_ptr = __svcMessageQueueReceive(mq_id, msg_prio, timeout);
+  }
+  return msg_ptr;
+}
+
+/// Release a received or loaned Message back to a Queue.
+osStatus_t osRtxMessageQueueRelease (osMessageQueueId_t mq_id, void *msg_ptr) {
+  osStatus_t status;
+
+  if (IsException() || IsIrqMasked()) {
+    EvrRtxMessageQueueError(mq_id, (int32_t)osErrorISR);
+    status = osErrorISR;
+  } else {
+    status = __svcMessageQueueRelease(mq_id, msg_ptr);
+  }
+  return status;
+}
+
+/// Put multiple Messages into a Queue or timeout if Queue is full.
+uint32_t osRtxMessageQueuePutN (osMessageQueueId_t mq_id, const void *msg_ptr, uint32_t msg_count, uint8_t msg_prio, uint32_t timeout) {
+  uint32_t count;
+
+  if (IsException() || IsIrqMasked()) {
+    count = isrRtxMessageQueuePutN(mq_id, msg_ptr, msg_count, msg_prio, timeout);
+  } else {
+    count =  __svcMessageQueuePutN(mq_id, msg_ptr, msg_count, msg_prio);
+    if ((count == 0U) && (msg_count != 0U) && (timeout != 0U)) {
+      // Wait for space and put the first Message
+      if (__svcMessageQueuePut(mq_id, msg_ptr, msg_prio, timeout) == osOK) {
+        count = 1U;
+      }
+    }
+  }
+  return count;
+}
+
+/// Get multiple Messages from a Queue or timeout if Queue is empty.
+uint32_t osRtxMessageQueueGetN (osMessageQueueId_t mq_id, void *msg_ptr, uint32_t msg_count, uint8_t *msg_prio, uint32_t timeout) {
+  uint32_t count;
+
+  if (IsException() || IsIrqMasked()) {
+    count = isrRtxMessageQueueGetN(mq_id, msg_ptr, msg_count, msg_prio, timeout);
+  } else {
+    count =  __svcMessageQueueGetN(mq_id, msg_ptr, msg_count, msg_prio);
+    if ((count == 0U) && (msg_count != 0U) && (timeout != 0U)) {
+      // Wait for the first Message
+      if (__svcMessageQueueGet(mq_id, msg_ptr, msg_prio, timeout) == osOK) {
+        count = 1U;
+      }
+    }
+  }
+  return count;
+}
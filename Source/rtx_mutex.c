@@ -42,16 +42,16 @@ __attribute__((section(".data.os.mutex.obj"))) =
 static bool_t IsMutexPtrValid (const os_mutex_t *mutex) {
 #ifdef RTX_OBJ_PTR_CHECK
   //lint --e{923} --e{9078} "cast from pointer to unsigned int" [MISRA Note 7]
-  uint32_t cb_start  = (uint32_t)&__os_mutex_cb_start__;
-  uint32_t cb_length = (uint32_t)&__os_mutex_cb_length__;
+  uintptr_t cb_start  = (uintptr_t)&__os_mutex_cb_start__;
+  uintptr_t cb_length = (uintptr_t)&__os_mutex_cb_length__;
 
   // Check the section boundaries
-  if (((uint32_t)mutex - cb_start) >= cb_length) {
+  if (((uintptr_t)mutex - cb_start) >= cb_length) {
     //lint -e{904} "Return statement before end of function" [MISRA Note 1]
     return FALSE;
   }
   // Check the object alignment
-  if ((((uint32_t)mutex - cb_start) % sizeof(os_mutex_t)) != 0U) {
+  if ((((uintptr_t)mutex - cb_start) % sizeof(os_mutex_t)) != 0U) {
     //lint -e{904} "Return statement before end of function" [MISRA Note 1]
     return FALSE;
   }
@@ -65,6 +65,106 @@ static bool_t IsMutexPtrValid (const os_mutex_t *mutex) {
   return TRUE;
 }
 
+/// Check if Mutex is linked to the owner Thread mutex list.
+/// \param[in]  mutex           mutex object.
+/// \return true - linked, false - not linked.
+static bool_t IsMutexOwnerListed (const os_mutex_t *mutex) {
+#ifdef RTX_MUTEX_FAST_PATH
+  // Owner list is only needed for priority inheritance, ceiling and robust release
+  return (((mutex->attr & (osMutexPrioInherit | osMutexRobust)) != 0U) || (mutex->ceiling != 0));
+#else
+  (void)mutex;
+  return TRUE;
+#endif
+}
+
+/// Get Priority that Mutex imposes on its owner Thread.
+/// \param[in]  mutex           mutex object.
+/// \param[in]  thread_wakeup   thread wakeup object.
+/// \return ceiling priority or priority of highest waiting Thread (priority inheritance).
+static int8_t MutexOwnerPriority (const os_mutex_t *mutex, const os_thread_t *thread_wakeup) {
+  const os_thread_t *thread;
+        int8_t       priority;
+
+  priority = mutex->ceiling;
+  if ((mutex->attr & osMutexPrioInherit) != 0U) {
+    // Check Threads waiting for Mutex
+    thread = mutex->thread_list;
+    if ((thread != NULL) && (thread == thread_wakeup)) {
+      // Skip thread that is waken-up
+      thread = thread->thread_next;
+    }
+    if ((thread != NULL) && (thread->priority > priority)) {
+      // Higher priority Thread is waiting for Mutex
+      priority = thread->priority;
+    }
+  }
+
+  return priority;
+}
+
+/// Get Priority that owned Mutexes impose on a Thread.
+/// \param[in]  thread          owner thread object.
+/// \param[in]  thread_wakeup   thread wakeup object.
+/// \return highest of base priority and priorities imposed by owned Mutexes.
+static int8_t MutexThreadPriority (const os_thread_t *thread, const os_thread_t *thread_wakeup) {
+  const os_mutex_t *mutex;
+        int8_t      priority;
+        int8_t      priority0;
+
+  priority = thread->priority_base;
+  mutex    = thread->mutex_list;
+  // Check Mutexes owned by Thread
+  while (mutex != NULL) {
+    priority0 = MutexOwnerPriority(mutex, thread_wakeup);
+    if (priority0 > priority) {
+      priority = priority0;
+    }
+    mutex = mutex->owner_next;
+  }
+
+  return priority;
+}
+
+#ifdef RTX_MUTEX_INHERIT_DEPTH
+/// Propagate Priority of a Thread blocked on a Mutex along the chain of Mutex owners.
+/// \param[in]  thread          thread object with updated priority.
+static void MutexOwnerChain (const os_thread_t *thread) {
+  const os_mutex_t  *mutex;
+        os_thread_t *owner;
+        int8_t       priority;
+        uint32_t     depth;
+
+  // Owner of the first Mutex is updated by the caller
+  depth = 1U;
+  while ((depth < (uint32_t)OS_MUTEX_INHERIT_DEPTH) && (thread->state == osRtxThreadWaitingMutex)) {
+    mutex = osRtxMutexObject(osRtxObject(thread->list_root));
+    owner = mutex->owner_thread;
+    if (((mutex->attr & osMutexPrioInherit) == 0U) || (owner == NULL)) {
+      break;
+    }
+    priority = MutexThreadPriority(owner, NULL);
+    if (owner->priority == priority) {
+      break;
+    }
+    owner->priority = priority;
+    osRtxThreadListSort(owner);
+    thread = owner;
+    depth++;
+  }
+}
+#endif
+
+/// Raise Priority of a new Mutex owner Thread to the Mutex ceiling.
+/// \param[in]  mutex           mutex object.
+/// \param[in]  thread          thread object (not linked to an object list).
+static void MutexCeilingEnter (const os_mutex_t *mutex, os_thread_t *thread) {
+
+  if (thread->priority < mutex->ceiling) {
+    thread->priority = mutex->ceiling;
+  }
+}
+
 
 //  ==== Library functions ====
 
@@ -87,6 +187,7 @@ void osRtxMutexOwnerRelease (os_mutex_t *mutex_list) {
       if (mutex->thread_list != NULL) {
         // Wakeup waiting Thread with highest Priority
         thread = osRtxThreadListGet(osRtxObject(mutex));
+        MutexCeilingEnter(mutex, thread);
         osRtxThreadWaitExit(thread, (uint32_t)osOK, FALSE);
         // Thread is the new Mutex owner
         mutex->owner_thread = thread;
@@ -98,6 +199,8 @@ void osRtxMutexOwnerRelease (os_mutex_t *mutex_list) {
         thread->mutex_list = mutex;
         mutex->lock = 1U;
         EvrRtxMutexAcquired(mutex, 1U);
+      } else {
+        mutex->owner_thread = NULL;
       }
     }
     mutex = mutex_next;
@@ -108,46 +211,36 @@ void osRtxMutexOwnerRelease (os_mutex_t *mutex_list) {
 /// \param[in]  mutex           mutex object.
 /// \param[in]  thread_wakeup   thread wakeup object.
 void osRtxMutexOwnerRestore (const os_mutex_t *mutex, const os_thread_t *thread_wakeup) {
-  const os_mutex_t  *mutex0;
-        os_thread_t *thread;
-  const os_thread_t *thread0;
-        int8_t       priority;
+  os_thread_t *thread;
+  int8_t       priority;
 
   // Restore owner Thread priority
   if ((mutex->attr & osMutexPrioInherit) != 0U) {
     thread   = mutex->owner_thread;
-    priority = thread->priority_base;
-    mutex0   = thread->mutex_list;
-    // Check Mutexes owned by Thread
-    do {
-      if ((mutex0->attr & osMutexPrioInherit) != 0U) {
-        // Check Threads waiting for Mutex
-        thread0 = mutex0->thread_list;
-        if (thread0 == thread_wakeup) {
-          // Skip thread that is waken-up
-          thread0 = thread0->thread_next;
-        }
-        if ((thread0 != NULL) && (thread0->priority > priority)) {
-          // Higher priority Thread is waiting for Mutex
-          priority = thread0->priority;
-        }
-      }
-      mutex0 = mutex0->owner_next;
-    } while (mutex0 != NULL);
+    priority = MutexThreadPriority(thread, thread_wakeup);
     if (thread->priority != priority) {
       thread->priority = priority;
       osRtxThreadListSort(thread);
+#ifdef RTX_MUTEX_INHERIT_DEPTH
+      MutexOwnerChain(thread);
+#endif
     }
   }
 }
 
+/// Get effective Priority of a Thread.
+/// \param[in]  thread          thread object.
+/// \return highest of base priority and priorities imposed by owned Mutexes.
+int8_t osRtxMutexThreadPriority (const os_thread_t *thread) {
+  return MutexThreadPriority(thread, NULL);
+}
+
 /// Unlock Mutex owner when mutex is deleted.
 /// \param[in]  mutex           mutex object.
 /// \return true - successful, false - not locked.
 static bool_t osRtxMutexOwnerUnlock (os_mutex_t *mutex) {
-  const os_mutex_t  *mutex0;
-        os_thread_t *thread;
-        int8_t       priority;
+  os_thread_t *thread;
+  int8_t       priority;
 
   // Check if Mutex is locked
   if (mutex->lock == 0U) {
@@ -158,31 +251,25 @@ static bool_t osRtxMutexOwnerUnlock (os_mutex_t *mutex) {
   thread = mutex->owner_thread;
 
   // Remove Mutex from Thread owner list
-  if (mutex->owner_next != NULL) {
-    mutex->owner_next->owner_prev = mutex->owner_prev;
-  }
-  if (mutex->owner_prev != NULL) {
-    mutex->owner_prev->owner_next = mutex->owner_next;
-  } else {
-    thread->mutex_list = mutex->owner_next;
+  if (IsMutexOwnerListed(mutex)) {
+    if (mutex->owner_next != NULL) {
+      mutex->owner_next->owner_prev = mutex->owner_prev;
+    }
+    if (mutex->owner_prev != NULL) {
+      mutex->owner_prev->owner_next = mutex->owner_next;
+    } else {
+      thread->mutex_list = mutex->owner_next;
+    }
   }
 
   // Restore owner Thread priority
-  priority = thread->priority_base;
-  mutex0   = thread->mutex_list;
-  // Check Mutexes owned by Thread
-  while (mutex0 != NULL) {
-    if ((mutex0->attr & osMutexPrioInherit) != 0U) {
-      if ((mutex0->thread_list != NULL) && (mutex0->thread_list->priority > priority)) {
-        // Higher priority Thread is waiting for Mutex
-        priority = mutex0->thread_list->priority;
-      }
-    }
-    mutex0 = mutex0->owner_next;
-  }
+  priority = MutexThreadPriority(thread, NULL);
   if (thread->priority != priority) {
     thread->priority = priority;
     osRtxThreadListSort(thread);
+#ifdef RTX_MUTEX_INHERIT_DEPTH
+    MutexOwnerChain(thread);
+#endif
   }
 
   // Unblock waiting threads
@@ -191,6 +278,7 @@ static bool_t osRtxMutexOwnerUnlock (os_mutex_t *mutex) {
     osRtxThreadWaitExit(thread, (uint32_t)osErrorResource, FALSE);
   }
 
+  mutex->owner_thread = NULL;
   mutex->lock = 0U;
 
   return TRUE;
@@ -230,8 +318,8 @@ void osRtxMutexDeleteClass (uint32_t safety_class, uint32_t mode) {
   uint32_t    length;
 
   //lint --e{923} --e{9078} "cast from pointer to unsigned int" [MISRA Note 7]
-  mutex  = (os_mutex_t *)(uint32_t)&__os_mutex_cb_start__;
-  length =               (uint32_t)&__os_mutex_cb_length__;
+  mutex  = (os_mutex_t *)(uintptr_t)&__os_mutex_cb_start__;
+  length =               (uint32_t)(uintptr_t)&__os_mutex_cb_length__;
   while (length >= sizeof(os_mutex_t)) {
     if (   (mutex->id == osRtxIdMutex) &&
         ((((mode & osSafetyWithSameClass)  != 0U) &&
@@ -258,6 +346,7 @@ static osMutexId_t svcRtxMutexNew (const osMutexAttr_t *attr) {
   const os_thread_t *thread = osRtxThreadGetRunning();
 #endif
   uint32_t           attr_bits;
+  uint32_t           ceiling;
   uint8_t            flags;
   const char        *name;
 
@@ -282,6 +371,13 @@ static osMutexId_t svcRtxMutexNew (const osMutexAttr_t *attr) {
       return NULL;
 #endif
     }
+    ceiling = (attr_bits & osRtxMutexPrioCeiling_Msk) >> osRtxMutexPrioCeiling_Pos;
+    if ((ceiling > (uint32_t)osPriorityRealtime7) ||
+        ((ceiling != 0U) && ((attr_bits & osMutexPrioInherit) != 0U))) {
+      EvrRtxMutexError(NULL, (int32_t)osErrorParameter);
+      //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+      return NULL;
+    }
     if (mutex != NULL) {
       if (!IsMutexPtrValid(mutex) || (attr->cb_size != sizeof(os_mutex_t))) {
         EvrRtxMutexError(NULL, osRtxErrorInvalidControlBlock);
@@ -298,6 +394,7 @@ static osMutexId_t svcRtxMutexNew (const osMutexAttr_t *attr) {
   } else {
     name      = NULL;
     attr_bits = 0U;
+    ceiling   = 0U;
     mutex     = NULL;
   }
 
@@ -338,6 +435,7 @@ static osMutexId_t svcRtxMutexNew (const osMutexAttr_t *attr) {
     mutex->owner_prev   = NULL;
     mutex->owner_next   = NULL;
     mutex->lock         = 0U;
+    mutex->ceiling      = (int8_t)ceiling;
 #ifdef RTX_SAFETY_CLASS
     if ((attr_bits & osSafetyClass_Valid) != 0U) {
       mutex->attr      |= (uint8_t)((attr_bits & osSafetyClass_Msk) >>
@@ -405,16 +503,26 @@ static osStatus_t svcRtxMutexAcquire (osMutexId_t mutex_id, uint32_t timeout) {
   }
 #endif
 
-  // Check if Mutex is not locked
-  if (mutex->lock == 0U) {
+  // Check running thread priority against Mutex ceiling
+  if ((mutex->ceiling != 0) && (thread->priority_base > mutex->ceiling)) {
+    EvrRtxMutexError(mutex, osRtxErrorMutexCeiling);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return osErrorParameter;
+  }
+
+  // Check if Mutex is not owned
+  if (mutex->owner_thread == NULL) {
     // Acquire Mutex
     mutex->owner_thread = thread;
-    mutex->owner_prev   = NULL;
-    mutex->owner_next   = thread->mutex_list;
-    if (thread->mutex_list != NULL) {
-      thread->mutex_list->owner_prev = mutex;
+    if (IsMutexOwnerListed(mutex)) {
+      mutex->owner_prev = NULL;
+      mutex->owner_next = thread->mutex_list;
+      if (thread->mutex_list != NULL) {
+        thread->mutex_list->owner_prev = mutex;
+      }
+      thread->mutex_list = mutex;
     }
-    thread->mutex_list = mutex;
+    MutexCeilingEnter(mutex, thread);
     mutex->lock = 1U;
     EvrRtxMutexAcquired(mutex, mutex->lock);
     status = osOK;
@@ -439,6 +547,9 @@ static osStatus_t svcRtxMutexAcquire (osMutexId_t mutex_id, uint32_t timeout) {
           if (mutex->owner_thread->priority < thread->priority) {
             mutex->owner_thread->priority = thread->priority;
             osRtxThreadListSort(mutex->owner_thread);
+#ifdef RTX_MUTEX_INHERIT_DEPTH
+            MutexOwnerChain(mutex->owner_thread);
+#endif
           }
         }
         EvrRtxMutexAcquirePending(mutex, timeout);
@@ -463,9 +574,7 @@ static osStatus_t svcRtxMutexAcquire (osMutexId_t mutex_id, uint32_t timeout) {
 /// \note API identical to osMutexRelease
 static osStatus_t svcRtxMutexRelease (osMutexId_t mutex_id) {
         os_mutex_t  *mutex = osRtxMutexId(mutex_id);
-  const os_mutex_t  *mutex0;
         os_thread_t *thread;
-        int8_t       priority;
 
   // Check running thread
   thread = osRtxThreadGetRunning();
@@ -504,45 +613,40 @@ static osStatus_t svcRtxMutexRelease (osMutexId_t mutex_id) {
   if (mutex->lock == 0U) {
 
     // Remove Mutex from Thread owner list
-    if (mutex->owner_next != NULL) {
-      mutex->owner_next->owner_prev = mutex->owner_prev;
-    }
-    if (mutex->owner_prev != NULL) {
-      mutex->owner_prev->owner_next = mutex->owner_next;
-    } else {
-      thread->mutex_list = mutex->owner_next;
+    if (IsMutexOwnerListed(mutex)) {
+      if (mutex->owner_next != NULL) {
+        mutex->owner_next->owner_prev = mutex->owner_prev;
+      }
+      if (mutex->owner_prev != NULL) {
+        mutex->owner_prev->owner_next = mutex->owner_next;
+      } else {
+        thread->mutex_list = mutex->owner_next;
+      }
     }
 
     // Restore running Thread priority
-    priority = thread->priority_base;
-    mutex0   = thread->mutex_list;
-    // Check mutexes owned by running Thread
-    while (mutex0 != NULL) {
-      if ((mutex0->attr & osMutexPrioInherit) != 0U) {
-        if ((mutex0->thread_list != NULL) && (mutex0->thread_list->priority > priority)) {
-          // Higher priority Thread is waiting for Mutex
-          priority = mutex0->thread_list->priority;
-        }
-      }
-      mutex0 = mutex0->owner_next;
-    }
-    thread->priority = priority;
+    thread->priority = MutexThreadPriority(thread, NULL);
 
     // Check if Thread is waiting for a Mutex
     if (mutex->thread_list != NULL) {
       // Wakeup waiting Thread with highest Priority
       thread = osRtxThreadListGet(osRtxObject(mutex));
+      MutexCeilingEnter(mutex, thread);
       osRtxThreadWaitExit(thread, (uint32_t)osOK, FALSE);
       // Thread is the new Mutex owner
       mutex->owner_thread = thread;
-      mutex->owner_prev   = NULL;
-      mutex->owner_next   = thread->mutex_list;
-      if (thread->mutex_list != NULL) {
-        thread->mutex_list->owner_prev = mutex;
+      if (IsMutexOwnerListed(mutex)) {
+        mutex->owner_prev = NULL;
+        mutex->owner_next = thread->mutex_list;
+        if (thread->mutex_list != NULL) {
+          thread->mutex_list->owner_prev = mutex;
+        }
+        thread->mutex_list = mutex;
       }
-      thread->mutex_list = mutex;
       mutex->lock = 1U;
       EvrRtxMutexAcquired(mutex, 1U);
+    } else {
+      mutex->owner_thread = NULL;
     }
 
     osRtxThreadDispatch(NULL);
@@ -551,6 +655,30 @@ static osStatus_t svcRtxMutexRelease (osMutexId_t mutex_id) {
   return osOK;
 }
 
+#if (defined(RTX_MUTEX_FAST_PATH) && (EXCLUSIVE_ACCESS == 1))
+/// Wakeup Thread waiting for a Mutex released by the fast path.
+/// \param[in]  mutex_id        mutex ID obtained by \ref osMutexNew.
+/// \return status code that indicates the execution status of the function.
+static osStatus_t svcRtxMutexWakeup (osMutexId_t mutex_id) {
+  os_mutex_t  *mutex = osRtxMutexId(mutex_id);
+  os_thread_t *thread;
+
+  // Check if Mutex is still free and Thread is waiting for it
+  if ((mutex->owner_thread == NULL) && (mutex->thread_list != NULL)) {
+    // Wakeup waiting Thread with highest Priority
+    thread = osRtxThreadListGet(osRtxObject(mutex));
+    osRtxThreadWaitExit(thread, (uint32_t)osOK, FALSE);
+    // Thread is the new Mutex owner
+    mutex->owner_thread = thread;
+    mutex->lock = 1U;
+    EvrRtxMutexAcquired(mutex, 1U);
+    osRtxThreadDispatch(NULL);
+  }
+
+  return osOK;
+}
+#endif
+
 /// Get Thread which owns a Mutex object.
 /// \note API identical to osMutexGetOwner
 static osThreadId_t svcRtxMutexGetOwner (osMutexId_t mutex_id) {
@@ -617,6 +745,9 @@ SVC0_1(MutexNew,      osMutexId_t,  const osMutexAttr_t *)
 SVC0_1(MutexGetName,  const char *, osMutexId_t)
 SVC0_2(MutexAcquire,  osStatus_t,   osMutexId_t, uint32_t)
 SVC0_1(MutexRelease,  osStatus_t,   osMutexId_t)
+#if (defined(RTX_MUTEX_FAST_PATH) && (EXCLUSIVE_ACCESS == 1))
+SVC0_1(MutexWakeup,   osStatus_t,   osMutexId_t)
+#endif
 SVC0_1(MutexGetOwner, osThreadId_t, osMutexId_t)
 SVC0_1(MutexDelete,   osStatus_t,   osMutexId_t)
 //lint --flb "Library End"
@@ -624,6 +755,101 @@ SVC0_1(MutexDelete,   osStatus_t,   osMutexId_t)
 
 //  ==== Public API ====
 
+#if (defined(RTX_MUTEX_FAST_PATH) && (EXCLUSIVE_ACCESS == 1))
+/// Check if Mutex can be handled by the fast path of the running Thread.
+/// \param[in]  mutex           mutex object.
+/// \param[in]  thread          running thread.
+/// \return true - fast path, false - Service Call required.
+static bool_t IsMutexFast (const os_mutex_t *mutex, const os_thread_t *thread) {
+
+  if ((thread == NULL) || !IsMutexPtrValid(mutex) || (mutex->id != osRtxIdMutex)) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return FALSE;
+  }
+  if (IsMutexOwnerListed(mutex)) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return FALSE;
+  }
+#ifdef RTX_SAFETY_CLASS
+  if ((thread->attr >> osRtxAttrClass_Pos) < (mutex->attr >> osRtxAttrClass_Pos)) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return FALSE;
+  }
+#endif
+  return TRUE;
+}
+
+/// Acquire a Mutex without a Service Call when it is free or recursively owned.
+/// \param[in]  mutex           mutex object.
+/// \return true - acquired, false - Service Call required.
+static bool_t MutexAcquireFast (os_mutex_t *mutex) {
+  os_thread_t *thread = osRtxThreadGetRunning();
+
+  if (!IsMutexFast(mutex, thread)) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return FALSE;
+  }
+
+  // Claim ownership (fails when an exception modified the owner in between)
+  //lint -e{740} -e{9087} "cast between pointers to different object types"
+  if (atomic_ptr_set((void **)&mutex->owner_thread, thread) == NULL) {
+    mutex->lock = 1U;
+    EvrRtxMutexAcquired(mutex, 1U);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return TRUE;
+  }
+
+  // Lock counter is only modified by the owner Thread
+  if ((mutex->owner_thread == thread) && ((mutex->attr & osMutexRecursive) != 0U) &&
+      (mutex->lock != osRtxMutexLockLimit)) {
+    mutex->lock++;
+    EvrRtxMutexAcquired(mutex, mutex->lock);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return TRUE;
+  }
+
+  return FALSE;
+}
+
+/// Release a Mutex without a Service Call when no Thread is waiting for it.
+/// \param[in]  mutex           mutex object.
+/// \return true - released, false - Service Call required.
+static bool_t MutexReleaseFast (os_mutex_t *mutex) {
+  const os_thread_t *thread = osRtxThreadGetRunning();
+
+  if (!IsMutexFast(mutex, thread) || (mutex->owner_thread != thread) || (mutex->lock == 0U)) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return FALSE;
+  }
+
+  if (mutex->lock > 1U) {
+    mutex->lock--;
+    EvrRtxMutexReleased(mutex, mutex->lock);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return TRUE;
+  }
+
+  // Let the kernel hand over the Mutex to a waiting Thread
+  if (mutex->thread_list != NULL) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return FALSE;
+  }
+
+  mutex->lock = 0U;
+  EvrRtxMutexReleased(mutex, 0U);
+  __DMB();
+  mutex->owner_thread = NULL;
+  __DMB();
+
+  // Wakeup Thread which started waiting before the owner was cleared
+  if (mutex->thread_list != NULL) {
+    (void)__svcMutexWakeup(mutex);
+  }
+
+  return TRUE;
+}
+#endif
+
 /// Create and Initialize a Mutex object.
 osMutexId_t osMutexNew (const osMutexAttr_t *attr) {
   osMutexId_t mutex_id;
@@ -658,6 +884,10 @@ osStatus_t osMutexAcquire (osMutexId_t mutex_id, uint32_t timeout) {
   if (IsException() || IsIrqMasked()) {
     EvrRtxMutexError(mutex_id, (int32_t)osErrorISR);
     status = osErrorISR;
+#if (defined(RTX_MUTEX_FAST_PATH) && (EXCLUSIVE_ACCESS == 1))
+  } else if (MutexAcquireFast(osRtxMutexId(mutex_id))) {
+    status = osOK;
+#endif
   } else {
     status = __svcMutexAcquire(mutex_id, timeout);
   }
@@ -672,6 +902,10 @@ osStatus_t osMutexRelease (osMutexId_t mutex_id) {
   if (IsException() || IsIrqMasked()) {
     EvrRtxMutexError(mutex_id, (int32_t)osErrorISR);
     status = osErrorISR;
+#if (defined(RTX_MUTEX_FAST_PATH) && (EXCLUSIVE_ACCESS == 1))
+  } else if (MutexReleaseFast(osRtxMutexId(mutex_id))) {
+    status = osOK;
+#endif
   } else {
     status = __svcMutexRelease(mutex_id);
   }
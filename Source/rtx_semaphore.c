@@ -108,16 +108,16 @@ static uint32_t SemaphoreTokenIncrement (os_semaphore_t *semaphore) {
 static bool_t IsSemaphorePtrValid (const os_semaphore_t *semaphore) {
 #ifdef RTX_OBJ_PTR_CHECK
   //lint --e{923} --e{9078} "cast from pointer to unsigned int" [MISRA Note 7]
-  uint32_t cb_start  = (uint32_t)&__os_semaphore_cb_start__;
-  uint32_t cb_length = (uint32_t)&__os_semaphore_cb_length__;
+  uintptr_t cb_start  = (uintptr_t)&__os_semaphore_cb_start__;
+  uintptr_t cb_length = (uintptr_t)&__os_semaphore_cb_length__;
 
   // Check the section boundaries
-  if (((uint32_t)semaphore - cb_start) >= cb_length) {
+  if (((uintptr_t)semaphore - cb_start) >= cb_length) {
     //lint -e{904} "Return statement before end of function" [MISRA Note 1]
     return FALSE;
   }
   // Check the object alignment
-  if ((((uint32_t)semaphore - cb_start) % sizeof(os_semaphore_t)) != 0U) {
+  if ((((uintptr_t)semaphore - cb_start) % sizeof(os_semaphore_t)) != 0U) {
     //lint -e{904} "Return statement before end of function" [MISRA Note 1]
     return FALSE;
   }
@@ -138,6 +138,11 @@ static bool_t IsSemaphorePtrValid (const os_semaphore_t *semaphore) {
 /// \param[in]  semaphore       semaphore object.
 static void osRtxSemaphoreDestroy (os_semaphore_t *semaphore) {
 
+  // Complete pending post ISR processing
+  if (semaphore->post_next != NULL) {
+    osRtxPostProcessFlush();
+  }
+
   // Mark object as invalid
   semaphore->id = osRtxIdInvalid;
 
@@ -169,8 +174,8 @@ void osRtxSemaphoreDeleteClass (uint32_t safety_class, uint32_t mode) {
   uint32_t        length;
 
   //lint --e{923} --e{9078} "cast from pointer to unsigned int" [MISRA Note 7]
-  semaphore = (os_semaphore_t *)(uint32_t)&__os_semaphore_cb_start__;
-  length    =                   (uint32_t)&__os_semaphore_cb_length__;
+  semaphore = (os_semaphore_t *)(uintptr_t)&__os_semaphore_cb_start__;
+  length    =                   (uint32_t)(uintptr_t)&__os_semaphore_cb_length__;
   while (length >= sizeof(os_semaphore_t)) {
     if (   (semaphore->id == osRtxIdSemaphore) &&
         ((((mode & osSafetyWithSameClass)  != 0U) &&
@@ -181,6 +186,9 @@ void osRtxSemaphoreDeleteClass (uint32_t safety_class, uint32_t mode) {
         thread = osRtxThreadListGet(osRtxObject(semaphore));
         osRtxThreadWaitExit(thread, (uint32_t)osErrorResource, FALSE);
       }
+#ifdef RTX_THREAD_WAIT_ANY
+      osRtxThreadWaitAnyDelete(osRtxObject(semaphore), FALSE);
+#endif
       osRtxSemaphoreDestroy(semaphore);
     }
     length -= sizeof(os_semaphore_t);
@@ -197,16 +205,23 @@ void osRtxSemaphoreDeleteClass (uint32_t safety_class, uint32_t mode) {
 static void osRtxSemaphorePostProcess (os_semaphore_t *semaphore) {
   os_thread_t *thread;
 
-  // Check if Thread is waiting for a token
-  if (semaphore->thread_list != NULL) {
+  // Check if Threads are waiting for a token (releases may be coalesced)
+  while (semaphore->thread_list != NULL) {
     // Try to acquire token
-    if (SemaphoreTokenDecrement(semaphore) != 0U) {
-      // Wakeup waiting Thread with highest Priority
-      thread = osRtxThreadListGet(osRtxObject(semaphore));
-      osRtxThreadWaitExit(thread, (uint32_t)osOK, FALSE);
-      EvrRtxSemaphoreAcquired(semaphore, semaphore->tokens);
+    if (SemaphoreTokenDecrement(semaphore) == 0U) {
+      break;
     }
+    // Wakeup waiting Thread with highest Priority
+    thread = osRtxThreadListGet(osRtxObject(semaphore));
+    osRtxThreadWaitExit(thread, (uint32_t)osOK, FALSE);
+    EvrRtxSemaphoreAcquired(semaphore, semaphore->tokens);
+  }
+#ifdef RTX_THREAD_WAIT_ANY
+  // Wakeup Threads waiting for multiple Objects with remaining tokens
+  if (semaphore->tokens != 0U) {
+    osRtxThreadWaitAnyNotify(osRtxObject(semaphore), FALSE);
   }
+#endif
 }
 
 
@@ -307,6 +322,7 @@ static osSemaphoreId_t svcRtxSemaphoreNew (uint32_t max_count, uint32_t initial_
     semaphore->thread_list = NULL;
     semaphore->tokens      = (uint16_t)initial_count;
     semaphore->max_tokens  = (uint16_t)max_count;
+    semaphore->post_next   = NULL;
 #ifdef RTX_SAFETY_CLASS
     if ((attr_bits & osSafetyClass_Valid) != 0U) {
       semaphore->attr     |= (uint8_t)((attr_bits & osSafetyClass_Msk) >>
@@ -435,6 +451,10 @@ static osStatus_t svcRtxSemaphoreRelease (osSemaphoreId_t semaphore_id) {
     // Try to release token
     if (SemaphoreTokenIncrement(semaphore) != 0U) {
       EvrRtxSemaphoreReleased(semaphore, semaphore->tokens);
+#ifdef RTX_THREAD_WAIT_ANY
+      // Wakeup Threads waiting for multiple Objects
+      osRtxThreadWaitAnyNotify(osRtxObject(semaphore), TRUE);
+#endif
       status = osOK;
     } else {
       EvrRtxSemaphoreError(semaphore, osRtxErrorSemaphoreCountLimit);
@@ -494,6 +514,10 @@ static osStatus_t svcRtxSemaphoreDelete (osSemaphoreId_t semaphore_id) {
     } while (semaphore->thread_list != NULL);
     osRtxThreadDispatch(NULL);
   }
+#ifdef RTX_THREAD_WAIT_ANY
+  // Unblock Threads waiting for multiple Objects
+  osRtxThreadWaitAnyDelete(osRtxObject(semaphore), TRUE);
+#endif
 
   osRtxSemaphoreDestroy(semaphore);
 
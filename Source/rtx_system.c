@@ -26,6 +26,41 @@
 #include "rtx_lib.h"
 
 
+#ifdef RTX_TIMING_WHEEL
+//  Timing Wheels for Thread Delays and Timers
+os_wheel_t osRtxThreadWheel __attribute__((section(".bss.os")));
+os_wheel_t osRtxTimerWheel  __attribute__((section(".bss.os")));
+#endif
+
+//  Post ISR Processing List (last posted Object first)
+static void *PostList __attribute__((section(".bss.os")));
+
+//  Pending List end marker (link of a pending Object is never NULL)
+#define PendListEnd             ((void *)&PostList)
+
+//  Post ISR Processing priority bitmap and last Object of each priority level (while sorting)
+static uint32_t PostListMap[2]   __attribute__((section(".bss.os")));
+static void    *PostListTail[64] __attribute__((section(".bss.os")));
+
+#ifdef RTX_WORK_QUEUE
+//  Deferred Work Queue
+typedef struct {
+  void                 *submit;         // Submitted Work Items (last submitted first)
+  osRtxWork_t          *run;            // Work Items to execute (in submit order)
+  osRtxWorkStats_t      stats;          // Statistics
+} work_queue_t;
+
+//  Deferred Work Queues (one per Work Level)
+static work_queue_t WorkQueue[osRtxWorkLevels] __attribute__((section(".bss.os")));
+
+//  Work Thread
+static os_thread_t *WorkThread __attribute__((section(".bss.os")));
+
+//  Work Thread Flag (signals submitted Work Items)
+#define WorkThreadFlag          0x00000001U
+#endif
+
+
 //  ==== Helper functions ====
 
 /// Put Object into ISR Queue.
@@ -109,6 +144,391 @@ static os_object_t *isr_queue_get (void) {
   return ret;
 }
 
+/// Get Post ISR Processing link of an Object.
+/// \param[in]  object          object.
+/// \return pointer to object link or NULL when object is not linked.
+static void **post_list_link (os_object_t *object) {
+  void **link;
+
+  switch (object->id) {
+    case osRtxIdThread:
+      link = &osRtxThreadObject(object)->post_next;
+      break;
+    case osRtxIdEventFlags:
+      link = &osRtxEventFlagsObject(object)->post_next;
+      break;
+    case osRtxIdSemaphore:
+      link = &osRtxSemaphoreObject(object)->post_next;
+      break;
+    case osRtxIdMemoryPool:
+      link = &osRtxMemoryPoolObject(object)->post_next;
+      break;
+    case osRtxIdMessageQueue:
+      link = &osRtxMessageQueueObject(object)->post_next;
+      break;
+    default:
+      // Objects without link are queued
+      link = NULL;
+      break;
+  }
+
+  return link;
+}
+
+/// Get priority of the first Thread woken by Post ISR Processing of an Object.
+/// \param[in]  object          object.
+/// \return thread priority (osPriorityNone when no thread is waiting).
+static int8_t post_list_prio (os_object_t *object) {
+  const os_thread_t *thread;
+  int8_t             prio;
+
+  if (object->id == osRtxIdThread) {
+    thread = osRtxThreadObject(object);
+  } else {
+    // Waiting Threads are sorted by Priority
+    thread = object->thread_list;
+  }
+  if (thread != NULL) {
+    prio = thread->priority;
+  } else {
+    prio = (int8_t)osPriorityNone;
+  }
+
+  return prio;
+}
+
+/// Put Object into Pending List unless already pending.
+/// \param[in]  list            list root.
+/// \param[in]  object          object.
+/// \param[in]  link            object link.
+/// \return 1 - object put, 0 - object already pending.
+static uint32_t pend_list_put (void **list, void *object, void **link) {
+#if (EXCLUSIVE_ACCESS == 0)
+  uint32_t primask = __get_PRIMASK();
+#else
+  void    *head;
+#endif
+  uint32_t ret;
+
+#if (EXCLUSIVE_ACCESS == 0)
+  __disable_irq();
+
+  if (*link == NULL) {
+    *link = (*list != NULL) ? *list : PendListEnd;
+    *list = object;
+    ret = 1U;
+  } else {
+    ret = 0U;
+  }
+
+  if (primask == 0U) {
+    __enable_irq();
+  }
+#else
+  // Mark object as pending
+  if (atomic_ptr_set(link, PendListEnd) == NULL) {
+    do {
+      head  = *list;
+      *link = (head != NULL) ? head : PendListEnd;
+    } while (atomic_ptr_cas(list, head, object) != head);
+    ret = 1U;
+  } else {
+    ret = 0U;
+  }
+#endif
+
+  return ret;
+}
+
+/// Get all Objects from Pending List.
+/// \param[in]  list            list root.
+/// \return last put object (objects remain pending) or NULL when list is empty.
+static void *pend_list_get (void **list) {
+#if (EXCLUSIVE_ACCESS == 0)
+  uint32_t primask = __get_PRIMASK();
+#endif
+  void    *object;
+
+#if (EXCLUSIVE_ACCESS == 0)
+  __disable_irq();
+
+  object = *list;
+  *list  = NULL;
+
+  if (primask == 0U) {
+    __enable_irq();
+  }
+#else
+  do {
+    object = *list;
+  } while (atomic_ptr_cas(list, object, NULL) != object);
+#endif
+
+  return object;
+}
+
+/// Get insertion point in front of specified priority level in sorted Post ISR Processing List.
+/// \param[in]  head            list head.
+/// \param[in]  priority        priority level.
+/// \return link of last object of nearest higher priority level or list head.
+static void **post_list_level_prev (void **head, uint32_t priority) {
+  void   **prev;
+  uint32_t level;
+  uint32_t map;
+
+  prev  = head;
+  level = priority + 1U;
+  map   = PostListMap[level >> 5] & (0xFFFFFFFFU << (level & 0x1FU));
+  if ((map == 0U) && (level < 32U)) {
+    level = 32U;
+    map   = PostListMap[1];
+  }
+  if (map != 0U) {
+    // Lowest set bit is the nearest higher non-empty priority level
+    level = (level & ~0x1FU) + (31U - (uint32_t)CountLeadingZeros(map & (0U - map)));
+    prev  = post_list_link(osRtxObject(PostListTail[level]));
+  }
+  return prev;
+}
+
+/// Get all Objects from Post ISR Processing List.
+/// \return first object sorted by priority of woken threads or list end marker.
+static os_object_t *post_list_get (void) {
+  os_object_t *object;
+  void        *head;
+  void        *next;
+  void       **link;
+  void       **prev;
+  uint32_t     priority;
+  uint32_t     bit;
+
+  object = pend_list_get(&PostList);
+  if (object == NULL) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return PendListEnd;
+  }
+
+  // Sort list by priority of the first woken Thread (objects remain pending):
+  // objects are taken last posted first and inserted at the head of their
+  // priority level, so objects with the same priority remain in posting order
+  head = PendListEnd;
+  while (object != PendListEnd) {
+    link     = post_list_link(object);
+    next     = *link;
+    priority = (uint32_t)post_list_prio(object);
+    prev     = post_list_level_prev(&head, priority);
+    *link    = *prev;
+    *prev    = object;
+    bit      = 1UL << (priority & 0x1FU);
+    if ((PostListMap[priority >> 5] & bit) == 0U) {
+      PostListMap[priority >> 5] |= bit;
+      PostListTail[priority] = object;
+    }
+    object = next;
+  }
+  PostListMap[0] = 0U;
+  PostListMap[1] = 0U;
+
+  return head;
+}
+
+/// Post process an Object.
+/// \param[in]  object          object.
+static void post_process (os_object_t *object) {
+
+  switch (object->id) {
+    case osRtxIdThread:
+      osRtxInfo.post_process.thread(osRtxThreadObject(object));
+      break;
+    case osRtxIdEventFlags:
+      osRtxInfo.post_process.event_flags(osRtxEventFlagsObject(object));
+      break;
+    case osRtxIdSemaphore:
+      osRtxInfo.post_process.semaphore(osRtxSemaphoreObject(object));
+      break;
+    case osRtxIdMemoryPool:
+      osRtxInfo.post_process.memory_pool(osRtxMemoryPoolObject(object));
+      break;
+    case osRtxIdMessageQueue:
+      if ((object->attr & osRtxAttrFifo) != 0U) {
+        osRtxInfo.post_process.message_fifo(osRtxMessageQueueObject(object));
+      } else {
+        osRtxInfo.post_process.message(osRtxMessageQueueObject(object));
+      }
+      break;
+    default:
+      // Should never come here
+      break;
+  }
+}
+
+/// Post process all Objects in Post ISR Processing List.
+static void post_list_process (void) {
+  os_object_t *object;
+  void        *next;
+  void       **link;
+
+  for (;;) {
+    object = post_list_get();
+    if (object == PendListEnd) {
+      break;
+    }
+    do {
+      link   = post_list_link(object);
+      next   = *link;
+      // Clear pending state before processing (object can be posted again)
+      *link  = NULL;
+      post_process(object);
+      object = next;
+    } while (object != PendListEnd);
+  }
+}
+
+#ifdef RTX_WORK_QUEUE
+
+/// Get system timer count in thread or handler mode.
+/// \return system timer count.
+static uint32_t work_time (void) {
+  uint32_t count;
+
+  if (IsException() || IsIrqMasked()) {
+    count = osRtxKernelSysTimerCount();
+  } else {
+    count = osKernelGetSysTimerCount();
+  }
+  return count;
+}
+
+/// Update Work Queue backlog.
+/// \param[in]  queue           work queue.
+/// \param[in]  inc             true - increment, false - decrement.
+/// \return updated backlog.
+static uint32_t work_backlog (work_queue_t *queue, bool_t inc) {
+#if (EXCLUSIVE_ACCESS == 0)
+  uint32_t primask = __get_PRIMASK();
+#endif
+  uint32_t backlog;
+
+#if (EXCLUSIVE_ACCESS == 0)
+  __disable_irq();
+
+  if (inc) {
+    backlog = ++queue->stats.backlog;
+  } else {
+    backlog = --queue->stats.backlog;
+  }
+
+  if (primask == 0U) {
+    __enable_irq();
+  }
+#else
+  if (inc) {
+    backlog = atomic_inc32(&queue->stats.backlog) + 1U;
+  } else {
+    backlog = atomic_dec32(&queue->stats.backlog) - 1U;
+  }
+#endif
+
+  return backlog;
+}
+
+/// Get next Work Item to execute.
+/// \param[in]  queue           work queue.
+/// \return work item (remains pending) or NULL when queue is empty.
+static osRtxWork_t *work_get (work_queue_t *queue) {
+  osRtxWork_t *work;
+  osRtxWork_t *prev;
+  osRtxWork_t *next;
+
+  work = queue->run;
+  if (work == NULL) {
+    // Take submitted Work Items in submit order
+    work = pend_list_get(&queue->submit);
+    if (work == NULL) {
+      //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+      return NULL;
+    }
+    prev = PendListEnd;
+    while (work != PendListEnd) {
+      next       = work->next;
+      work->next = prev;
+      prev       = work;
+      work       = next;
+    }
+    work = prev;
+  }
+
+  queue->run = (work->next != PendListEnd) ? work->next : NULL;
+
+  return work;
+}
+
+/// Execute a batch of Work Items.
+/// \param[in]  level           work level.
+/// \return true - work items remaining, false - queue is empty.
+static bool_t work_execute (uint32_t level) {
+  work_queue_t   *queue = &WorkQueue[level];
+  osRtxWork_t    *work;
+  osRtxWorkFunc_t func;
+  void           *argument;
+  uint32_t        latency;
+  uint32_t        n;
+
+  for (n = 0U; n < osRtxConfig.work_batch; n++) {
+    work = work_get(queue);
+    if (work == NULL) {
+      break;
+    }
+    func     = work->func;
+    argument = work->argument;
+    latency  = work_time() - work->timestamp;
+    __DMB();
+    // Clear pending state before execution (work item can be submitted again)
+    work->next = NULL;
+    (void)work_backlog(queue, FALSE);
+    queue->stats.count++;
+    queue->stats.latency = latency;
+    if (latency > queue->stats.latency_max) {
+      queue->stats.latency_max = latency;
+    }
+    func(argument);
+  }
+
+  return ((queue->run != NULL) || (queue->submit != NULL));
+}
+
+/// Wakeup Work Thread.
+static void work_thread_wakeup (void) {
+  os_thread_t *thread = WorkThread;
+#if (EXCLUSIVE_ACCESS == 0)
+  uint32_t     primask;
+#endif
+
+  // Work Thread executes pending Work Items at startup
+  if (thread == NULL) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return;
+  }
+
+#if (EXCLUSIVE_ACCESS == 0)
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  thread->thread_flags |= WorkThreadFlag;
+
+  if (primask == 0U) {
+    __enable_irq();
+  }
+#else
+  (void)atomic_set32(&thread->thread_flags, WorkThreadFlag);
+#endif
+
+  // Register post ISR processing
+  osRtxPostProcess(osRtxObject(thread));
+}
+
+#endif  // RTX_WORK_QUEUE
+
 
 //  ==== Library Functions ====
 
@@ -120,23 +540,52 @@ void osRtxTick_Handler (void) {
   os_thread_t *thread;
 
   OS_Tick_AcknowledgeIRQ();
+
+#ifdef RTX_HR_TIMER
+  // High-Resolution Timer compare shares the OS Tick interrupt (SysTick)
+  if (OS_Tick_CompareIRQ() != 0) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return;
+  }
+#endif
+
   osRtxInfo.kernel.tick++;
 
+#ifdef RTX_THREAD_RUN_TIME
+  // Account time of the running Thread
+  osRtxThreadRunTimeUpdate();
+#endif
+
   // Process Thread Delays
   osRtxThreadDelayTick();
 
   osRtxThreadDispatch(NULL);
 
+#ifdef RTX_THREAD_EDF
+  // Check Thread Deadlines
+  osRtxThreadDeadlineTick();
+#endif
+
   // Process Timers
   if (osRtxInfo.timer.tick != NULL) {
     osRtxInfo.timer.tick();
   }
 
+#ifdef RTX_HR_TIMER
+  // Process High-Resolution Timers
+  osRtxHrTimerTick();
+#endif
+
 #ifdef RTX_THREAD_WATCHDOG
   // Process Watchdog Timers
   osRtxThreadWatchdogTick();
 #endif
 
+#ifdef RTX_THREAD_BUDGET
+  // Process Thread Budgets
+  osRtxThreadBudgetTick();
+#endif
+
   // Check Round Robin timeout
   if (osRtxInfo.thread.robin.timeout != 0U) {
     thread = osRtxInfo.thread.run.next;
@@ -154,6 +603,12 @@ void osRtxTick_Handler (void) {
       // Round Robin Timeout
       if (osRtxKernelGetState() == osRtxKernelRunning) {
         thread = osRtxInfo.thread.ready.thread_list;
+#ifdef RTX_THREAD_EDF
+        if ((osRtxInfo.thread.robin.thread->flags & osRtxThreadFlagDeadline) != 0U) {
+          // Threads with deadline are not time sliced
+          thread = NULL;
+        }
+#endif
         if ((thread != NULL) && (thread->priority == osRtxInfo.thread.robin.thread->priority)) {
           osRtxThreadListRemove(thread);
           osRtxThreadReadyPut(osRtxInfo.thread.robin.thread);
@@ -174,47 +629,246 @@ void osRtxTick_Handler (void) {
 void osRtxPendSV_Handler (void) {
   os_object_t *object;
 
+#ifdef RTX_WORK_QUEUE
+  // Execute a batch of soft IRQ Work Items
+  if (work_execute(osRtxWorkLevelSoftIrq)) {
+    // Continue with the next batch after pending interrupts
+    SetPendSV();
+  }
+#endif
+
+  // Process queued Objects
   for (;;) {
     object = isr_queue_get();
     if (object == NULL) {
       break;
     }
-    switch (object->id) {
-      case osRtxIdThread:
-        osRtxInfo.post_process.thread(osRtxThreadObject(object));
-        break;
-      case osRtxIdEventFlags:
-        osRtxInfo.post_process.event_flags(osRtxEventFlagsObject(object));
-        break;
-      case osRtxIdSemaphore:
-        osRtxInfo.post_process.semaphore(osRtxSemaphoreObject(object));
-        break;
-      case osRtxIdMemoryPool:
-        osRtxInfo.post_process.memory_pool(osRtxMemoryPoolObject(object));
-        break;
-      case osRtxIdMessage:
-        osRtxInfo.post_process.message(osRtxMessageObject(object));
-        break;
-      default:
-        // Should never come here
-        break;
-    }
+    post_process(object);
   }
 
+  // Process pending Objects
+  post_list_process();
+
   osRtxThreadDispatch(NULL);
 }
 
 /// Register post ISR processing.
 /// \param[in]  object          generic object.
 void osRtxPostProcess (os_object_t *object) {
+  void   **link;
+  uint32_t pend;
+
+  link = post_list_link(object);
+  if (link != NULL) {
+    // Repeated posts to a pending object are coalesced
+    pend = pend_list_put(&PostList, object, link);
+  } else {
+    pend = isr_queue_put(object);
+    if (pend == 0U) {
+      (void)osRtxKernelErrorNotify(osRtxErrorISRQueueOverflow, object);
+    }
+  }
 
-  if (isr_queue_put(object) != 0U) {
+  if (pend != 0U) {
     if (osRtxInfo.kernel.blocked == 0U) {
       SetPendSV();
     } else {
       osRtxInfo.kernel.pendSV = 1U;
     }
+  }
+}
+
+/// Complete pending post ISR processing (before an object is destroyed).
+void osRtxPostProcessFlush (void) {
+
+  // Woken Threads are dispatched by the pending PendSV
+  post_list_process();
+}
+
+#ifdef RTX_WORK_QUEUE
+/// Work Thread
+//lint -esym(714,osRtxWorkThread) "Referenced from thread startup"
+//lint -esym(759,osRtxWorkThread) "Prototype in header"
+//lint -esym(765,osRtxWorkThread) "Global scope"
+__NO_RETURN void osRtxWorkThread (void *argument) {
+  (void)argument;
+
+  WorkThread = osRtxThreadId(osThreadGetId());
+
+  for (;;) {
+    // Execute Work Items in batches
+    while (work_execute(osRtxWorkLevelThread)) {
+      (void)osThreadYield();
+    }
+    // Wait for submitted Work Items
+    (void)osThreadFlagsWait(WorkThreadFlag, osFlagsWaitAny, osWaitForever);
+  }
+}
+
+/// Check if soft IRQ Work Items are pending.
+/// \return true - work items pending, false - queue is empty.
+bool_t osRtxWorkPending (void) {
+  const work_queue_t *queue = &WorkQueue[osRtxWorkLevelSoftIrq];
+
+  return ((queue->run != NULL) || (queue->submit != NULL));
+}
+#endif
+
+#ifdef RTX_TIMING_WHEEL
+/// Get Timing Wheel Slot for specified expiry time.
+/// \param[in]  wheel           timing wheel.
+/// \param[in]  time            expiry time (different from wheel time).
+/// \return slot index.
+uint32_t osRtxWheelSlot (const os_wheel_t *wheel, uint32_t time) {
+  uint32_t level;
+
+  if (time < wheel->time) {
+    // Expires after wheel time wrap-around
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return osRtxWheelOverflow;
+  }
+
+  // Level of the most significant digit that differs from wheel time
+  level = (31U - CountLeadingZeros(time ^ wheel->time)) / osRtxWheelLevelBits;
+
+  return osRtxWheelSlotAt(time, level);
+}
+
+/// Get number of ticks until the next occupied Timing Wheel Slot is due.
+/// \param[in]  wheel           timing wheel.
+/// \return number of ticks or osWaitForever when wheel is empty.
+uint32_t osRtxWheelNext (const os_wheel_t *wheel) {
+  uint32_t level, shift, map;
+  uint32_t ticks, delay;
+
+  delay = osWaitForever;
+
+  for (level = 0U; level < osRtxWheelLevels; level++) {
+    shift = level * osRtxWheelLevelBits;
+    // Occupied Slots after current Slot (Slots are always ahead of wheel time)
+    map = (uint32_t)wheel->map[level] >> (((wheel->time >> shift) & (osRtxWheelLevelSlots - 1U)) + 1U);
+    if (map != 0U) {
+      ticks = ((32U - CountLeadingZeros(map & (0U - map))) << shift) -
+              (wheel->time & ((1U << shift) - 1U));
+      if (ticks < delay) {
+        delay = ticks;
+      }
+    }
+  }
+
+  if (wheel->map[osRtxWheelLevels] != 0U) {
+    // Overflow Slot is due at wheel time wrap-around
+    ticks = 0U - wheel->time;
+    if (ticks < delay) {
+      delay = ticks;
+    }
+  }
+
+  return delay;
+}
+#endif
+
+
+//  ==== Service Calls ====
+
+/// Submit a Work Item for deferred execution.
+/// \note API identical to osRtxWorkSubmit
+static osStatus_t svcRtxWorkSubmit (osRtxWork_t *work) {
+#ifdef RTX_WORK_QUEUE
+  work_queue_t *queue;
+  uint32_t      backlog;
+
+  // Check parameters
+  if ((work == NULL) || (work->func == NULL) || (work->level >= osRtxWorkLevels)) {
+    EvrRtxKernelError((int32_t)osErrorParameter);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return osErrorParameter;
+  }
+  queue = &WorkQueue[work->level];
+
+  work->timestamp = work_time();
+
+  // Put Work Item into Work Queue (repeated submits of a pending item are coalesced)
+  backlog = work_backlog(queue, TRUE);
+  //lint -e{9087} "cast between pointers to different object types"
+  if (pend_list_put(&queue->submit, work, (void **)&work->next) == 0U) {
+    (void)work_backlog(queue, FALSE);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return osErrorResource;
+  }
+  // Coalesced submits do not count for the maximum backlog
+  if (backlog > queue->stats.backlog_max) {
+    queue->stats.backlog_max = backlog;
+  }
+
+  if (work->level == osRtxWorkLevelSoftIrq) {
+    if (osRtxInfo.kernel.blocked == 0U) {
+      SetPendSV();
+    } else {
+      osRtxInfo.kernel.pendSV = 1U;
+    }
+  } else {
+    work_thread_wakeup();
+  }
+
+  return osOK;
+#else
+  (void)work;
+  return osError;
+#endif
+}
+
+/// Get Deferred Work statistics.
+/// \note API identical to osRtxWorkGetStats
+static osStatus_t svcRtxWorkGetStats (uint32_t level, osRtxWorkStats_t *stats) {
+#ifdef RTX_WORK_QUEUE
+
+  // Check parameters
+  if ((level >= osRtxWorkLevels) || (stats == NULL)) {
+    EvrRtxKernelError((int32_t)osErrorParameter);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return osErrorParameter;
+  }
+
+  *stats = WorkQueue[level].stats;
+
+  return osOK;
+#else
+  (void)level;
+  (void)stats;
+  return osError;
+#endif
+}
+
+//  Service Calls definitions
+//lint ++flb "Library Begin" [MISRA Note 11]
+SVC0_1(WorkSubmit,   osStatus_t, osRtxWork_t *)
+SVC0_2(WorkGetStats, osStatus_t, uint32_t, osRtxWorkStats_t *)
+//lint --flb "Library End"
+
+
+//  ==== Public API ====
+
+/// Submit a Work Item for deferred execution.
+osStatus_t osRtxWorkSubmit (osRtxWork_t *work) {
+  osStatus_t status;
+
+  if (IsException() || IsIrqMasked()) {
+    status = svcRtxWorkSubmit(work);
+  } else {
+    status = __svcWorkSubmit(work);
+  }
+  return status;
+}
+
+/// Get Deferred Work statistics.
+osStatus_t osRtxWorkGetStats (uint32_t level, osRtxWorkStats_t *stats) {
+  osStatus_t status;
+
+  if (IsException() || IsIrqMasked()) {
+    status = svcRtxWorkGetStats(level, stats);
   } else {
-    (void)osRtxKernelErrorNotify(osRtxErrorISRQueueOverflow, object);
+    status = __svcWorkGetStats(level, stats);
   }
+  return status;
 }
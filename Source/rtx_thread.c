@@ -43,6 +43,22 @@ static uint8_t ThreadClassTable[64] __attribute__((section(".data.os"))) = { 0U
 static uint8_t WatchdogAlarmFlag __attribute__((section(".data.os"))) = 0U;
 #endif
 
+// Ready List priority bitmap and last Thread of each priority level
+#ifdef RTX_THREAD_READY_BITMAP
+static uint32_t     ThreadReadyMap[2]   __attribute__((section(".bss.os")));
+static os_thread_t *ThreadReadyTail[64] __attribute__((section(".bss.os")));
+#endif
+
+// Delay Timing Wheel Slots (First Thread of each Slot)
+#ifdef RTX_TIMING_WHEEL
+static os_thread_t *ThreadDelaySlot[osRtxWheelSlots] __attribute__((section(".bss.os")));
+#endif
+
+// Budget list (Threads with exhausted Budget sorted by replenishment time)
+#ifdef RTX_THREAD_BUDGET
+static os_thread_t *ThreadBudgetList __attribute__((section(".bss.os")));
+#endif
+
 
 //  ==== Helper functions ====
 
@@ -149,16 +165,16 @@ static uint32_t ThreadFlagsCheck (os_thread_t *thread, uint32_t flags, uint32_t
 static bool_t IsThreadPtrValid (const os_thread_t *thread) {
 #ifdef RTX_OBJ_PTR_CHECK
   //lint --e{923} --e{9078} "cast from pointer to unsigned int" [MISRA Note 7]
-  uint32_t cb_start  = (uint32_t)&__os_thread_cb_start__;
-  uint32_t cb_length = (uint32_t)&__os_thread_cb_length__;
+  uintptr_t cb_start  = (uintptr_t)&__os_thread_cb_start__;
+  uintptr_t cb_length = (uintptr_t)&__os_thread_cb_length__;
 
   // Check the section boundaries
-  if (((uint32_t)thread - cb_start) >= cb_length) {
+  if (((uintptr_t)thread - cb_start) >= cb_length) {
     //lint -e{904} "Return statement before end of function" [MISRA Note 1]
     return FALSE;
   }
   // Check the object alignment
-  if ((((uint32_t)thread - cb_start) % sizeof(os_thread_t)) != 0U) {
+  if ((((uintptr_t)thread - cb_start) % sizeof(os_thread_t)) != 0U) {
     //lint -e{904} "Return statement before end of function" [MISRA Note 1]
     return FALSE;
   }
@@ -172,6 +188,25 @@ static bool_t IsThreadPtrValid (const os_thread_t *thread) {
   return TRUE;
 }
 
+/// Check if processor affinity mask is valid (Kernel runs on a single core).
+/// \param[in]  affinity_mask   processor affinity mask (0 = not used).
+/// \return true - valid, false - not valid.
+static bool_t IsAffinityMaskValid (uint32_t affinity_mask) {
+
+  if (affinity_mask == 0U) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return TRUE;
+  }
+
+  // Mask must include the core executing the Kernel
+  if ((affinity_mask > 0xFFU) || ((affinity_mask & (1UL << GetCoreId())) == 0U)) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return FALSE;
+  }
+
+  return TRUE;
+}
+
 #if defined(RTX_EXECUTION_ZONE) && defined(RTX_SAFETY_CLASS)
 /// Check if Thread Zone to Safety Class mapping is valid.
 /// \param[in]  attr_bits       thread attributes.
@@ -211,27 +246,141 @@ static bool_t IsClassMappingValid (uint32_t attr_bits, const os_thread_t *thread
 
 //  ==== Library functions ====
 
+/// Check if a Thread is scheduled before another Thread.
+/// \param[in]  thread          thread object.
+/// \param[in]  other           thread object compared to.
+/// \return true - higher priority or earlier deadline at equal priority, false - otherwise.
+bool_t osRtxThreadPrecedes (const os_thread_t *thread, const os_thread_t *other) {
+#ifdef RTX_THREAD_EDF
+  if (thread->priority == other->priority) {
+    if ((thread->flags & other->flags & osRtxThreadFlagDeadline) != 0U) {
+      //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+      return ((int32_t)(thread->deadline - other->deadline) < 0);
+    }
+    // Threads with deadline precede other Threads of equal priority
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return ((thread->flags & (uint8_t)~other->flags & osRtxThreadFlagDeadline) != 0U);
+  }
+#endif
+  return (thread->priority > other->priority);
+}
+
+#ifdef RTX_THREAD_READY_BITMAP
+/// Get insertion point in front of specified priority level in Ready list.
+/// \param[in]  priority        priority level.
+/// \return last thread of nearest higher priority level or ready list object.
+static os_thread_t *osRtxThreadReadyLevelPrev (uint32_t priority) {
+  os_thread_t *prev;
+  uint32_t     level;
+  uint32_t     map;
+
+  prev  = osRtxThreadObject(&osRtxInfo.thread.ready);
+  level = priority + 1U;
+  map   = ThreadReadyMap[level >> 5] & (0xFFFFFFFFU << (level & 0x1FU));
+  if ((map == 0U) && (level < 32U)) {
+    level = 32U;
+    map   = ThreadReadyMap[1];
+  }
+  if (map != 0U) {
+    // Lowest set bit is the nearest higher non-empty priority level
+    level = (level & ~0x1FU) + (31U - (uint32_t)CountLeadingZeros(map & (0U - map)));
+    prev  = ThreadReadyTail[level];
+  }
+  return prev;
+}
+
+/// Insert a Thread into Ready list at its priority level.
+/// \param[in]  thread          thread object.
+/// \param[in]  head            insert at head (true) or tail (false) of priority level.
+static void osRtxThreadReadyInsert (os_thread_t *thread, bool_t head) {
+  os_thread_t *prev, *next;
+  uint32_t     priority;
+
+  priority = (uint32_t)thread->priority;
+
+  if (head || (ThreadReadyTail[priority] == NULL)) {
+    prev = osRtxThreadReadyLevelPrev(priority);
+  } else {
+    prev = ThreadReadyTail[priority];
+  }
+#ifdef RTX_THREAD_EDF
+  if ((ThreadReadyTail[priority] != NULL) &&
+      (head || ((thread->flags & osRtxThreadFlagDeadline) != 0U))) {
+    // Threads with deadline lead the priority level sorted by absolute deadline
+    if (!head) {
+      prev = osRtxThreadReadyLevelPrev(priority);
+    }
+    next = prev->thread_next;
+    while ((next != NULL) && (next->priority_ready == thread->priority) &&
+           (head ? osRtxThreadPrecedes(next, thread) : !osRtxThreadPrecedes(thread, next))) {
+      prev = next;
+      next = next->thread_next;
+    }
+    // Update level tail only when inserted behind it
+    head = (prev != ThreadReadyTail[priority]) ? TRUE : FALSE;
+  }
+#endif
+  if (!head || (ThreadReadyTail[priority] == NULL)) {
+    ThreadReadyTail[priority] = thread;
+    ThreadReadyMap[priority >> 5] |= 1UL << (priority & 0x1FU);
+  }
+  thread->priority_ready = thread->priority;
+
+  next = prev->thread_next;
+  thread->list_root   = &osRtxInfo.thread.ready;
+  thread->thread_prev = prev;
+  thread->thread_next = next;
+  prev->thread_next = thread;
+  if (next != NULL) {
+    next->thread_prev = thread;
+  }
+}
+
+/// Update Ready list priority level before a Thread is unlinked.
+/// \param[in]  thread          thread object.
+static void osRtxThreadReadyUnlink (const os_thread_t *thread) {
+  os_thread_t *prev;
+  uint32_t     priority;
+
+  priority = (uint32_t)thread->priority_ready;
+
+  if (ThreadReadyTail[priority] == thread) {
+    prev = thread->thread_prev;
+    if ((prev->id == osRtxIdThread) && (prev->priority_ready == thread->priority_ready)) {
+      ThreadReadyTail[priority] = prev;
+    } else {
+      // Priority level is empty
+      ThreadReadyTail[priority] = NULL;
+      ThreadReadyMap[priority >> 5] &= ~(1UL << (priority & 0x1FU));
+    }
+  }
+}
+#endif
+
 /// Put a Thread into specified Object list sorted by Priority (Highest at Head).
 /// \param[in]  object          generic object.
 /// \param[in]  thread          thread object.
 void osRtxThreadListPut (os_object_t *object, os_thread_t *thread) {
   os_thread_t *prev, *next;
-  int32_t      priority;
-
-  priority = thread->priority;
 
   prev = osRtxThreadObject(object);
   next = prev->thread_next;
-  while ((next != NULL) && (next->priority >= priority)) {
+  while ((next != NULL) && !osRtxThreadPrecedes(thread, next)) {
     prev = next;
     next = next->thread_next;
   }
+  thread->list_root   = object;
   thread->thread_prev = prev;
   thread->thread_next = next;
   prev->thread_next = thread;
   if (next != NULL) {
     next->thread_prev = thread;
   }
+#ifdef RTX_EVFLAGS_WAIT_INDEX
+  if (thread->state == osRtxThreadWaitingEventFlags) {
+    osRtxEventFlagsWaitLink(thread);
+  }
+#endif
 }
 
 /// Get a Thread with Highest Priority from specified Object list and remove it.
@@ -241,11 +390,17 @@ os_thread_t *osRtxThreadListGet (os_object_t *object) {
   os_thread_t *thread;
 
   thread = object->thread_list;
+#ifdef RTX_EVFLAGS_WAIT_INDEX
+  if (thread->state == osRtxThreadWaitingEventFlags) {
+    osRtxEventFlagsWaitUnlink(thread);
+  }
+#endif
   object->thread_list = thread->thread_next;
   if (thread->thread_next != NULL) {
     thread->thread_next->thread_prev = osRtxThreadObject(object);
   }
   thread->thread_prev = NULL;
+  thread->list_root   = NULL;
 
   return thread;
 }
@@ -253,32 +408,28 @@ os_thread_t *osRtxThreadListGet (os_object_t *object) {
 /// Retrieve Thread list root object.
 /// \param[in]  thread          thread object.
 /// \return root object.
-static void *osRtxThreadListRoot (os_thread_t *thread) {
-  os_thread_t *thread0;
-
-  thread0 = thread;
-  while (thread0->id == osRtxIdThread) {
-    thread0 = thread0->thread_prev;
-  }
-  return thread0;
+static void *osRtxThreadListRoot (const os_thread_t *thread) {
+  return thread->list_root;
 }
 
 /// Re-sort a Thread in linked Object list by Priority (Highest at Head).
 /// \param[in]  thread          thread object.
 void osRtxThreadListSort (os_thread_t *thread) {
   os_object_t *object;
-  os_thread_t *thread0;
 
-  // Search for object
-  thread0 = thread;
-  while ((thread0 != NULL) && (thread0->id == osRtxIdThread)) {
-    thread0 = thread0->thread_prev;
-  }
-  object = osRtxObject(thread0);
+  object = osRtxObject(osRtxThreadListRoot(thread));
 
   if (object != NULL) {
     osRtxThreadListRemove(thread);
+#ifdef RTX_THREAD_READY_BITMAP
+    if (thread->state == osRtxThreadReady) {
+      osRtxThreadReadyInsert(thread, FALSE);
+    } else {
+      osRtxThreadListPut(object, thread);
+    }
+#else
     osRtxThreadListPut(object, thread);
+#endif
   }
 }
 
@@ -287,11 +438,22 @@ void osRtxThreadListSort (os_thread_t *thread) {
 void osRtxThreadListRemove (os_thread_t *thread) {
 
   if (thread->thread_prev != NULL) {
+#ifdef RTX_THREAD_READY_BITMAP
+    if (thread->state == osRtxThreadReady) {
+      osRtxThreadReadyUnlink(thread);
+    }
+#endif
+#ifdef RTX_EVFLAGS_WAIT_INDEX
+    if (thread->state == osRtxThreadWaitingEventFlags) {
+      osRtxEventFlagsWaitUnlink(thread);
+    }
+#endif
     thread->thread_prev->thread_next = thread->thread_next;
     if (thread->thread_next != NULL) {
       thread->thread_next->thread_prev = thread->thread_prev;
     }
     thread->thread_prev = NULL;
+    thread->list_root   = NULL;
   }
 }
 
@@ -315,30 +477,162 @@ static void osRtxThreadListUnlink (os_thread_t **thread_list, os_thread_t *threa
 void osRtxThreadReadyPut (os_thread_t *thread) {
 
   thread->state = osRtxThreadReady;
+#ifdef RTX_THREAD_READY_BITMAP
+  osRtxThreadReadyInsert(thread, FALSE);
+#else
   osRtxThreadListPut(&osRtxInfo.thread.ready, thread);
+#endif
 }
 
+/// Get a Thread with Highest Priority from Ready list and remove it.
+/// \return thread object.
+os_thread_t *osRtxThreadReadyGet (void) {
+#ifdef RTX_THREAD_READY_BITMAP
+  osRtxThreadReadyUnlink(osRtxInfo.thread.ready.thread_list);
+#endif
+  return osRtxThreadListGet(&osRtxInfo.thread.ready);
+}
+
+/// Append a Thread to a Delay list (List Head links back to List Tail).
+/// \param[in]  thread_list     pointer to list head.
+/// \param[in]  thread          thread object.
+static void osRtxThreadDelayListAppend (os_thread_t **thread_list, os_thread_t *thread) {
+  os_thread_t *head;
+
+  head = *thread_list;
+  thread->delay_next = NULL;
+  if (head == NULL) {
+    thread->delay_prev = thread;
+    *thread_list = thread;
+  } else {
+    thread->delay_prev = head->delay_prev;
+    head->delay_prev->delay_next = thread;
+    head->delay_prev = thread;
+  }
+}
+
+/// Unlink a Thread from a Delay list (List Head links back to List Tail).
+/// \param[in]  thread_list     pointer to list head.
+/// \param[in]  thread          thread object.
+static void osRtxThreadDelayListUnlink (os_thread_t **thread_list, os_thread_t *thread) {
+  os_thread_t *head;
+
+  head = *thread_list;
+  if (thread == head) {
+    head = thread->delay_next;
+    *thread_list = head;
+    if (head != NULL) {
+      head->delay_prev = thread->delay_prev;
+    }
+  } else {
+    thread->delay_prev->delay_next = thread->delay_next;
+    if (thread->delay_next != NULL) {
+      thread->delay_next->delay_prev = thread->delay_prev;
+    } else {
+      head->delay_prev = thread->delay_prev;
+    }
+  }
+  thread->delay_prev = NULL;
+}
+
+#ifdef RTX_TIMING_WHEEL
+/// Insert a Thread into the Delay Timing Wheel (at Slot Tail).
+/// \param[in]  thread          thread object with absolute expiry time in delay.
+static void osRtxThreadWheelInsert (os_thread_t *thread) {
+  uint32_t slot;
+
+  slot = osRtxWheelSlot(&osRtxThreadWheel, thread->delay);
+  if (ThreadDelaySlot[slot] == NULL) {
+    osRtxWheelMapSet(&osRtxThreadWheel, slot);
+  }
+  osRtxThreadDelayListAppend(&ThreadDelaySlot[slot], thread);
+}
+
+/// Remove a Thread from the Delay Timing Wheel.
+/// \param[in]  thread          thread object.
+static void osRtxThreadWheelRemove (os_thread_t *thread) {
+  uint32_t slot;
+
+  slot = osRtxWheelSlot(&osRtxThreadWheel, thread->delay);
+  osRtxThreadDelayListUnlink(&ThreadDelaySlot[slot], thread);
+  if (ThreadDelaySlot[slot] == NULL) {
+    osRtxWheelMapClr(&osRtxThreadWheel, slot);
+  }
+}
+
+/// Process Delay Timing Wheel Slot: collect expired Threads and re-insert others.
+/// \param[in]  slot            slot index.
+/// \param[in]  tail            last expired Thread.
+/// \return last expired Thread.
+static os_thread_t *osRtxThreadWheelSlot (uint32_t slot, os_thread_t *tail) {
+  os_thread_t *thread, *thread_next;
+
+  thread = ThreadDelaySlot[slot];
+  if (thread != NULL) {
+    ThreadDelaySlot[slot] = NULL;
+    osRtxWheelMapClr(&osRtxThreadWheel, slot);
+    do {
+      thread_next = thread->delay_next;
+      if (thread->delay == osRtxThreadWheel.time) {
+        // Append to expired Threads in Delay list
+        thread->delay = 0U;
+        thread->delay_prev = tail;
+        thread->delay_next = NULL;
+        if (tail != NULL) {
+          tail->delay_next = thread;
+        } else {
+          osRtxInfo.thread.delay_list = thread;
+        }
+        tail = thread;
+      } else {
+        // Cascade to lower Level
+        osRtxThreadWheelInsert(thread);
+      }
+      thread = thread_next;
+    } while (thread != NULL);
+  }
+
+  return tail;
+}
+
+/// Advance Delay Timing Wheel by one tick and move expired Threads to Delay list.
+static void osRtxThreadWheelTick (void) {
+  os_thread_t *tail;
+  uint32_t     time, level;
+
+  osRtxThreadWheel.time++;
+  time = osRtxThreadWheel.time;
+  tail = NULL;
+
+  if (time == 0U) {
+    tail = osRtxThreadWheelSlot(osRtxWheelOverflow, tail);
+  }
+  level = osRtxWheelLevelDue(time) + 1U;
+  do {
+    level--;
+    tail = osRtxThreadWheelSlot(osRtxWheelSlotAt(time, level), tail);
+  } while (level != 0U);
+}
+#endif
+
 /// Insert a Thread into the Delay list sorted by Delay (Lowest at Head).
 /// \param[in]  thread          thread object.
 /// \param[in]  delay           delay value.
 static void osRtxThreadDelayInsert (os_thread_t *thread, uint32_t delay) {
+#ifndef RTX_TIMING_WHEEL
   os_thread_t *prev, *next;
+#endif
 
   if (delay == osWaitForever) {
-    prev = NULL;
-    next = osRtxInfo.thread.wait_list;
-    while (next != NULL)  {
-      prev = next;
-      next = next->delay_next;
-    }
     thread->delay = delay;
-    thread->delay_prev = prev;
-    thread->delay_next = NULL;
-    if (prev != NULL) {
-      prev->delay_next = thread;
-    } else {
-      osRtxInfo.thread.wait_list = thread;
-    }
+    osRtxThreadDelayListAppend(&osRtxInfo.thread.wait_list, thread);
+#ifdef RTX_TIMING_WHEEL
+    thread->flags |= osRtxThreadFlagWaitList;
+  } else {
+    thread->delay = osRtxThreadWheel.time + delay;
+    osRtxThreadWheelInsert(thread);
+  }
+#else
   } else {
     prev = NULL;
     next = osRtxInfo.thread.delay_list;
@@ -360,23 +654,24 @@ static void osRtxThreadDelayInsert (os_thread_t *thread, uint32_t delay) {
       next->delay_prev = thread;
     }
   }
+#endif
 }
 
 /// Remove a Thread from the Delay list.
 /// \param[in]  thread          thread object.
 void osRtxThreadDelayRemove (os_thread_t *thread) {
 
+#ifdef RTX_TIMING_WHEEL
+  if ((thread->flags & osRtxThreadFlagWaitList) != 0U) {
+    thread->flags &= (uint8_t)~osRtxThreadFlagWaitList;
+#else
   if (thread->delay == osWaitForever) {
-    if (thread->delay_next != NULL) {
-      thread->delay_next->delay_prev = thread->delay_prev;
-    }
-    if (thread->delay_prev != NULL) {
-      thread->delay_prev->delay_next = thread->delay_next;
-      thread->delay_prev = NULL;
-    } else {
-      osRtxInfo.thread.wait_list = thread->delay_next;
-    }
+#endif
+    osRtxThreadDelayListUnlink(&osRtxInfo.thread.wait_list, thread);
   } else {
+#ifdef RTX_TIMING_WHEEL
+    osRtxThreadWheelRemove(thread);
+#else
     if (thread->delay_next != NULL) {
       thread->delay_next->delay += thread->delay;
       thread->delay_next->delay_prev = thread->delay_prev;
@@ -387,6 +682,7 @@ void osRtxThreadDelayRemove (os_thread_t *thread) {
     } else {
       osRtxInfo.thread.delay_list = thread->delay_next;
     }
+#endif
   }
   thread->delay = 0U;
 }
@@ -396,13 +692,19 @@ void osRtxThreadDelayTick (void) {
   os_thread_t *thread;
   os_object_t *object;
 
+#ifdef RTX_TIMING_WHEEL
+  osRtxThreadWheelTick();
+#endif
+
   thread = osRtxInfo.thread.delay_list;
   if (thread == NULL) {
     //lint -e{904} "Return statement before end of function" [MISRA Note 1]
     return;
   }
 
+#ifndef RTX_TIMING_WHEEL
   thread->delay--;
+#endif
 
   if (thread->delay == 0U) {
     do {
@@ -428,16 +730,18 @@ void osRtxThreadDelayTick (void) {
           EvrRtxMemoryPoolAllocTimeout((osMemoryPoolId_t)osRtxThreadListRoot(thread));
           break;
         case osRtxThreadWaitingMessageGet:
+        case osRtxThreadWaitingMessageRecv:
           EvrRtxMessageQueueGetTimeout((osMessageQueueId_t)osRtxThreadListRoot(thread));
           break;
         case osRtxThreadWaitingMessagePut:
+        case osRtxThreadWaitingMessageLoan:
           EvrRtxMessageQueuePutTimeout((osMessageQueueId_t)osRtxThreadListRoot(thread));
           break;
         default:
           // Invalid
           break;
       }
-      EvrRtxThreadUnblocked(thread, (osRtxThreadRegPtr(thread))[0]);
+      EvrRtxThreadUnblocked(thread, (uint32_t)(osRtxThreadRegPtr(thread))[0]);
       osRtxThreadListRemove(thread);
       osRtxThreadReadyPut(thread);
       thread = thread->delay_next;
@@ -449,45 +753,128 @@ void osRtxThreadDelayTick (void) {
   }
 }
 
+/// Get first Thread in the Delay list.
+/// \return thread object or NULL.
+os_thread_t *osRtxThreadDelayFirst (void) {
+#ifdef RTX_TIMING_WHEEL
+  os_thread_t *thread = NULL;
+  uint32_t     slot;
+
+  for (slot = 0U; (slot < osRtxWheelSlots) && (thread == NULL); slot++) {
+    thread = ThreadDelaySlot[slot];
+  }
+
+  return thread;
+#else
+  return osRtxInfo.thread.delay_list;
+#endif
+}
+
+/// Get next Thread in the Delay list.
+/// \param[in]  thread          thread object.
+/// \return thread object or NULL.
+os_thread_t *osRtxThreadDelayNext (const os_thread_t *thread) {
+#ifdef RTX_TIMING_WHEEL
+  os_thread_t *next = thread->delay_next;
+  uint32_t     slot;
+
+  if (next == NULL) {
+    slot = osRtxWheelSlot(&osRtxThreadWheel, thread->delay) + 1U;
+    for (; (slot < osRtxWheelSlots) && (next == NULL); slot++) {
+      next = ThreadDelaySlot[slot];
+    }
+  }
+
+  return next;
+#else
+  return thread->delay_next;
+#endif
+}
+
 /// Get pointer to Thread registers (R0..R3)
 /// \param[in]  thread          thread object.
 /// \return pointer to registers R0-R3.
-uint32_t *osRtxThreadRegPtr (const os_thread_t *thread) {
-  uint32_t addr = thread->sp + StackOffsetR0(thread->stack_frame);
+uintptr_t *osRtxThreadRegPtr (const os_thread_t *thread) {
+  uintptr_t addr = thread->sp + StackOffsetR0(thread->stack_frame);
   //lint -e{923} -e{9078} "cast from unsigned int to pointer"
-  return ((uint32_t *)addr);
+  return ((uintptr_t *)addr);
 }
 
 /// Block running Thread execution and register it as Ready to Run.
 /// \param[in]  thread          running thread object.
 static void osRtxThreadBlock (os_thread_t *thread) {
+#ifndef RTX_THREAD_READY_BITMAP
   os_thread_t *prev, *next;
-  int32_t      priority;
+#endif
 
   thread->state = osRtxThreadReady;
 
-  priority = thread->priority;
-
+#ifdef RTX_THREAD_READY_BITMAP
+  osRtxThreadReadyInsert(thread, TRUE);
+#else
   prev = osRtxThreadObject(&osRtxInfo.thread.ready);
   next = prev->thread_next;
 
-  while ((next != NULL) && (next->priority > priority)) {
+  while ((next != NULL) && osRtxThreadPrecedes(next, thread)) {
     prev = next;
     next = next->thread_next;
   }
+  thread->list_root   = &osRtxInfo.thread.ready;
   thread->thread_prev = prev;
   thread->thread_next = next;
   prev->thread_next = thread;
   if (next != NULL) {
     next->thread_prev = thread;
   }
+#endif
 
   EvrRtxThreadPreempted(thread);
 }
 
+#ifdef RTX_THREAD_RUN_TIME
+/// Account elapsed time to the running Thread.
+void osRtxThreadRunTimeUpdate (void) {
+  os_thread_t *thread;
+  uint32_t     timestamp;
+  uint32_t     delta;
+
+  timestamp = osRtxKernelSysTimerCount();
+  delta     = timestamp - osRtxInfo.thread.run_time.timestamp;
+  osRtxInfo.thread.run_time.timestamp = timestamp;
+
+  thread = osRtxThreadGetRunning();
+  if (thread != NULL) {
+    thread->run_time += delta;
+    if (thread->run_time < delta) {
+      thread->run_time_hi++;
+    }
+    osRtxInfo.thread.run_time.time += delta;
+    if (osRtxInfo.thread.run_time.time < delta) {
+      osRtxInfo.thread.run_time.time_hi++;
+    }
+  }
+}
+#endif
+
 /// Switch to specified Thread.
 /// \param[in]  thread          thread object.
 void osRtxThreadSwitch (os_thread_t *thread) {
+#ifdef RTX_THREAD_RUN_TIME
+  os_thread_t *thread_running;
+
+  osRtxThreadRunTimeUpdate();
+
+  // Count the context switch once per exception (first switch away from running Thread)
+  thread_running = osRtxThreadGetRunning();
+  if ((thread_running != NULL) && (thread_running != thread) &&
+      (osRtxInfo.thread.run.next == thread_running)) {
+    if (thread_running->state == osRtxThreadReady) {
+      thread_running->preempt++;
+    } else {
+      thread_running->yield++;
+    }
+  }
+#endif
 
   thread->state = osRtxThreadRunning;
   SetPrivileged((bool_t)((thread->attr & osThreadPrivileged) != 0U));
@@ -509,7 +896,7 @@ void osRtxThreadDispatch (os_thread_t *thread) {
     thread_ready = osRtxInfo.thread.ready.thread_list;
     if ((kernel_state == osRtxKernelRunning) &&
         (thread_ready != NULL) &&
-        (thread_ready->priority > thread_running->priority)) {
+        osRtxThreadPrecedes(thread_ready, thread_running)) {
       // Preempt running Thread
       osRtxThreadListRemove(thread_ready);
       osRtxThreadBlock(thread_running);
@@ -517,7 +904,7 @@ void osRtxThreadDispatch (os_thread_t *thread) {
     }
   } else {
     if ((kernel_state == osRtxKernelRunning) &&
-        (thread->priority > thread_running->priority)) {
+        osRtxThreadPrecedes(thread, thread_running)) {
       // Preempt running Thread
       osRtxThreadBlock(thread_running);
       osRtxThreadSwitch(thread);
@@ -528,57 +915,441 @@ void osRtxThreadDispatch (os_thread_t *thread) {
   }
 }
 
-/// Exit Thread wait state.
-/// \param[in]  thread          thread object.
-/// \param[in]  ret_val         return value.
-/// \param[in]  dispatch        dispatch flag.
-void osRtxThreadWaitExit (os_thread_t *thread, uint32_t ret_val, bool_t dispatch) {
-  uint32_t *reg;
+/// Exit Thread wait state.
+/// \param[in]  thread          thread object.
+/// \param[in]  ret_val         return value.
+/// \param[in]  dispatch        dispatch flag.
+void osRtxThreadWaitExit (os_thread_t *thread, uintptr_t ret_val, bool_t dispatch) {
+  uintptr_t *reg;
+
+  EvrRtxThreadUnblocked(thread, (uint32_t)ret_val);
+
+  reg = osRtxThreadRegPtr(thread);
+  reg[0] = ret_val;
+
+  osRtxThreadDelayRemove(thread);
+  if (dispatch) {
+    osRtxThreadDispatch(thread);
+  } else {
+    osRtxThreadReadyPut(thread);
+  }
+}
+
+/// Enter Thread wait state.
+/// \param[in]  state           new thread state.
+/// \param[in]  timeout         timeout.
+/// \return true - success, false - failure.
+bool_t osRtxThreadWaitEnter (uint8_t state, uint32_t timeout) {
+  os_thread_t *thread;
+
+  // Check if Kernel is running
+  if (osRtxKernelGetState() != osRtxKernelRunning) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return FALSE;
+  }
+
+  // Check if any thread is ready
+  if (osRtxInfo.thread.ready.thread_list == NULL) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return FALSE;
+  }
+
+  // Get running thread
+  thread = osRtxThreadGetRunning();
+
+  EvrRtxThreadBlocked(thread, timeout);
+
+  thread->state = state;
+  osRtxThreadDelayInsert(thread, timeout);
+  thread = osRtxThreadReadyGet();
+  osRtxThreadSwitch(thread);
+
+  return TRUE;
+}
+
+#ifdef RTX_THREAD_EDF
+/// Check if a Thread has missed its deadline and report it once per job.
+/// \param[in]  thread          thread object.
+static void osRtxThreadDeadlineCheck (os_thread_t *thread) {
+
+  if (((thread->flags & (osRtxThreadFlagDeadline | osRtxThreadFlagMissed)) == osRtxThreadFlagDeadline) &&
+      ((int32_t)(osRtxInfo.kernel.tick - thread->deadline) > 0)) {
+    thread->flags |= osRtxThreadFlagMissed;
+    (void)osRtxKernelErrorNotify(osRtxErrorDeadlineMiss, thread);
+  }
+}
+
+/// Process Thread Deadlines (executed each System Tick).
+void osRtxThreadDeadlineTick (void) {
+  os_thread_t *thread;
+
+  thread = osRtxThreadGetRunning();
+  if (thread != NULL) {
+    osRtxThreadDeadlineCheck(thread);
+  }
+
+  // Ready Threads with deadline lead their priority level
+  thread = osRtxInfo.thread.ready.thread_list;
+  while ((thread != NULL) && (thread->priority >= (int8_t)OS_THREAD_EDF_PRIO)) {
+    if ((thread->flags & osRtxThreadFlagDeadline) != 0U) {
+      osRtxThreadDeadlineCheck(thread);
+    } else if (thread->priority == (int8_t)OS_THREAD_EDF_PRIO) {
+      break;
+    } else {
+      // Higher priority Thread
+    }
+    thread = thread->thread_next;
+  }
+}
+#endif
+
+#ifdef RTX_THREAD_BUDGET
+/// Get Budget replenishment time of a Thread.
+/// \param[in]  thread          thread object.
+/// \return end of current Budget period (Kernel Tick).
+static uint32_t osRtxThreadBudgetEnd (const os_thread_t *thread) {
+  return (thread->budget_time + thread->budget_period);
+}
+
+/// Insert a Thread into the Budget list sorted by replenishment time.
+/// \param[in]  thread          thread object.
+static void osRtxThreadBudgetInsert (os_thread_t *thread) {
+  os_thread_t *prev, *next;
+  uint32_t     time;
+
+  time = osRtxThreadBudgetEnd(thread);
+  prev = NULL;
+  next = ThreadBudgetList;
+  while ((next != NULL) && ((int32_t)(osRtxThreadBudgetEnd(next) - time) <= 0)) {
+    prev = next;
+    next = next->budget_next;
+  }
+  thread->budget_next = next;
+  thread->budget_prev = prev;
+  if (next != NULL) {
+    next->budget_prev = thread;
+  }
+  if (prev != NULL) {
+    prev->budget_next = thread;
+  } else {
+    ThreadBudgetList = thread;
+  }
+}
+
+/// Remove a Thread from the Budget list.
+/// \param[in]  thread          thread object.
+static void osRtxThreadBudgetRemove (const os_thread_t *thread) {
+
+  if (thread->budget_next != NULL) {
+    thread->budget_next->budget_prev = thread->budget_prev;
+  }
+  if (thread->budget_prev != NULL) {
+    thread->budget_prev->budget_next = thread->budget_next;
+  } else {
+    ThreadBudgetList = thread->budget_next;
+  }
+}
+
+/// Demote or suspend a Thread that has exhausted its Budget.
+/// \param[in]  thread          thread object (running or ready).
+static void osRtxThreadBudgetExhausted (os_thread_t *thread) {
+
+  thread->budget_state = 1U;
+  osRtxThreadBudgetInsert(thread);
+
+  if (thread->budget_prio == (int8_t)osPriorityNone) {
+    // Suspend Thread until replenishment
+    EvrRtxThreadSuspended(thread);
+    if (thread->state == osRtxThreadRunning) {
+      thread->state = osRtxThreadWaitingBudget;
+      osRtxThreadSwitch(osRtxThreadReadyGet());
+    } else {
+      osRtxThreadListRemove(thread);
+      thread->state = osRtxThreadWaitingBudget;
+    }
+    osRtxThreadDelayInsert(thread, osWaitForever);
+  } else {
+    // Demote Thread until replenishment (inherited priority is kept)
+    thread->budget_base   = thread->priority_base;
+    thread->priority_base = thread->budget_prio;
+    if (thread->priority == thread->budget_base) {
+      thread->priority = thread->budget_prio;
+      EvrRtxThreadPriorityUpdated(thread, osRtxThreadPriority(thread));
+      osRtxThreadListSort(thread);
+    }
+  }
+}
+
+/// Resume or restore priority of a Thread with exhausted Budget.
+/// \param[in]  thread          thread object.
+static void osRtxThreadBudgetRestore (os_thread_t *thread) {
+
+  thread->budget_state = 0U;
+
+  if (thread->budget_prio == (int8_t)osPriorityNone) {
+    // Not resumed or suspended otherwise in the meantime
+    if (thread->state == osRtxThreadWaitingBudget) {
+      EvrRtxThreadResumed(thread);
+      osRtxThreadDelayRemove(thread);
+      osRtxThreadReadyPut(thread);
+    }
+  } else {
+    thread->priority_base = thread->budget_base;
+    if (thread->priority < thread->priority_base) {
+      thread->priority = thread->priority_base;
+      EvrRtxThreadPriorityUpdated(thread, osRtxThreadPriority(thread));
+      osRtxThreadListSort(thread);
+    }
+  }
+}
+
+/// Replenish exhausted Thread Budgets that are due.
+void osRtxThreadBudgetReplenish (void) {
+  os_thread_t *thread;
+
+  thread = ThreadBudgetList;
+  while ((thread != NULL) &&
+         ((int32_t)(osRtxInfo.kernel.tick - osRtxThreadBudgetEnd(thread)) >= 0)) {
+    ThreadBudgetList    = thread->budget_next;
+    if (ThreadBudgetList != NULL) {
+      ThreadBudgetList->budget_prev = NULL;
+    }
+    thread->budget_time = osRtxThreadBudgetEnd(thread);
+    thread->budget_left = thread->budget;
+    osRtxThreadBudgetRestore(thread);
+    thread = ThreadBudgetList;
+  }
+}
+
+/// Get time until the next Budget replenishment.
+/// \return ticks or osWaitForever when no Budget is exhausted.
+uint32_t osRtxThreadBudgetNext (void) {
+  uint32_t ticks;
+
+  if (ThreadBudgetList == NULL) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return osWaitForever;
+  }
+  ticks = osRtxThreadBudgetEnd(ThreadBudgetList) - osRtxInfo.kernel.tick;
+  if (ticks > 0x7FFFFFFFU) {
+    ticks = 0U;
+  }
+  return ticks;
+}
+
+/// Process Thread Budget Tick (executed each System Tick).
+void osRtxThreadBudgetTick (void) {
+  os_thread_t *thread_running;
+  bool_t       exhausted;
+  uint32_t     elapsed;
 
-  EvrRtxThreadUnblocked(thread, ret_val);
+  thread_running = osRtxThreadGetRunning();
+  exhausted      = FALSE;
+
+  // Charge elapsed tick to the Thread that was running
+  if ((thread_running != NULL) && (thread_running->budget != 0U) &&
+      (thread_running->budget_state == 0U)) {
+    elapsed = osRtxInfo.kernel.tick - thread_running->budget_time;
+    if (elapsed >= thread_running->budget_period) {
+      // Start current Budget period
+      thread_running->budget_time += elapsed - (elapsed % thread_running->budget_period);
+      thread_running->budget_left  = thread_running->budget;
+    }
+    if (thread_running->budget_left != 0U) {
+      thread_running->budget_left--;
+    }
+    if ((thread_running->budget_left == 0U) &&
+        (osRtxKernelGetState() == osRtxKernelRunning)) {
+      exhausted = TRUE;
+    }
+  }
 
-  reg = osRtxThreadRegPtr(thread);
-  reg[0] = ret_val;
+  if (!exhausted && ((ThreadBudgetList == NULL) ||
+      ((int32_t)(osRtxInfo.kernel.tick - osRtxThreadBudgetEnd(ThreadBudgetList)) < 0))) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return;
+  }
 
-  osRtxThreadDelayRemove(thread);
-  if (dispatch) {
-    osRtxThreadDispatch(thread);
-  } else {
-    osRtxThreadReadyPut(thread);
+  // Thread scheduled next is the running Thread for dispatching
+  osRtxThreadSetRunning(osRtxInfo.thread.run.next);
+  if (exhausted) {
+    osRtxThreadBudgetExhausted(thread_running);
   }
+  osRtxThreadBudgetReplenish();
+  osRtxThreadDispatch(NULL);
+  osRtxThreadSetRunning(thread_running);
 }
+#endif
 
-/// Enter Thread wait state.
-/// \param[in]  state           new thread state.
-/// \param[in]  timeout         timeout.
-/// \return true - success, false - failure.
-bool_t osRtxThreadWaitEnter (uint8_t state, uint32_t timeout) {
-  os_thread_t *thread;
+#ifdef RTX_THREAD_WAIT_ANY
+/// Verify that Wait Object is valid.
+/// \param[in]  wait            wait object.
+/// \return true - valid, false - invalid.
+static bool_t IsWaitObjectValid (const osRtxWaitObject_t *wait) {
+  const os_object_t *object = osRtxObject(wait->object_id);
+#ifdef RTX_OBJ_PTR_CHECK
+  //lint --e{923} --e{9078} "cast from pointer to unsigned int" [MISRA Note 7]
+  uintptr_t          addr   = (uintptr_t)object;
+  uintptr_t          offset;
+  bool_t             valid  = FALSE;
 
-  // Check if Kernel is running
-  if (osRtxKernelGetState() != osRtxKernelRunning) {
+  // Check the section boundaries and the object alignment
+  offset = addr - (uintptr_t)&__os_semaphore_cb_start__;
+  if ((offset < (uintptr_t)&__os_semaphore_cb_length__) && ((offset % sizeof(os_semaphore_t)) == 0U)) {
+    valid = TRUE;
+  }
+  offset = addr - (uintptr_t)&__os_evflags_cb_start__;
+  if ((offset < (uintptr_t)&__os_evflags_cb_length__) && ((offset % sizeof(os_event_flags_t)) == 0U)) {
+    valid = TRUE;
+  }
+  offset = addr - (uintptr_t)&__os_msgqueue_cb_start__;
+  if ((offset < (uintptr_t)&__os_msgqueue_cb_length__) && ((offset % sizeof(os_message_queue_t)) == 0U)) {
+    valid = TRUE;
+  }
+  if (!valid) {
     //lint -e{904} "Return statement before end of function" [MISRA Note 1]
     return FALSE;
   }
-
-  // Check if any thread is ready
-  if (osRtxInfo.thread.ready.thread_list == NULL) {
+#else
+  // Check NULL pointer
+  if (object == NULL) {
     //lint -e{904} "Return statement before end of function" [MISRA Note 1]
     return FALSE;
   }
+#endif
 
-  // Get running thread
-  thread = osRtxThreadGetRunning();
+  switch (object->id) {
+    case osRtxIdSemaphore:
+      break;
+    case osRtxIdEventFlags:
+      if ((wait->flags == 0U) ||
+          ((wait->flags & ~(((uint32_t)1U << osRtxEventFlagsLimit) - 1U)) != 0U)) {
+        //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+        return FALSE;
+      }
+      break;
+    case osRtxIdMessageQueue:
+      // FIFO ring buffer is accessed without the Kernel
+      if ((object->attr & osRtxAttrFifo) != 0U) {
+        //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+        return FALSE;
+      }
+      break;
+    default:
+      //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+      return FALSE;
+  }
 
-  EvrRtxThreadBlocked(thread, timeout);
+  return TRUE;
+}
 
-  thread->state = state;
-  osRtxThreadDelayInsert(thread, timeout);
-  thread = osRtxThreadListGet(&osRtxInfo.thread.ready);
-  osRtxThreadSwitch(thread);
+/// Get number of Threads a signaled Wait Object can satisfy.
+/// \param[in]  wait            wait object.
+/// \return number of Threads (0 - not signaled).
+static uint32_t WaitObjectCount (const osRtxWaitObject_t *wait) {
+  os_object_t *object = osRtxObject(wait->object_id);
+  uint32_t     count;
 
-  return TRUE;
+  switch (object->id) {
+    case osRtxIdSemaphore:
+      count = osRtxSemaphoreObject(object)->tokens;
+      break;
+    case osRtxIdEventFlags:
+      // Event Flags are not consumed: satisfy all waiting Threads
+      if ((osRtxEventFlagsObject(object)->event_flags & wait->flags) != 0U) {
+        count = 0xFFFFFFFFU;
+      } else {
+        count = 0U;
+      }
+      break;
+    case osRtxIdMessageQueue:
+      count = osRtxMessageQueueObject(object)->msg_count;
+      break;
+    default:
+      count = 0U;
+      break;
+  }
+
+  return count;
+}
+
+/// Wakeup Threads waiting for multiple Objects when one of them is signaled.
+/// \param[in]  object          signaled object.
+/// \param[in]  dispatch        dispatch flag.
+void osRtxThreadWaitAnyNotify (os_object_t *object, bool_t dispatch) {
+  os_thread_t             *thread;
+  os_thread_t             *thread_next;
+  const osRtxWaitObject_t *objects;
+  const uintptr_t         *reg;
+  uint32_t                 count;
+  uint32_t                 woken;
+  uint32_t                 n;
+
+  woken  = 0U;
+  thread = osRtxInfo.thread.wait_any.thread_list;
+  while (thread != NULL) {
+    thread_next = thread->thread_next;
+    // Wait Objects (R1: const osRtxWaitObject_t *objects, R2: uint32_t count)
+    reg     = osRtxThreadRegPtr(thread);
+    //lint -e{923} -e{9078} "cast from unsigned int to pointer"
+    objects = (const osRtxWaitObject_t *)reg[1];
+    count   = (uint32_t)reg[2];
+    for (n = 0U; n < count; n++) {
+      if (osRtxObject(objects[n].object_id) == object) {
+        break;
+      }
+    }
+    // Wakeup Threads with highest Priority first, up to the available count
+    if ((n < count) && (WaitObjectCount(&objects[n]) > woken)) {
+      osRtxThreadListRemove(thread);
+      osRtxThreadWaitExit(thread, n, FALSE);
+      woken++;
+    }
+    thread = thread_next;
+  }
+
+  if (dispatch && (woken != 0U)) {
+    osRtxThreadDispatch(NULL);
+  }
+}
+
+/// Unblock Threads waiting for multiple Objects when one of them is deleted.
+/// \param[in]  object          deleted object.
+/// \param[in]  dispatch        dispatch flag.
+void osRtxThreadWaitAnyDelete (const os_object_t *object, bool_t dispatch) {
+  os_thread_t             *thread;
+  os_thread_t             *thread_next;
+  const osRtxWaitObject_t *objects;
+  const uintptr_t         *reg;
+  uint32_t                 count;
+  uint32_t                 woken;
+  uint32_t                 n;
+
+  woken  = 0U;
+  thread = osRtxInfo.thread.wait_any.thread_list;
+  while (thread != NULL) {
+    thread_next = thread->thread_next;
+    // Wait Objects (R1: const osRtxWaitObject_t *objects, R2: uint32_t count)
+    reg     = osRtxThreadRegPtr(thread);
+    //lint -e{923} -e{9078} "cast from unsigned int to pointer"
+    objects = (const osRtxWaitObject_t *)reg[1];
+    count   = (uint32_t)reg[2];
+    for (n = 0U; n < count; n++) {
+      if (osRtxObject(objects[n].object_id) == object) {
+        osRtxThreadListRemove(thread);
+        osRtxThreadWaitExit(thread, (uint32_t)osErrorResource, FALSE);
+        woken++;
+        break;
+      }
+    }
+    thread = thread_next;
+  }
+
+  if (dispatch && (woken != 0U)) {
+    osRtxThreadDispatch(NULL);
+  }
 }
+#endif
 
 #ifdef RTX_STACK_CHECK
 /// Check current running Thread Stack.
@@ -591,7 +1362,7 @@ bool_t osRtxThreadStackCheck (const os_thread_t *thread) {
 
   //lint -e{923} "cast from pointer to unsigned int"
   //lint -e{9079} -e{9087} "cast between pointers to different object types"
-  if ((thread->sp <= (uint32_t)thread->stack_mem) ||
+  if ((thread->sp <= (uintptr_t)thread->stack_mem) ||
       (*((uint32_t *)thread->stack_mem) != osRtxStackMagicWord)) {
     //lint -e{904} "Return statement before end of function" [MISRA Note 1]
     return FALSE;
@@ -742,9 +1513,11 @@ static osThreadId_t svcRtxThreadNew (osThreadFunc_t func, void *argument, const
   void              *stack_mem;
   uint32_t           stack_size;
   osPriority_t       priority;
+  uint32_t           affinity;
   uint8_t            flags;
   const char        *name;
   uint32_t          *ptr;
+  uintptr_t         *frame;
   uint32_t           n;
 #ifdef RTX_TZ_CONTEXT
   TZ_ModuleId_t      tz_module;
@@ -768,6 +1541,7 @@ static osThreadId_t svcRtxThreadNew (osThreadFunc_t func, void *argument, const
     stack_mem  = attr->stack_mem;
     stack_size = attr->stack_size;
     priority   = attr->priority;
+    affinity   = attr->affinity_mask;
 #ifdef RTX_TZ_CONTEXT
     tz_module  = attr->tz_module;
 #endif
@@ -806,7 +1580,7 @@ static osThreadId_t svcRtxThreadNew (osThreadFunc_t func, void *argument, const
     }
     if (stack_mem != NULL) {
       //lint -e{923} "cast from pointer to unsigned int" [MISRA Note 7]
-      if ((((uint32_t)stack_mem & 7U) != 0U) || (stack_size == 0U)) {
+      if ((((uintptr_t)stack_mem & 7U) != 0U) || (stack_size == 0U)) {
         EvrRtxThreadError(NULL, osRtxErrorInvalidThreadStack);
         //lint -e{904} "Return statement before end of function" [MISRA Note 1]
         return NULL;
@@ -821,6 +1595,11 @@ static osThreadId_t svcRtxThreadNew (osThreadFunc_t func, void *argument, const
         return NULL;
       }
     }
+    if (!IsAffinityMaskValid(affinity)) {
+      EvrRtxThreadError(NULL, (int32_t)osErrorParameter);
+      //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+      return NULL;
+    }
   } else {
     name       = NULL;
     attr_bits  = 0U;
@@ -828,6 +1607,7 @@ static osThreadId_t svcRtxThreadNew (osThreadFunc_t func, void *argument, const
     stack_mem  = NULL;
     stack_size = 0U;
     priority   = osPriorityNormal;
+    affinity   = 0U;
 #ifdef RTX_TZ_CONTEXT
     tz_module  = 0U;
 #endif
@@ -981,9 +1761,11 @@ static osThreadId_t svcRtxThreadNew (osThreadFunc_t func, void *argument, const
     thread->name          = name;
     thread->thread_next   = NULL;
     thread->thread_prev   = NULL;
+    thread->list_root     = NULL;
     thread->delay_next    = NULL;
     thread->delay_prev    = NULL;
     thread->thread_join   = NULL;
+    thread->post_next     = NULL;
     thread->delay         = 0U;
     thread->priority      = (int8_t)priority;
     thread->priority_base = (int8_t)priority;
@@ -994,8 +1776,9 @@ static osThreadId_t svcRtxThreadNew (osThreadFunc_t func, void *argument, const
     thread->mutex_list    = NULL;
     thread->stack_mem     = stack_mem;
     thread->stack_size    = stack_size;
-    thread->sp            = (uint32_t)stack_mem + stack_size - 64U;
-    thread->thread_addr   = (uint32_t)func;
+    thread->sp            = (uintptr_t)stack_mem + stack_size - (16U*sizeof(uintptr_t));
+    thread->thread_addr   = (uintptr_t)func;
+    thread->affinity      = (uint8_t)affinity;
   #ifdef RTX_TZ_CONTEXT
     thread->tz_memory     = tz_memory;
   #endif
@@ -1032,28 +1815,50 @@ static osThreadId_t svcRtxThreadNew (osThreadFunc_t func, void *argument, const
     thread->wdog_next     = NULL;
     thread->wdog_tick     = 0U;
   #endif
+    thread->budget_state  = 0U;
+  #ifdef RTX_THREAD_RUN_TIME
+    thread->run_time      = 0U;
+    thread->run_time_hi   = 0U;
+    thread->preempt       = 0U;
+    thread->yield         = 0U;
+  #endif
+  #ifdef RTX_THREAD_EDF
+    thread->period        = 0U;
+    thread->deadline_rel  = 0U;
+    thread->deadline      = 0U;
+  #endif
+  #ifdef RTX_THREAD_BUDGET
+    thread->budget_next   = NULL;
+    thread->budget_prev   = NULL;
+    thread->budget        = 0U;
+    thread->budget_period = 0U;
+    thread->budget_left   = 0U;
+    thread->budget_time   = 0U;
+    thread->budget_prio   = 0;
+    thread->budget_base   = 0;
+  #endif
 
     // Initialize stack
     //lint --e{613} false detection: "Possible use of null pointer"
     ptr = (uint32_t *)stack_mem;
     ptr[0] = osRtxStackMagicWord;
     if ((osRtxConfig.flags & osRtxConfigStackWatermark) != 0U) {
-      for (n = (stack_size/4U) - (16U + 1U); n != 0U; n--) {
+      for (n = ((stack_size - (16U*sizeof(uintptr_t)))/4U) - 1U; n != 0U; n--) {
          ptr++;
         *ptr = osRtxStackFillPattern;
       }
     }
-    ptr = (uint32_t *)thread->sp;
+    frame = (uintptr_t *)thread->sp;
     for (n = 0U; n != 14U; n++) {
-      ptr[n] = 0U;                      // R4..R11, R0..R3, R12, LR
+      frame[n] = 0U;                      // R4..R11, R0..R3, R12, LR
     }
-    ptr[14] = (uint32_t)osThreadEntry;  // PC
-    ptr[15] = xPSR_InitVal(
-                (bool_t)((attr_bits & osThreadPrivileged) != 0U),
-                (bool_t)(((uint32_t)func & 1U) != 0U)
-              );                        // xPSR
-    ptr[8]  = (uint32_t)argument;       // R0
-    ptr[9]  = (uint32_t)func;           // R1
+    frame[14] = (uintptr_t)osThreadEntry; // PC
+    frame[15] = xPSR_InitVal(
+                  (bool_t)((attr_bits & osThreadPrivileged) != 0U),
+                  (bool_t)(((uintptr_t)func & 1U) != 0U)
+                );                        // xPSR
+    frame[8]  = (uintptr_t)argument;      // R0
+    frame[9]  = (uintptr_t)func;          // R1
 
     // Register post ISR processing function
     osRtxInfo.post_process.thread = osRtxThreadPostProcess;
@@ -1127,99 +1932,381 @@ static uint32_t svcRtxThreadGetZone (osThreadId_t thread_id) {
   return thread->zone;
 #else
   (void)thread_id;
-  return osErrorId;
+  return osErrorId;
+#endif
+}
+
+/// Return the thread ID of the current running thread.
+/// \note API identical to osThreadGetId
+static osThreadId_t svcRtxThreadGetId (void) {
+  os_thread_t *thread;
+
+  thread = osRtxThreadGetRunning();
+  EvrRtxThreadGetId(thread);
+  return thread;
+}
+
+/// Get current thread state of a thread.
+/// \note API identical to osThreadGetState
+static osThreadState_t svcRtxThreadGetState (osThreadId_t thread_id) {
+  os_thread_t    *thread = osRtxThreadId(thread_id);
+  osThreadState_t state;
+
+  // Check parameters
+  if (!IsThreadPtrValid(thread) || (thread->id != osRtxIdThread)) {
+    EvrRtxThreadGetState(thread, osThreadError);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return osThreadError;
+  }
+
+  state = osRtxThreadState(thread);
+
+  EvrRtxThreadGetState(thread, state);
+
+  return state;
+}
+
+/// Get stack size of a thread.
+/// \note API identical to osThreadGetStackSize
+static uint32_t svcRtxThreadGetStackSize (osThreadId_t thread_id) {
+  os_thread_t *thread = osRtxThreadId(thread_id);
+
+  // Check parameters
+  if (!IsThreadPtrValid(thread) || (thread->id != osRtxIdThread)) {
+    EvrRtxThreadGetStackSize(thread, 0U);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return 0U;
+  }
+
+  EvrRtxThreadGetStackSize(thread, thread->stack_size);
+
+  return thread->stack_size;
+}
+
+/// Get available stack space of a thread based on stack watermark recording during execution.
+/// \note API identical to osThreadGetStackSpace
+static uint32_t svcRtxThreadGetStackSpace (osThreadId_t thread_id) {
+  os_thread_t    *thread = osRtxThreadId(thread_id);
+  const uint32_t *stack;
+        uint32_t  space;
+
+  // Check parameters
+  if (!IsThreadPtrValid(thread) || (thread->id != osRtxIdThread)) {
+    EvrRtxThreadGetStackSpace(thread, 0U);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return 0U;
+  }
+
+  // Check if stack watermark is not enabled
+  if ((osRtxConfig.flags & osRtxConfigStackWatermark) == 0U) {
+    EvrRtxThreadGetStackSpace(thread, 0U);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return 0U;
+  }
+
+  //lint -e{9079} "conversion from pointer to void to pointer to other type"
+  stack = thread->stack_mem;
+  if (*stack++ == osRtxStackMagicWord) {
+    for (space = 4U; space < thread->stack_size; space += 4U) {
+      if (*stack++ != osRtxStackFillPattern) {
+        break;
+      }
+    }
+  } else {
+    space = 0U;
+  }
+
+  EvrRtxThreadGetStackSpace(thread, space);
+
+  return space;
+}
+
+/// Get run time information of a thread.
+/// \note API identical to osRtxThreadGetRunTime
+static osStatus_t svcRtxThreadGetRunTime (osThreadId_t thread_id, osRtxThreadRunTime_t *run_time) {
+#ifdef RTX_THREAD_RUN_TIME
+  os_thread_t *thread = osRtxThreadId(thread_id);
+
+  // Check parameters
+  if (!IsThreadPtrValid(thread) || (thread->id != osRtxIdThread) || (run_time == NULL)) {
+    EvrRtxThreadError(thread, (int32_t)osErrorParameter);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return osErrorParameter;
+  }
+
+  // Account time of the running Thread
+  osRtxThreadRunTimeUpdate();
+
+  run_time->run_time = ((uint64_t)thread->run_time_hi << 32) | thread->run_time;
+  run_time->preempt  = thread->preempt;
+  run_time->yield    = thread->yield;
+
+  return osOK;
+#else
+  (void)thread_id;
+  (void)run_time;
+  return osError;
+#endif
+}
+
+/// Assign deadline scheduling parameters to a thread.
+/// \note API identical to osRtxThreadSetDeadline
+static osStatus_t svcRtxThreadSetDeadline (osThreadId_t thread_id, uint32_t period, uint32_t deadline) {
+#ifdef RTX_THREAD_EDF
+  os_thread_t       *thread = osRtxThreadId(thread_id);
+#ifdef RTX_SAFETY_CLASS
+  const os_thread_t *thread_running;
+#endif
+
+  if (deadline == 0U) {
+    // Implicit deadline at the end of the period
+    deadline = period;
+  }
+
+  // Check parameters
+  if (!IsThreadPtrValid(thread) || (thread->id != osRtxIdThread) ||
+      (period > 0x7FFFFFFFU) || (deadline > period)) {
+    EvrRtxThreadError(thread, (int32_t)osErrorParameter);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return osErrorParameter;
+  }
+
+#ifdef RTX_SAFETY_CLASS
+  // Check running thread safety class
+  thread_running = osRtxThreadGetRunning();
+  if ((thread_running != NULL) &&
+      ((thread_running->attr >> osRtxAttrClass_Pos) < (thread->attr >> osRtxAttrClass_Pos))) {
+    EvrRtxThreadError(thread, (int32_t)osErrorSafetyClass);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return osErrorSafetyClass;
+  }
+#endif
+
+  // Check object state
+  if (thread->state == osRtxThreadTerminated) {
+    EvrRtxThreadError(thread, (int32_t)osErrorResource);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return osErrorResource;
+  }
+
+  thread->period       = period;
+  thread->deadline_rel = deadline;
+  thread->flags       &= (uint8_t)~osRtxThreadFlagMissed;
+  if (period != 0U) {
+    // First job is released now
+    thread->deadline = osRtxInfo.kernel.tick + deadline;
+    thread->flags   |= osRtxThreadFlagDeadline;
+    if (thread->priority   != (int8_t)OS_THREAD_EDF_PRIO) {
+      thread->priority      = (int8_t)OS_THREAD_EDF_PRIO;
+      thread->priority_base = (int8_t)OS_THREAD_EDF_PRIO;
+      EvrRtxThreadPriorityUpdated(thread, (osPriority_t)OS_THREAD_EDF_PRIO);
+    }
+  } else {
+    thread->deadline = 0U;
+    thread->flags   &= (uint8_t)~osRtxThreadFlagDeadline;
+  }
+  osRtxThreadListSort(thread);
+  osRtxThreadDispatch(NULL);
+
+  return osOK;
+#else
+  (void)thread_id;
+  (void)period;
+  (void)deadline;
+  return osError;
 #endif
 }
 
-/// Return the thread ID of the current running thread.
-/// \note API identical to osThreadGetId
-static osThreadId_t svcRtxThreadGetId (void) {
+/// Complete the current job of the running thread and wait for its next period.
+/// \note API identical to osRtxThreadWaitPeriod
+static osStatus_t svcRtxThreadWaitPeriod (void) {
+#ifdef RTX_THREAD_EDF
   os_thread_t *thread;
+  uint32_t     release;
+  uint32_t     ticks;
 
   thread = osRtxThreadGetRunning();
-  EvrRtxThreadGetId(thread);
-  return thread;
-}
-
-/// Get current thread state of a thread.
-/// \note API identical to osThreadGetState
-static osThreadState_t svcRtxThreadGetState (osThreadId_t thread_id) {
-  os_thread_t    *thread = osRtxThreadId(thread_id);
-  osThreadState_t state;
 
-  // Check parameters
-  if (!IsThreadPtrValid(thread) || (thread->id != osRtxIdThread)) {
-    EvrRtxThreadGetState(thread, osThreadError);
+  // Check object state
+  if ((thread->flags & osRtxThreadFlagDeadline) == 0U) {
+    EvrRtxThreadError(thread, (int32_t)osErrorResource);
     //lint -e{904} "Return statement before end of function" [MISRA Note 1]
-    return osThreadError;
+    return osErrorResource;
   }
 
-  state = osRtxThreadState(thread);
+  // Check current job completion against its deadline
+  osRtxThreadDeadlineCheck(thread);
 
-  EvrRtxThreadGetState(thread, state);
+  // Next job is released one period after the current one
+  release          = (thread->deadline - thread->deadline_rel) + thread->period;
+  thread->deadline = release + thread->deadline_rel;
+  thread->flags   &= (uint8_t)~osRtxThreadFlagMissed;
 
-  return state;
+  ticks = release - osRtxInfo.kernel.tick;
+  if ((ticks == 0U) || (ticks > 0x7FFFFFFFU)) {
+    // Next job is already released: continue with its deadline
+    osRtxThreadDispatch(NULL);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return osOK;
+  }
+
+  if (!osRtxThreadWaitEnter(osRtxThreadWaitingDelay, ticks)) {
+    EvrRtxThreadError(thread, (int32_t)osError);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return osError;
+  }
+
+  return osOK;
+#else
+  return osError;
+#endif
 }
 
-/// Get stack size of a thread.
-/// \note API identical to osThreadGetStackSize
-static uint32_t svcRtxThreadGetStackSize (osThreadId_t thread_id) {
-  os_thread_t *thread = osRtxThreadId(thread_id);
+/// Assign an execution budget to a thread.
+/// \note API identical to osRtxThreadSetBudget
+static osStatus_t svcRtxThreadSetBudget (osThreadId_t thread_id, uint32_t budget, uint32_t period, osPriority_t priority) {
+#ifdef RTX_THREAD_BUDGET
+  os_thread_t       *thread = osRtxThreadId(thread_id);
+#ifdef RTX_SAFETY_CLASS
+  const os_thread_t *thread_running;
+#endif
+
+  if (budget == 0U) {
+    // Remove Budget
+    period   = 0U;
+    priority = osPriorityNone;
+  }
 
   // Check parameters
-  if (!IsThreadPtrValid(thread) || (thread->id != osRtxIdThread)) {
-    EvrRtxThreadGetStackSize(thread, 0U);
+  if (!IsThreadPtrValid(thread) || (thread->id != osRtxIdThread) ||
+      (thread == osRtxInfo.thread.idle) ||
+      (budget > period) || (period > 0x7FFFFFFFU) ||
+      ((priority != osPriorityNone) &&
+       ((priority < osPriorityIdle) || (priority > osPriorityISR)))) {
+    EvrRtxThreadError(thread, (int32_t)osErrorParameter);
     //lint -e{904} "Return statement before end of function" [MISRA Note 1]
-    return 0U;
+    return osErrorParameter;
   }
 
-  EvrRtxThreadGetStackSize(thread, thread->stack_size);
+#ifdef RTX_SAFETY_CLASS
+  // Check running thread safety class
+  thread_running = osRtxThreadGetRunning();
+  if ((thread_running != NULL) &&
+      ((thread_running->attr >> osRtxAttrClass_Pos) < (thread->attr >> osRtxAttrClass_Pos))) {
+    EvrRtxThreadError(thread, (int32_t)osErrorSafetyClass);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return osErrorSafetyClass;
+  }
+#endif
 
-  return thread->stack_size;
+  // Check object state
+  if (thread->state == osRtxThreadTerminated) {
+    EvrRtxThreadError(thread, (int32_t)osErrorResource);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return osErrorResource;
+  }
+
+  // Restore Thread with exhausted Budget
+  if (thread->budget_state != 0U) {
+    osRtxThreadBudgetRemove(thread);
+    osRtxThreadBudgetRestore(thread);
+  }
+
+  // First Budget period starts now
+  thread->budget        = budget;
+  thread->budget_period = period;
+  thread->budget_left   = budget;
+  thread->budget_time   = osRtxInfo.kernel.tick;
+  thread->budget_prio   = (int8_t)priority;
+
+  osRtxThreadDispatch(NULL);
+
+  return osOK;
+#else
+  (void)thread_id;
+  (void)budget;
+  (void)period;
+  (void)priority;
+  return osError;
+#endif
 }
 
-/// Get available stack space of a thread based on stack watermark recording during execution.
-/// \note API identical to osThreadGetStackSpace
-static uint32_t svcRtxThreadGetStackSpace (osThreadId_t thread_id) {
-  os_thread_t    *thread = osRtxThreadId(thread_id);
-  const uint32_t *stack;
-        uint32_t  space;
+/// Wait for one of multiple Objects to become signaled.
+/// \note API identical to osRtxThreadWaitAny except for parameter order:
+///       a waiting Thread keeps the Wait Objects in R1 and R2 (R0 returns the status)
+static int32_t svcRtxThreadWaitAny (uint32_t timeout, const osRtxWaitObject_t *objects, uint32_t count) {
+#ifdef RTX_THREAD_WAIT_ANY
+  os_thread_t       *thread;
+#ifdef RTX_SAFETY_CLASS
+  const os_object_t *object;
+#endif
+  int32_t            status;
+  uint32_t           n;
+
+  thread = osRtxThreadGetRunning();
 
   // Check parameters
-  if (!IsThreadPtrValid(thread) || (thread->id != osRtxIdThread)) {
-    EvrRtxThreadGetStackSpace(thread, 0U);
+  if ((objects == NULL) || (count == 0U) || (count > osRtxWaitObjectLimit)) {
+    EvrRtxThreadError(thread, (int32_t)osErrorParameter);
     //lint -e{904} "Return statement before end of function" [MISRA Note 1]
-    return 0U;
+    return ((int32_t)osErrorParameter);
+  }
+  for (n = 0U; n < count; n++) {
+    if (!IsWaitObjectValid(&objects[n])) {
+      EvrRtxThreadError(thread, (int32_t)osErrorParameter);
+      //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+      return ((int32_t)osErrorParameter);
+    }
+#ifdef RTX_SAFETY_CLASS
+    // Check running thread safety class
+    object = osRtxObject(objects[n].object_id);
+    if ((thread != NULL) &&
+        ((thread->attr >> osRtxAttrClass_Pos) < (object->attr >> osRtxAttrClass_Pos))) {
+      EvrRtxThreadError(thread, (int32_t)osErrorSafetyClass);
+      //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+      return ((int32_t)osErrorSafetyClass);
+    }
+#endif
   }
 
-  // Check if stack watermark is not enabled
-  if ((osRtxConfig.flags & osRtxConfigStackWatermark) == 0U) {
-    EvrRtxThreadGetStackSpace(thread, 0U);
-    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
-    return 0U;
+  // Check if an Object is signaled
+  for (n = 0U; n < count; n++) {
+    if (WaitObjectCount(&objects[n]) != 0U) {
+      break;
+    }
   }
 
-  //lint -e{9079} "conversion from pointer to void to pointer to other type"
-  stack = thread->stack_mem;
-  if (*stack++ == osRtxStackMagicWord) {
-    for (space = 4U; space < thread->stack_size; space += 4U) {
-      if (*stack++ != osRtxStackFillPattern) {
-        break;
+  if (n < count) {
+    status = (int32_t)n;
+  } else {
+    // Check if timeout is specified
+    if (timeout != 0U) {
+      // Suspend current Thread
+      if (osRtxThreadWaitEnter(osRtxThreadWaitingAny, timeout)) {
+        osRtxThreadListPut(&osRtxInfo.thread.wait_any, thread);
+      } else {
+        EvrRtxThreadError(thread, (int32_t)osErrorTimeout);
       }
+      status = (int32_t)osErrorTimeout;
+    } else {
+      status = (int32_t)osErrorResource;
     }
-  } else {
-    space = 0U;
   }
 
-  EvrRtxThreadGetStackSpace(thread, space);
-
-  return space;
+  return status;
+#else
+  (void)timeout;
+  (void)objects;
+  (void)count;
+  return ((int32_t)osError);
+#endif
 }
 
 /// Change priority of a thread.
 /// \note API identical to osThreadSetPriority
 static osStatus_t svcRtxThreadSetPriority (osThreadId_t thread_id, osPriority_t priority) {
   os_thread_t       *thread = osRtxThreadId(thread_id);
+  int8_t             priority_new;
 #ifdef RTX_SAFETY_CLASS
   const os_thread_t *thread_running;
 #endif
@@ -1250,11 +2337,26 @@ static osStatus_t svcRtxThreadSetPriority (osThreadId_t thread_id, osPriority_t
     return osErrorResource;
   }
 
-  if (thread->priority   != (int8_t)priority) {
-    thread->priority      = (int8_t)priority;
-    thread->priority_base = (int8_t)priority;
+#ifdef RTX_THREAD_BUDGET
+  if ((thread->budget_state != 0U) && (thread->budget_prio != (int8_t)osPriorityNone)) {
+    // Thread is demoted: new priority applies when the Budget is replenished
+    thread->budget_base = (int8_t)priority;
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return osOK;
+  }
+#endif
+
+  // Effective priority keeps ceiling and inherited priority of owned Mutexes
+  thread->priority_base = (int8_t)priority;
+  priority_new = osRtxMutexThreadPriority(thread);
+  if (thread->priority != priority_new) {
+    thread->priority    = priority_new;
     EvrRtxThreadPriorityUpdated(thread, priority);
     osRtxThreadListSort(thread);
+    if (thread->state == osRtxThreadWaitingMutex) {
+      // Update priority inherited by the Mutex owner
+      osRtxMutexOwnerRestore(osRtxMutexObject(osRtxObject(thread->list_root)), NULL);
+    }
     osRtxThreadDispatch(NULL);
   }
 
@@ -1303,6 +2405,11 @@ static osStatus_t svcRtxThreadYield (void) {
       osRtxThreadReadyPut(thread_running);
       EvrRtxThreadPreempted(thread_running);
       osRtxThreadSwitch(thread_ready);
+#ifdef RTX_THREAD_RUN_TIME
+      // Yield is a voluntary context switch
+      thread_running->preempt--;
+      thread_running->yield++;
+#endif
     }
   }
 
@@ -1368,7 +2475,7 @@ static osStatus_t svcRtxThreadSuspend (osThreadId_t thread_id) {
     EvrRtxThreadSuspended(thread);
 
     if (thread->state == osRtxThreadRunning) {
-      osRtxThreadSwitch(osRtxThreadListGet(&osRtxInfo.thread.ready));
+      osRtxThreadSwitch(osRtxThreadReadyGet());
     }
 
     // Update Thread State and put it into Delay list
@@ -1441,6 +2548,11 @@ static void osRtxThreadFree (os_thread_t *thread) {
 
   osRtxThreadBeforeFree(thread);
 
+  // Complete pending post ISR processing
+  if (thread->post_next != NULL) {
+    osRtxPostProcessFlush();
+  }
+
   // Mark object as inactive and invalid
   thread->state = osRtxThreadInactive;
   thread->id    = osRtxIdInvalid;
@@ -1482,6 +2594,14 @@ static void osRtxThreadFree (os_thread_t *thread) {
 /// \param[in]  thread          thread object.
 void osRtxThreadDestroy (os_thread_t *thread) {
 
+#ifdef RTX_THREAD_BUDGET
+  // Remove Thread from the Budget list
+  if (thread->budget_state != 0U) {
+    thread->budget_state = 0U;
+    osRtxThreadBudgetRemove(thread);
+  }
+#endif
+
   if ((thread->attr & osThreadJoinable) == 0U) {
     osRtxThreadFree(thread);
   } else {
@@ -1630,7 +2750,7 @@ static void svcRtxThreadExit (void) {
   osRtxThreadJoinWakeup(thread);
 
   // Switch to next Ready Thread
-  osRtxThreadSwitch(osRtxThreadListGet(&osRtxInfo.thread.ready));
+  osRtxThreadSwitch(osRtxThreadReadyGet());
 
   // Update Stack Pointer
   thread->sp = __get_PSP();
@@ -1718,7 +2838,7 @@ static osStatus_t svcRtxThreadTerminate (osThreadId_t thread_id) {
 
     // Switch to next Ready Thread when terminating running Thread
     if (thread->state == osRtxThreadRunning) {
-      osRtxThreadSwitch(osRtxThreadListGet(&osRtxInfo.thread.ready));
+      osRtxThreadSwitch(osRtxThreadReadyGet());
       // Update Stack Pointer
       thread->sp = __get_PSP();
 #ifdef RTX_STACK_CHECK
@@ -1832,9 +2952,9 @@ static osStatus_t svcRtxThreadSuspendClass (uint32_t safety_class, uint32_t mode
   }
 
   // Threads in Delay List
-  thread = osRtxInfo.thread.delay_list;
+  thread = osRtxThreadDelayFirst();
   while (thread != NULL) {
-    thread_next = thread->delay_next;
+    thread_next = osRtxThreadDelayNext(thread);
     if ((((mode & osSafetyWithSameClass)  != 0U) &&
          ((thread->attr >> osRtxAttrClass_Pos) == (uint8_t)safety_class)) ||
         (((mode & osSafetyWithLowerClass) != 0U) &&
@@ -1876,7 +2996,7 @@ static osStatus_t svcRtxThreadSuspendClass (uint32_t safety_class, uint32_t mode
       thread->state = osRtxThreadBlocked;
       osRtxThreadDelayInsert(thread, osWaitForever);
       EvrRtxThreadSuspended(thread);
-      osRtxThreadSwitch(osRtxThreadListGet(&osRtxInfo.thread.ready));
+      osRtxThreadSwitch(osRtxThreadReadyGet());
     } else {
       EvrRtxThreadError(thread, (int32_t)osErrorResource);
       //lint -e{904} "Return statement before end of function" [MISRA Note 1]
@@ -1937,9 +3057,9 @@ static osStatus_t svcRtxThreadResumeClass (uint32_t safety_class, uint32_t mode)
   }
 
   // Threads in Delay List
-  thread = osRtxInfo.thread.delay_list;
+  thread = osRtxThreadDelayFirst();
   while (thread != NULL) {
-    thread_next = thread->delay_next;
+    thread_next = osRtxThreadDelayNext(thread);
     if ((((mode & osSafetyWithSameClass)  != 0U) &&
          ((thread->attr >> osRtxAttrClass_Pos) == (uint8_t)safety_class)) ||
         (((mode & osSafetyWithLowerClass) != 0U) &&
@@ -2004,9 +3124,9 @@ static osStatus_t svcRtxThreadTerminateZone (uint32_t zone) {
   }
 
   // Threads in Delay List
-  thread = osRtxInfo.thread.delay_list;
+  thread = osRtxThreadDelayFirst();
   while (thread != NULL) {
-    thread_next = thread->delay_next;
+    thread_next = osRtxThreadDelayNext(thread);
     if (thread->zone == zone) {
       osRtxThreadListRemove(thread);
       osRtxThreadDelayRemove(thread);
@@ -2052,7 +3172,7 @@ static osStatus_t svcRtxThreadTerminateZone (uint32_t zone) {
     osRtxMutexOwnerRelease(thread->mutex_list);
     osRtxThreadJoinWakeup(thread);
     // Switch to next Ready Thread
-    osRtxThreadSwitch(osRtxThreadListGet(&osRtxInfo.thread.ready));
+    osRtxThreadSwitch(osRtxThreadReadyGet());
     // Update Stack Pointer
     thread->sp = __get_PSP();
 #ifdef RTX_STACK_CHECK
@@ -2080,16 +3200,62 @@ static osStatus_t svcRtxThreadTerminateZone (uint32_t zone) {
 /// Set processor affinity mask of a thread.
 /// \note API identical to osThreadSetAffinityMask
 static osStatus_t svcRtxThreadSetAffinityMask (osThreadId_t thread_id, uint32_t affinity_mask) {
-  (void)thread_id;
-  (void)affinity_mask;
-  return osError;
+  os_thread_t       *thread = osRtxThreadId(thread_id);
+#ifdef RTX_SAFETY_CLASS
+  const os_thread_t *thread_running;
+#endif
+
+  // Check parameters
+  if (!IsThreadPtrValid(thread) || (thread->id != osRtxIdThread) ||
+      !IsAffinityMaskValid(affinity_mask)) {
+    EvrRtxThreadError(thread, (int32_t)osErrorParameter);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return osErrorParameter;
+  }
+
+#ifdef RTX_SAFETY_CLASS
+  // Check running thread safety class
+  thread_running = osRtxThreadGetRunning();
+  if ((thread_running != NULL) &&
+      ((thread_running->attr >> osRtxAttrClass_Pos) < (thread->attr >> osRtxAttrClass_Pos))) {
+    EvrRtxThreadError(thread, (int32_t)osErrorSafetyClass);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return osErrorSafetyClass;
+  }
+#endif
+
+  // Check object state
+  if (thread->state == osRtxThreadTerminated) {
+    EvrRtxThreadError(thread, (int32_t)osErrorResource);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return osErrorResource;
+  }
+
+  thread->affinity = (uint8_t)affinity_mask;
+
+  return osOK;
 }
 
 /// Get current processor affinity mask of a thread.
 /// \note API identical to osThreadGetAffinityMask
 static uint32_t svcRtxThreadGetAffinityMask (osThreadId_t thread_id) {
-  (void)thread_id;
-  return 0U;
+  os_thread_t *thread = osRtxThreadId(thread_id);
+
+  // Check parameters
+  if (!IsThreadPtrValid(thread) || (thread->id != osRtxIdThread)) {
+    EvrRtxThreadError(thread, (int32_t)osErrorParameter);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return 0U;
+  }
+
+  // Check object state
+  if (thread->state == osRtxThreadTerminated) {
+    EvrRtxThreadError(thread, (int32_t)osErrorResource);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return 0U;
+  }
+
+  return thread->affinity;
 }
 
 /// Get number of active threads.
@@ -2108,8 +3274,8 @@ static uint32_t svcRtxThreadGetCount (void) {
   }
 
   // Delay List
-  for (thread = osRtxInfo.thread.delay_list;
-       thread != NULL; thread = thread->delay_next) {
+  for (thread = osRtxThreadDelayFirst();
+       thread != NULL; thread = osRtxThreadDelayNext(thread)) {
     count++;
   }
 
@@ -2151,8 +3317,8 @@ static uint32_t svcRtxThreadEnumerate (osThreadId_t *thread_array, uint32_t arra
   }
 
   // Delay List
-  for (thread = osRtxInfo.thread.delay_list;
-       (thread != NULL) && (count < array_items); thread = thread->delay_next) {
+  for (thread = osRtxThreadDelayFirst();
+       (thread != NULL) && (count < array_items); thread = osRtxThreadDelayNext(thread)) {
     *thread_array = thread;
      thread_array++;
      count++;
@@ -2331,6 +3497,11 @@ SVC0_0 (ThreadGetId,         osThreadId_t)
 SVC0_1 (ThreadGetState,      osThreadState_t, osThreadId_t)
 SVC0_1 (ThreadGetStackSize,  uint32_t,        osThreadId_t)
 SVC0_1 (ThreadGetStackSpace, uint32_t,        osThreadId_t)
+SVC0_2 (ThreadGetRunTime,    osStatus_t,      osThreadId_t, osRtxThreadRunTime_t *)
+SVC0_3 (ThreadSetDeadline,   osStatus_t,      osThreadId_t, uint32_t, uint32_t)
+SVC0_0 (ThreadWaitPeriod,    osStatus_t)
+SVC0_4 (ThreadSetBudget,     osStatus_t,      osThreadId_t, uint32_t, uint32_t, osPriority_t)
+SVC0_3 (ThreadWaitAny,       int32_t,         uint32_t, const osRtxWaitObject_t *, uint32_t)
 SVC0_2 (ThreadSetPriority,   osStatus_t,      osThreadId_t, osPriority_t)
 SVC0_1 (ThreadGetPriority,   osPriority_t,    osThreadId_t)
 SVC0_0 (ThreadYield,         osStatus_t)
@@ -2424,6 +3595,15 @@ bool_t osRtxThreadStartup (void) {
     ret = TRUE;
   }
 
+#ifdef RTX_WORK_QUEUE
+  // Create Work Thread
+  if ((ret != FALSE) && (osRtxConfig.work_thread_attr != NULL)) {
+    if (svcRtxThreadNew(osRtxWorkThread, NULL, osRtxConfig.work_thread_attr) == NULL) {
+      ret = FALSE;
+    }
+  }
+#endif
+
   return ret;
 }
 
@@ -2531,6 +3711,71 @@ uint32_t osThreadGetStackSpace (osThreadId_t thread_id) {
   return stack_space;
 }
 
+/// Get run time information of a thread.
+osStatus_t osRtxThreadGetRunTime (osThreadId_t thread_id, osRtxThreadRunTime_t *run_time) {
+  osStatus_t status;
+
+  if (IsException() || IsIrqMasked()) {
+    EvrRtxThreadError(thread_id, (int32_t)osErrorISR);
+    status = osErrorISR;
+  } else {
+    status = __svcThreadGetRunTime(thread_id, run_time);
+  }
+  return status;
+}
+
+/// Assign deadline scheduling parameters to a thread.
+osStatus_t osRtxThreadSetDeadline (osThreadId_t thread_id, uint32_t period, uint32_t deadline) {
+  osStatus_t status;
+
+  if (IsException() || IsIrqMasked()) {
+    EvrRtxThreadError(thread_id, (int32_t)osErrorISR);
+    status = osErrorISR;
+  } else {
+    status = __svcThreadSetDeadline(thread_id, period, deadline);
+  }
+  return status;
+}
+
+/// Complete the current job of the running thread and wait for its next period.
+osStatus_t osRtxThreadWaitPeriod (void) {
+  osStatus_t status;
+
+  if (IsException() || IsIrqMasked()) {
+    EvrRtxThreadError(NULL, (int32_t)osErrorISR);
+    status = osErrorISR;
+  } else {
+    status = __svcThreadWaitPeriod();
+  }
+  return status;
+}
+
+/// Assign an execution budget to a thread.
+osStatus_t osRtxThreadSetBudget (osThreadId_t thread_id, uint32_t budget, uint32_t period, osPriority_t priority) {
+  osStatus_t status;
+
+  if (IsException() || IsIrqMasked()) {
+    EvrRtxThreadError(thread_id, (int32_t)osErrorISR);
+    status = osErrorISR;
+  } else {
+    status = __svcThreadSetBudget(thread_id, budget, period, priority);
+  }
+  return status;
+}
+
+/// Wait for one of multiple Objects to become signaled.
+int32_t osRtxThreadWaitAny (const osRtxWaitObject_t *objects, uint32_t count, uint32_t timeout) {
+  int32_t status;
+
+  if (IsException() || IsIrqMasked()) {
+    EvrRtxThreadError(NULL, (int32_t)osErrorISR);
+    status = (int32_t)osErrorISR;
+  } else {
+    status = __svcThreadWaitAny(timeout, objects, count);
+  }
+  return status;
+}
+
 /// Change priority of a thread.
 osStatus_t osThreadSetPriority (osThreadId_t thread_id, osPriority_t priority) {
   osStatus_t status;
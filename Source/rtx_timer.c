@@ -33,9 +33,144 @@ __attribute__((section(".data.os.timer.obj"))) =
 { 0U, 0U, 0U };
 #endif
 
+// Timing Wheel Slots (First Timer of each Slot)
+#ifdef RTX_TIMING_WHEEL
+static os_timer_t *TimerSlot[osRtxWheelSlots] __attribute__((section(".bss.os")));
+#endif
+
+#ifdef RTX_TIMER_EXPIRED_LIST
+// Expired Timer List (Callback pending, in expiry order)
+static os_timer_t *TimerExpiredHead __attribute__((section(".bss.os")));
+static os_timer_t *TimerExpiredTail __attribute__((section(".bss.os")));
+
+// Expired Timer List end marker (link of a pending Timer is never NULL)
+//lint -e{9087} "cast between pointers to different object types"
+#define TimerExpiredEnd         ((os_timer_t *)(void *)&TimerExpiredHead)
+
+// Timer Thread Flag (reserved, signals expired Timers)
+#define TimerThreadFlag         0x40000000U
+
+static osStatus_t TimerExpiredGet (os_timer_finfo_t *finfo);
+#endif
+
+#ifdef RTX_HR_TIMER
+// Active High-Resolution Timers (sorted by deadline)
+static osRtxHrTimer_t *HrTimerList    __attribute__((section(".bss.os")));
+
+// OS Tick timer compare available for High-Resolution Timers
+static uint8_t         HrTimerCompare __attribute__((section(".bss.os")));
+
+// High-Resolution Timers are being processed
+static uint8_t         HrTimerBusy    __attribute__((section(".bss.os")));
+#endif
+
 
 //  ==== Helper functions ====
 
+#ifdef RTX_TIMING_WHEEL
+/// Insert Timer into the Timer Timing Wheel (at Slot Tail).
+/// \param[in]  timer           timer object.
+/// \param[in]  tick            timer tick.
+static void TimerInsert (os_timer_t *timer, uint32_t tick) {
+  os_timer_t *head;
+  uint32_t    slot;
+
+  timer->tick = osRtxTimerWheel.time + tick;
+  slot = osRtxWheelSlot(&osRtxTimerWheel, timer->tick);
+  head = TimerSlot[slot];
+  timer->next = NULL;
+  if (head == NULL) {
+    // Slot Head links back to Slot Tail
+    timer->prev = timer;
+    TimerSlot[slot] = timer;
+    osRtxWheelMapSet(&osRtxTimerWheel, slot);
+  } else {
+    timer->prev = head->prev;
+    head->prev->next = timer;
+    head->prev = timer;
+  }
+}
+
+/// Remove Timer from the Timer Timing Wheel.
+/// \param[in]  timer           timer object.
+static void TimerRemove (const os_timer_t *timer) {
+  os_timer_t *head;
+  uint32_t    slot;
+
+  slot = osRtxWheelSlot(&osRtxTimerWheel, timer->tick);
+  head = TimerSlot[slot];
+  if (timer == head) {
+    head = timer->next;
+    TimerSlot[slot] = head;
+    if (head != NULL) {
+      head->prev = timer->prev;
+    } else {
+      osRtxWheelMapClr(&osRtxTimerWheel, slot);
+    }
+  } else {
+    timer->prev->next = timer->next;
+    if (timer->next != NULL) {
+      timer->next->prev = timer->prev;
+    } else {
+      head->prev = timer->prev;
+    }
+  }
+}
+
+/// Process Timer Timing Wheel Slot: collect expired Timers and re-insert others.
+/// \param[in]  slot            slot index.
+/// \param[in]  tail            last expired Timer.
+/// \return last expired Timer.
+static os_timer_t *TimerWheelSlot (uint32_t slot, os_timer_t *tail) {
+  os_timer_t *timer, *timer_next;
+
+  timer = TimerSlot[slot];
+  if (timer != NULL) {
+    TimerSlot[slot] = NULL;
+    osRtxWheelMapClr(&osRtxTimerWheel, slot);
+    do {
+      timer_next = timer->next;
+      if (timer->tick == osRtxTimerWheel.time) {
+        // Append to expired Timers in Timer List
+        timer->tick = 0U;
+        timer->prev = tail;
+        timer->next = NULL;
+        if (tail != NULL) {
+          tail->next = timer;
+        } else {
+          osRtxInfo.timer.list = timer;
+        }
+        tail = timer;
+      } else {
+        // Cascade to lower Level
+        TimerInsert(timer, timer->tick - osRtxTimerWheel.time);
+      }
+      timer = timer_next;
+    } while (timer != NULL);
+  }
+
+  return tail;
+}
+
+/// Advance Timer Timing Wheel by one tick and move expired Timers to Timer List.
+static void TimerWheelTick (void) {
+  os_timer_t *tail;
+  uint32_t    time, level;
+
+  osRtxTimerWheel.time++;
+  time = osRtxTimerWheel.time;
+  tail = NULL;
+
+  if (time == 0U) {
+    tail = TimerWheelSlot(osRtxWheelOverflow, tail);
+  }
+  level = osRtxWheelLevelDue(time) + 1U;
+  do {
+    level--;
+    tail = TimerWheelSlot(osRtxWheelSlotAt(time, level), tail);
+  } while (level != 0U);
+}
+#else
 /// Insert Timer into the Timer List sorted by Time.
 /// \param[in]  timer           timer object.
 /// \param[in]  tick            timer tick.
@@ -77,6 +212,7 @@ static void TimerRemove (const os_timer_t *timer) {
     osRtxInfo.timer.list = timer->next;
   }
 }
+#endif
 
 /// Unlink Timer from the Timer List Head.
 /// \param[in]  timer           timer object.
@@ -88,22 +224,199 @@ static void TimerUnlink (const os_timer_t *timer) {
   osRtxInfo.timer.list = timer->next;
 }
 
+#ifdef RTX_TIMER_EXPIRED_LIST
+/// Put Timer into the Expired Timer List unless its Callback is already pending.
+/// \param[in]  timer           timer object.
+/// \return true - timer put, false - callback already pending.
+static bool_t TimerExpiredPut (os_timer_t *timer) {
+
+  if (timer->expired != NULL) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return FALSE;
+  }
+
+  timer->expired = TimerExpiredEnd;
+  if (TimerExpiredHead == NULL) {
+    TimerExpiredHead = timer;
+  } else {
+    TimerExpiredTail->expired = timer;
+  }
+  TimerExpiredTail = timer;
+
+  return TRUE;
+}
+
+/// Remove first Timer from the Expired Timer List.
+/// \return timer object or NULL when list is empty.
+static os_timer_t *TimerExpiredNext (void) {
+  os_timer_t *timer;
+
+  timer = TimerExpiredHead;
+  if (timer != NULL) {
+    TimerExpiredHead = (timer->expired != TimerExpiredEnd) ? timer->expired : NULL;
+    timer->expired   = NULL;
+  }
+
+  return timer;
+}
+
+/// Remove Timer from the Expired Timer List (discard pending Callback).
+/// \param[in]  timer           timer object.
+static void TimerExpiredRemove (os_timer_t *timer) {
+  os_timer_t *prev;
+  os_timer_t *next;
+
+  if (timer->expired == NULL) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return;
+  }
+
+  prev = NULL;
+  next = TimerExpiredHead;
+  while (next != timer) {
+    prev = next;
+    next = next->expired;
+  }
+  if (prev == NULL) {
+    TimerExpiredHead = (timer->expired != TimerExpiredEnd) ? timer->expired : NULL;
+  } else {
+    prev->expired = timer->expired;
+  }
+  if (TimerExpiredTail == timer) {
+    TimerExpiredTail = prev;
+  }
+  timer->expired = NULL;
+}
+#endif
+
+#ifdef RTX_HR_TIMER
+/// Insert High-Resolution Timer into the Active list (after timers with the same deadline).
+/// \param[in]  timer           high-resolution timer.
+static void HrTimerInsert (osRtxHrTimer_t *timer) {
+  osRtxHrTimer_t *prev, *next;
+
+  prev = NULL;
+  next = HrTimerList;
+  // Deadlines are compared as distance modulo 2^32
+  while ((next != NULL) && ((timer->deadline - next->deadline) <= 0x7FFFFFFFU)) {
+    prev = next;
+    next = next->next;
+  }
+  timer->prev = prev;
+  timer->next = next;
+  if (prev != NULL) {
+    prev->next = timer;
+  } else {
+    HrTimerList = timer;
+  }
+  if (next != NULL) {
+    next->prev = timer;
+  }
+}
+
+/// Remove High-Resolution Timer from the Active list.
+/// \param[in]  timer           high-resolution timer.
+static void HrTimerRemove (const osRtxHrTimer_t *timer) {
+
+  if (timer->next != NULL) {
+    timer->next->prev = timer->prev;
+  }
+  if (timer->prev != NULL) {
+    timer->prev->next = timer->next;
+  } else {
+    HrTimerList = timer->next;
+  }
+}
+
+/// Get time until High-Resolution Timer expires.
+/// \param[in]  timer           high-resolution timer.
+/// \return system timer counts until deadline or 0 when expired.
+static uint32_t HrTimerDelay (const osRtxHrTimer_t *timer) {
+  uint32_t delay;
+
+  delay = timer->deadline - osRtxKernelSysTimerCount();
+  if (delay > 0x7FFFFFFFU) {
+    delay = 0U;
+  }
+  return delay;
+}
+
+/// Program OS Tick timer compare for the first Active High-Resolution Timer.
+/// \note Timers due after the next tick period are handled by the Kernel Tick.
+/// \param[in]  delay           system timer counts until deadline (0 = expired).
+static void HrTimerCompareStart (uint32_t delay) {
+
+  if ((HrTimerCompare != 0U) && (delay <= osRtxKernelTickInterval)) {
+    OS_Tick_CompareStart((delay != 0U) ? delay : 1U);
+  }
+}
+
+/// Process expired High-Resolution Timers (handler mode).
+static void HrTimerProcess (void) {
+  osRtxHrTimer_t    *timer;
+  osRtxHrTimerFunc_t func;
+  void              *argument;
+  uint32_t           primask;
+  uint32_t           delay;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  // Processing is not re-entered from a compare interrupt or Kernel Tick of higher priority:
+  // the interrupted processing continues with newly expired timers in deadline order
+  if (HrTimerBusy == 0U) {
+    HrTimerBusy = 1U;
+    for (;;) {
+      timer = HrTimerList;
+      if (timer == NULL) {
+        break;
+      }
+      delay = HrTimerDelay(timer);
+      if (delay != 0U) {
+        HrTimerCompareStart(delay);
+        break;
+      }
+      HrTimerRemove(timer);
+      timer->active = 0U;
+      func     = timer->func;
+      argument = timer->argument;
+      // Call Timer Function with interrupts enabled (timer can be restarted)
+      if (primask == 0U) {
+        __enable_irq();
+      }
+      func(argument);
+      __disable_irq();
+    }
+    HrTimerBusy = 0U;
+  }
+
+  if (primask == 0U) {
+    __enable_irq();
+  }
+}
+
+/// High-Resolution Timer compare interrupt handler.
+static void HrTimerHandler (void) {
+  HrTimerProcess();
+}
+#endif
+
 /// Verify that Timer object pointer is valid.
 /// \param[in]  timer           timer object.
 /// \return true - valid, false - invalid.
 static bool_t IsTimerPtrValid (const os_timer_t *timer) {
 #ifdef RTX_OBJ_PTR_CHECK
   //lint --e{923} --e{9078} "cast from pointer to unsigned int" [MISRA Note 7]
-  uint32_t cb_start  = (uint32_t)&__os_timer_cb_start__;
-  uint32_t cb_length = (uint32_t)&__os_timer_cb_length__;
+  uintptr_t cb_start  = (uintptr_t)&__os_timer_cb_start__;
+  uintptr_t cb_length = (uintptr_t)&__os_timer_cb_length__;
 
   // Check the section boundaries
-  if (((uint32_t)timer - cb_start) >= cb_length) {
+  if (((uintptr_t)timer - cb_start) >= cb_length) {
     //lint -e{904} "Return statement before end of function" [MISRA Note 1]
     return FALSE;
   }
   // Check the object alignment
-  if ((((uint32_t)timer - cb_start) % sizeof(os_timer_t)) != 0U) {
+  if ((((uintptr_t)timer - cb_start) % sizeof(os_timer_t)) != 0U) {
     //lint -e{904} "Return statement before end of function" [MISRA Note 1]
     return FALSE;
   }
@@ -124,7 +437,15 @@ static bool_t IsTimerPtrValid (const os_timer_t *timer) {
 static void osRtxTimerTick (void) {
   os_thread_t *thread_running;
   os_timer_t  *timer;
+#ifdef RTX_TIMER_EXPIRED_LIST
+  bool_t       expired = FALSE;
+#else
   osStatus_t   status;
+#endif
+
+#ifdef RTX_TIMING_WHEEL
+  TimerWheelTick();
+#endif
 
   timer = osRtxInfo.timer.list;
   if (timer == NULL) {
@@ -134,19 +455,34 @@ static void osRtxTimerTick (void) {
 
   thread_running = osRtxThreadGetRunning();
 
+#ifndef RTX_TIMING_WHEEL
   timer->tick--;
+#endif
   while ((timer != NULL) && (timer->tick == 0U)) {
     TimerUnlink(timer);
-    status = osMessageQueuePut(osRtxInfo.timer.mq, &timer->finfo, 0U, 0U);
-    if (status != osOK) {
-      const os_thread_t *thread = osRtxThreadGetRunning();
-      osRtxThreadSetRunning(osRtxInfo.thread.run.next);
-      (void)osRtxKernelErrorNotify(osRtxErrorTimerQueueOverflow, timer);
-      if (osRtxThreadGetRunning() == NULL) {
-        if (thread_running == thread) {
-          thread_running = NULL;
+    if ((timer->attr & osRtxTimerInline) != 0U) {
+      // Execute Callback in Kernel Tick handler
+      EvrRtxTimerCallback(timer->finfo.func, timer->finfo.arg);
+      (timer->finfo.func)(timer->finfo.arg);
+    } else {
+#ifdef RTX_TIMER_EXPIRED_LIST
+      // Pass Timer to Timer Thread (expiry of a pending Timer is merged)
+      if (TimerExpiredPut(timer)) {
+        expired = TRUE;
+      }
+#else
+      status = osMessageQueuePut(osRtxInfo.timer.mq, &timer->finfo, 0U, 0U);
+      if (status != osOK) {
+        const os_thread_t *thread = osRtxThreadGetRunning();
+        osRtxThreadSetRunning(osRtxInfo.thread.run.next);
+        (void)osRtxKernelErrorNotify(osRtxErrorTimerQueueOverflow, timer);
+        if (osRtxThreadGetRunning() == NULL) {
+          if (thread_running == thread) {
+            thread_running = NULL;
+          }
         }
       }
+#endif
     }
     if ((timer->attr & osRtxTimerPeriodic) != 0U) {
       TimerInsert(timer, timer->load);
@@ -156,9 +492,77 @@ static void osRtxTimerTick (void) {
     timer = osRtxInfo.timer.list;
   }
 
+#ifdef RTX_TIMER_EXPIRED_LIST
+  // Wakeup Timer Thread
+  if (expired) {
+    (void)osThreadFlagsSet(osRtxInfo.timer.thread, TimerThreadFlag);
+  }
+#endif
+
   osRtxThreadSetRunning(thread_running);
 }
 
+#ifdef RTX_TIMER_RESUME_MERGE
+/// Skip periods of periodic Timers that expire more than once within the ticks to be processed.
+/// \note Such Timers expire only at their last period (missed periods are merged).
+/// \param[in]  ticks           number of ticks processed by osKernelResume.
+void osRtxTimerResume (uint32_t ticks) {
+  os_timer_t *timer, *timer_next;
+  os_timer_t *skip;
+  uint32_t    expiry;
+#ifdef RTX_TIMING_WHEEL
+  uint32_t    slot;
+#else
+  uint32_t    tick;
+#endif
+
+  skip = NULL;
+
+#ifdef RTX_TIMING_WHEEL
+  for (slot = 0U; slot < osRtxWheelSlots; slot++) {
+    timer = TimerSlot[slot];
+    while (timer != NULL) {
+      timer_next = timer->next;
+      expiry = timer->tick - osRtxTimerWheel.time;
+      if (((timer->attr & osRtxTimerPeriodic) != 0U) &&
+          (expiry < ticks) && ((ticks - expiry) >= timer->load)) {
+        TimerRemove(timer);
+        timer->tick = expiry + (((ticks - expiry) / timer->load) * timer->load);
+        timer->next = skip;
+        skip = timer;
+      }
+      timer = timer_next;
+    }
+  }
+#else
+  tick  = 0U;
+  timer = osRtxInfo.timer.list;
+  while (timer != NULL) {
+    timer_next = timer->next;
+    expiry = tick + timer->tick;
+    if (((timer->attr & osRtxTimerPeriodic) != 0U) &&
+        (expiry < ticks) && ((ticks - expiry) >= timer->load)) {
+      // Ticks of the removed Timer are added to the next Timer
+      TimerRemove(timer);
+      timer->tick = expiry + (((ticks - expiry) / timer->load) * timer->load);
+      timer->next = skip;
+      skip = timer;
+    } else {
+      tick = expiry;
+    }
+    timer = timer_next;
+  }
+#endif
+
+  // Insert Timers with the ticks until their last period
+  while (skip != NULL) {
+    timer = skip;
+    skip  = timer->next;
+    TimerInsert(timer, timer->tick);
+  }
+}
+#endif
+
 /// Setup Timer Thread objects.
 //lint -esym(714,osRtxTimerSetup) "Referenced from library configuration"
 //lint -esym(759,osRtxTimerSetup) "Prototype in header"
@@ -166,10 +570,16 @@ static void osRtxTimerTick (void) {
 int32_t osRtxTimerSetup (void) {
   int32_t ret = -1;
 
+#ifdef RTX_TIMER_EXPIRED_LIST
+  // Expired Timers are passed in a list (no Timer Message Queue)
+  osRtxInfo.timer.tick = osRtxTimerTick;
+  ret = 0;
+#else
   if (osRtxMessageQueueTimerSetup() == 0) {
     osRtxInfo.timer.tick = osRtxTimerTick;
     ret = 0;
   }
+#endif
 
   return ret;
 }
@@ -179,6 +589,22 @@ int32_t osRtxTimerSetup (void) {
 //lint -esym(759,osRtxTimerThread) "Prototype in header"
 //lint -esym(765,osRtxTimerThread) "Global scope"
 __NO_RETURN void osRtxTimerThread (void *argument) {
+#ifdef RTX_TIMER_EXPIRED_LIST
+  os_timer_finfo_t   finfo;
+
+  (void)argument;
+
+  for (;;) {
+    // Execute Callbacks of expired Timers
+    //lint -e{934} "Taking address of near auto variable"
+    while (TimerExpiredGet(&finfo) == osOK) {
+      EvrRtxTimerCallback(finfo.func, finfo.arg);
+      (finfo.func)(finfo.arg);
+    }
+    // Wait for expired Timers
+    (void)osThreadFlagsWait(TimerThreadFlag, osFlagsWaitAny, osWaitForever);
+  }
+#else
   os_timer_finfo_t   finfo;
   osStatus_t         status;
   osMessageQueueId_t mq = (osMessageQueueId_t)argument;
@@ -191,12 +617,18 @@ __NO_RETURN void osRtxTimerThread (void *argument) {
       (finfo.func)(finfo.arg);
     }
   }
+#endif
 }
 
 /// Destroy a Timer object.
 /// \param[in]  timer           timer object.
 static void osRtxTimerDestroy (os_timer_t *timer) {
 
+#ifdef RTX_TIMER_EXPIRED_LIST
+  // Discard pending Callback
+  TimerExpiredRemove(timer);
+#endif
+
   // Mark object as inactive and invalid
   timer->state = osRtxTimerInactive;
   timer->id    = osRtxIdInvalid;
@@ -220,6 +652,51 @@ static void osRtxTimerDestroy (os_timer_t *timer) {
   EvrRtxTimerDestroyed(timer);
 }
 
+#ifdef RTX_HR_TIMER
+/// Setup OS Tick timer compare for High-Resolution Timers.
+void osRtxHrTimerSetup (void) {
+  if (OS_Tick_CompareSetup(HrTimerHandler) == 0) {
+    HrTimerCompare = 1U;
+  }
+}
+
+/// High-Resolution Timer Tick (called each SysTick).
+void osRtxHrTimerTick (void) {
+  HrTimerProcess();
+}
+
+/// Get number of ticks until the tick period of the first High-Resolution Timer.
+/// \return number of ticks or osWaitForever when no timer is active.
+uint32_t osRtxHrTimerNext (void) {
+  const osRtxHrTimer_t *timer;
+  uint32_t              interval;
+  uint32_t              primask;
+  uint32_t              delay;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  timer = HrTimerList;
+  if (timer == NULL) {
+    delay = osWaitForever;
+  } else {
+    interval = osRtxKernelTickInterval;
+    delay    = timer->deadline - ((uint32_t)osRtxInfo.kernel.tick * interval);
+    if (delay > 0x7FFFFFFFU) {
+      delay = 0U;
+    } else {
+      delay /= interval;
+    }
+  }
+
+  if (primask == 0U) {
+    __enable_irq();
+  }
+
+  return delay;
+}
+#endif
+
 #ifdef RTX_SAFETY_CLASS
 /// Delete a Timer safety class.
 /// \param[in]  safety_class    safety class.
@@ -229,8 +706,8 @@ void osRtxTimerDeleteClass (uint32_t safety_class, uint32_t mode) {
   uint32_t    length;
 
   //lint --e{923} --e{9078} "cast from pointer to unsigned int" [MISRA Note 7]
-  timer = (os_timer_t *)(uint32_t)&__os_timer_cb_start__;
-  length    =           (uint32_t)&__os_timer_cb_length__;
+  timer = (os_timer_t *)(uintptr_t)&__os_timer_cb_start__;
+  length    =           (uint32_t)(uintptr_t)&__os_timer_cb_length__;
   while (length >= sizeof(os_timer_t)) {
     if (   (timer->id == osRtxIdTimer) &&
         ((((mode & osSafetyWithSameClass)  != 0U) &&
@@ -305,9 +782,7 @@ static osTimerId_t svcRtxTimerNew (osTimerFunc_t func, osTimerType_t type, void
     }
   } else {
     name      = NULL;
-#ifdef RTX_SAFETY_CLASS
     attr_bits = 0U;
-#endif
     timer     = NULL;
   }
 
@@ -347,6 +822,9 @@ static osTimerId_t svcRtxTimerNew (osTimerFunc_t func, osTimerType_t type, void
     } else {
       timer->attr     = 0U;
     }
+    if ((attr_bits & osRtxTimerCallbackInline) != 0U) {
+      timer->attr    |= osRtxTimerInline;
+    }
     timer->name       = name;
     timer->prev       = NULL;
     timer->next       = NULL;
@@ -354,6 +832,7 @@ static osTimerId_t svcRtxTimerNew (osTimerFunc_t func, osTimerType_t type, void
     timer->load       = 0U;
     timer->finfo.func = func;
     timer->finfo.arg  = argument;
+    timer->expired    = NULL;
 #ifdef RTX_SAFETY_CLASS
     if ((attr_bits & osSafetyClass_Valid) != 0U) {
       timer->attr    |= (uint8_t)((attr_bits & osSafetyClass_Msk) >>
@@ -538,6 +1017,105 @@ static osStatus_t svcRtxTimerDelete (osTimerId_t timer_id) {
   return osOK;
 }
 
+#ifdef RTX_TIMER_EXPIRED_LIST
+/// Get Callback of the first expired Timer.
+/// \param[out] finfo           callback function information.
+/// \return status code that indicates the execution status of the function.
+static osStatus_t svcRtxTimerExpiredGet (os_timer_finfo_t *finfo) {
+  const os_timer_t *timer;
+
+  timer = TimerExpiredNext();
+  if (timer == NULL) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return osErrorResource;
+  }
+
+  *finfo = timer->finfo;
+
+  return osOK;
+}
+#endif
+
+/// Start or restart a High-Resolution Timer.
+/// \note API identical to osRtxHrTimerStart
+static osStatus_t svcRtxHrTimerStart (osRtxHrTimer_t *timer, uint32_t deadline) {
+#ifdef RTX_HR_TIMER
+  uint32_t primask;
+
+  // Check parameters
+  if ((timer == NULL) || (timer->func == NULL)) {
+    EvrRtxKernelError((int32_t)osErrorParameter);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return osErrorParameter;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  if (timer->active != 0U) {
+    HrTimerRemove(timer);
+  }
+  timer->deadline = deadline;
+  timer->active   = 1U;
+  HrTimerInsert(timer);
+
+  if (HrTimerList == timer) {
+    HrTimerCompareStart(HrTimerDelay(timer));
+    if (osRtxInfo.kernel.state == osRtxKernelSuspended) {
+      // Skip tickless sleep (sleep time is determined already)
+      osRtxInfo.kernel.pendSV = 1U;
+    }
+  }
+
+  if (primask == 0U) {
+    __enable_irq();
+  }
+
+  return osOK;
+#else
+  (void)timer;
+  (void)deadline;
+  return osError;
+#endif
+}
+
+/// Stop a High-Resolution Timer.
+/// \note API identical to osRtxHrTimerStop
+static osStatus_t svcRtxHrTimerStop (osRtxHrTimer_t *timer) {
+#ifdef RTX_HR_TIMER
+  osStatus_t status;
+  uint32_t   primask;
+
+  // Check parameters
+  if (timer == NULL) {
+    EvrRtxKernelError((int32_t)osErrorParameter);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return osErrorParameter;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  if (timer->active != 0U) {
+    // A programmed compare of the removed timer expires without effect
+    HrTimerRemove(timer);
+    timer->active = 0U;
+    status = osOK;
+  } else {
+    status = osErrorResource;
+  }
+
+  if (primask == 0U) {
+    __enable_irq();
+  }
+
+  return status;
+#else
+  (void)timer;
+  return osError;
+#endif
+}
+
 //  Service Calls definitions
 //lint ++flb "Library Begin" [MISRA Note 11]
 SVC0_4(TimerNew,       osTimerId_t,  osTimerFunc_t, osTimerType_t, void *, const osTimerAttr_t *)
@@ -546,9 +1124,24 @@ SVC0_2(TimerStart,     osStatus_t,   osTimerId_t, uint32_t)
 SVC0_1(TimerStop,      osStatus_t,   osTimerId_t)
 SVC0_1(TimerIsRunning, uint32_t,     osTimerId_t)
 SVC0_1(TimerDelete,    osStatus_t,   osTimerId_t)
+SVC0_2(HrTimerStart,   osStatus_t,   osRtxHrTimer_t *, uint32_t)
+SVC0_1(HrTimerStop,    osStatus_t,   osRtxHrTimer_t *)
+#ifdef RTX_TIMER_EXPIRED_LIST
+SVC0_1(TimerExpiredGet, osStatus_t,  os_timer_finfo_t *)
+#endif
 //lint --flb "Library End"
 
 
+#ifdef RTX_TIMER_EXPIRED_LIST
+/// Get Callback of the first expired Timer (Timer Thread).
+/// \param[out] finfo           callback function information.
+/// \return status code that indicates the execution status of the function.
+static osStatus_t TimerExpiredGet (os_timer_finfo_t *finfo) {
+  return __svcTimerExpiredGet(finfo);
+}
+#endif
+
+
 //  ==== Public API ====
 
 /// Create and Initialize a timer.
@@ -631,3 +1224,27 @@ osStatus_t osTimerDelete (osTimerId_t timer_id) {
   }
   return status;
 }
+
+/// Start or restart a High-Resolution Timer.
+osStatus_t osRtxHrTimerStart (osRtxHrTimer_t *timer, uint32_t deadline) {
+  osStatus_t status;
+
+  if (IsException() || IsIrqMasked()) {
+    status = svcRtxHrTimerStart(timer, deadline);
+  } else {
+    status = __svcHrTimerStart(timer, deadline);
+  }
+  return status;
+}
+
+/// Stop a High-Resolution Timer.
+osStatus_t osRtxHrTimerStop (osRtxHrTimer_t *timer) {
+  osStatus_t status;
+
+  if (IsException() || IsIrqMasked()) {
+    status = svcRtxHrTimerStop(timer);
+  } else {
+    status = __svcHrTimerStop(timer);
+  }
+  return status;
+}
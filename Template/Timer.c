@@ -47,5 +47,5 @@ int Init_Timers (void) {
       return -1;
     }
   }
-  return NULL;
+  return 0;
 }
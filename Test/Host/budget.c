@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-RTOS RTX
+ * Title:       POSIX Host test of thread execution budgets (OS_THREAD_BUDGET)
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "cmsis_os2.h"
+#include "rtx_os.h"
+
+#define BUDGET          3U              // Budget per period [ticks]
+#define PERIOD          10U             // Replenishment period [ticks]
+#define PERIODS         10U             // Measured periods
+
+static osThreadId_t Busy;
+static osThreadId_t Background;
+
+// Kernel Ticks at which the busy and the background thread were running
+static volatile uint32_t BusyTicks;
+static volatile uint32_t BackgroundTicks;
+
+static uint32_t Failed;
+
+static void Check (int ok, const char *what) {
+  printf("%-36s %s\n", what, ok ? "ok" : "FAILED");
+  if (!ok) {
+    Failed++;
+  }
+}
+
+/// Busy and background threads: run until terminated
+static void Spin (void *argument) {
+  volatile uint32_t count = 0U;
+  (void)argument;
+
+  for (;;) {
+    count++;
+  }
+}
+
+/// Inline timer callback: samples the running thread in every Kernel Tick
+static void Sample (void *argument) {
+  osThreadId_t thread = osThreadGetId();
+  (void)argument;
+
+  if (thread == Busy) {
+    BusyTicks++;
+  } else if (thread == Background) {
+    BackgroundTicks++;
+  } else {
+    // Main thread
+  }
+}
+
+static const osTimerAttr_t SampleAttr = {
+  .attr_bits = osRtxTimerCallbackInline
+};
+
+/// Run the busy thread with a budget and check its share of the Kernel Ticks
+/// \param[in]  priority        priority while the budget is exhausted (osPriorityNone: suspend).
+/// \param[in]  mode            name of the mode.
+static void Run (osPriority_t priority, const char *mode) {
+  static const osThreadAttr_t busy_attr       = { .priority = osPriorityHigh   };
+  static const osThreadAttr_t background_attr = { .priority = osPriorityNormal };
+  osTimerId_t timer;
+  uint32_t    blocked = 0U;
+  uint32_t    demoted = 0U;
+  uint32_t    limited = 0U;
+  uint32_t    i;
+  char        what[40];
+
+  printf("%s\n", mode);
+
+  BusyTicks       = 0U;
+  BackgroundTicks = 0U;
+  Background      = osThreadNew(Spin, NULL, &background_attr);
+  Busy            = osThreadNew(Spin, NULL, &busy_attr);
+  timer           = osTimerNew(Sample, osTimerPeriodic, NULL, &SampleAttr);
+  Check((Background != NULL) && (Busy != NULL) && (timer != NULL), "object creation");
+
+  // Without budget the busy thread starves the background thread
+  (void)osTimerStart(timer, 1U);
+  osDelay(PERIOD);
+  Check((BusyTicks >= (PERIOD - 1U)) && (BackgroundTicks == 0U), "busy thread without budget");
+
+  // Budget and sampling start in the same tick
+  osDelay(1U);
+  (void)osTimerStop(timer);
+  BusyTicks       = 0U;
+  BackgroundTicks = 0U;
+  Check(osRtxThreadSetBudget(Busy, BUDGET, PERIOD, priority) == osOK, "budget assignment");
+  (void)osTimerStart(timer, 1U);
+
+  // Sample the busy thread state in every tick
+  for (i = 0U; i < (PERIOD * PERIODS); i++) {
+    osDelay(1U);
+    if (osThreadGetState(Busy) == osThreadBlocked) {
+      blocked++;
+    }
+    if (osThreadGetPriority(Busy) == osPriorityLow) {
+      demoted++;
+    }
+    if (osThreadGetPriority(Busy) != osPriorityHigh) {
+      limited++;
+    }
+  }
+  (void)osTimerStop(timer);
+
+  printf("busy %u ticks, background %u ticks\n", BusyTicks, BackgroundTicks);
+  (void)snprintf(what, sizeof(what), "busy thread held to %u/%u", BUDGET, PERIOD);
+  Check((BusyTicks >= ((BUDGET * PERIODS) - 1U)) && (BusyTicks <= ((BUDGET * PERIODS) + 1U)), what);
+  Check(BackgroundTicks >= (((PERIOD - BUDGET) * PERIODS) - 2U), "background thread runs");
+  if (priority == osPriorityNone) {
+    Check((blocked != 0U) && (limited == 0U), "suspended when exhausted");
+  } else {
+    Check((blocked == 0U) && (demoted != 0U), "demoted when exhausted");
+  }
+
+  // Removing the budget restores the thread
+  Check(osRtxThreadSetBudget(Busy, 0U, PERIOD, osPriorityNone) == osOK, "budget removal");
+  Check((osThreadGetState(Busy) == osThreadReady) && (osThreadGetPriority(Busy) == osPriorityHigh),
+        "thread restored");
+
+  (void)osTimerDelete(timer);
+  (void)osThreadTerminate(Busy);
+  (void)osThreadTerminate(Background);
+}
+
+static void Main (void *argument) {
+  (void)argument;
+
+  Check(osRtxThreadSetBudget(osThreadGetId(), 5U, 4U, osPriorityNone) == osErrorParameter,
+        "budget exceeding period");
+
+  Run(osPriorityNone, "suspend mode");
+  Run(osPriorityLow,  "demote mode");
+
+  printf("%s\n", (Failed == 0U) ? "PASS" : "FAIL");
+  exit((Failed == 0U) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+int main (void) {
+  static const osThreadAttr_t main_attr = { .priority = osPriorityRealtime };
+
+  (void)osKernelInitialize();
+  (void)osThreadNew(Main, NULL, &main_attr);
+  (void)osKernelStart();
+
+  return EXIT_FAILURE;
+}
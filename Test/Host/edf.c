@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-RTOS RTX
+ * Title:       POSIX Host test of deadline scheduling (OS_THREAD_EDF)
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "cmsis_os2.h"
+#include "rtx_os.h"
+
+#define JOB_COUNT       3U              // Deadline threads
+#define JOB_PERIOD      20U             // Period of the deadline threads [ticks]
+#define PERIODS         3U              // Logged periods
+#define LOG_SIZE        16U             // Event log entries
+
+// Relative deadlines: the second thread is due first
+static const uint32_t JobDeadline[JOB_COUNT] = { 15U, 5U, 10U };
+
+static osThreadId_t JobThread[JOB_COUNT];
+static osThreadId_t MissThread;
+
+// Event log: jobs of the deadline threads (1..JOB_COUNT) and the plain thread (9)
+static uint8_t  EventLog[LOG_SIZE];
+static uint32_t EventCount;
+
+// Deadline miss notifications
+static volatile uint32_t MissCount;
+static volatile uint32_t MissOther;
+static void * volatile   MissObject;
+
+static uint32_t Failed;
+
+static void Check (int ok, const char *what) {
+  printf("%-36s %s\n", what, ok ? "ok" : "FAILED");
+  if (!ok) {
+    Failed++;
+  }
+}
+
+static void LogEvent (uint8_t event) {
+  if (EventCount < LOG_SIZE) {
+    EventLog[EventCount] = event;
+  }
+  EventCount++;
+}
+
+/// OS Error Callback: records deadline misses (replaces the RTX_Config.c default)
+uint32_t osRtxErrorNotify (uint32_t code, void *object_id) {
+
+  if (code == osRtxErrorDeadlineMiss) {
+    MissCount++;
+    MissObject = object_id;
+  } else {
+    MissOther++;
+  }
+  return 0U;
+}
+
+/// Deadline thread: logs one event per job
+static void Job (void *argument) {
+  uint32_t i = (uint32_t)(uintptr_t)argument;
+
+  for (;;) {
+    LogEvent((uint8_t)(i + 1U));
+    (void)osRtxThreadWaitPeriod();
+  }
+}
+
+/// Thread at the deadline priority level without a deadline
+static void Plain (void *argument) {
+  (void)argument;
+
+  LogEvent(9U);
+}
+
+/// Deadline thread whose first job runs past its deadline
+static void Miss (void *argument) {
+  uint32_t tick = osKernelGetTickCount();
+  (void)argument;
+
+  while ((osKernelGetTickCount() - tick) < 10U) {
+    // Busy job of 10 ticks with a deadline of 5 ticks
+  }
+  for (;;) {
+    (void)osRtxThreadWaitPeriod();
+  }
+}
+
+static void Main (void *argument) {
+  static const uint8_t expected[] = { 2U, 3U, 1U, 9U, 2U, 3U, 1U, 2U, 3U, 1U };
+  static const osThreadAttr_t plain_attr = { .priority = (osPriority_t)OS_THREAD_EDF_PRIO };
+  uint32_t i;
+  (void)argument;
+
+  Check(osRtxThreadSetDeadline(osThreadGetId(), 10U, 20U) == osErrorParameter, "deadline exceeding period");
+
+  // Jobs are released in the same tick, below the main thread
+  osDelay(1U);
+  (void)osThreadNew(Plain, NULL, &plain_attr);
+  for (i = 0U; i < JOB_COUNT; i++) {
+    JobThread[i] = osThreadNew(Job, (void *)(uintptr_t)i, NULL);
+    Check((JobThread[i] != NULL) &&
+          (osRtxThreadSetDeadline(JobThread[i], JOB_PERIOD, JobDeadline[i]) == osOK), "deadline assignment");
+  }
+  Check(osThreadGetPriority(JobThread[0]) == (osPriority_t)OS_THREAD_EDF_PRIO, "deadline priority level");
+
+  // Jobs run in the order of their absolute deadlines, before the plain thread
+  osDelay((JOB_PERIOD * PERIODS) - (JOB_PERIOD / 2U));
+  for (i = 0U; i < JOB_COUNT; i++) {
+    (void)osThreadTerminate(JobThread[i]);
+  }
+  Check((EventCount == sizeof(expected)) && (memcmp(EventLog, expected, sizeof(expected)) == 0),
+        "earliest deadline first");
+  Check(MissCount == 0U, "no deadline missed");
+
+  // Deadline miss is reported once for the late job
+  MissThread = osThreadNew(Miss, NULL, NULL);
+  Check((MissThread != NULL) && (osRtxThreadSetDeadline(MissThread, 50U, 5U) == osOK), "deadline assignment");
+  osDelay(20U);
+  Check((MissCount == 1U) && (MissObject == MissThread) && (MissOther == 0U), "deadline miss notification");
+  (void)osThreadTerminate(MissThread);
+
+  printf("%s\n", (Failed == 0U) ? "PASS" : "FAIL");
+  exit((Failed == 0U) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+int main (void) {
+  static const osThreadAttr_t main_attr = { .priority = osPriorityRealtime };
+
+  (void)osKernelInitialize();
+  (void)osThreadNew(Main, NULL, &main_attr);
+  (void)osKernelStart();
+
+  return EXIT_FAILURE;
+}
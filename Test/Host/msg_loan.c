@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-RTOS RTX
+ * Title:       POSIX Host test of the message queue zero-copy functions
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "cmsis_os2.h"
+#include "rtx_os.h"
+
+typedef struct {
+  uint32_t seq;
+  uint32_t data[7];
+} msg_t;
+
+static osMessageQueueId_t MsgQueue;
+
+// Slots handed between the main and the helper thread
+static msg_t * volatile HelperLoan;
+static msg_t * volatile HelperCommit;
+static msg_t * volatile IsrCommit;
+
+static uint32_t Failed;
+
+static void Check (int ok, const char *what) {
+  printf("%-36s %s\n", what, ok ? "ok" : "FAILED");
+  if (!ok) {
+    Failed++;
+  }
+}
+
+/// Helper thread: frees a slot of the full queue and commits to the empty queue
+static void Helper (void *argument) {
+  msg_t *msg;
+  (void)argument;
+
+  // Queue is full: release the slot loaned by the main thread
+  osDelay(5U);
+  (void)osRtxMessageQueueRelease(MsgQueue, HelperLoan);
+
+  // Queue is full with messages: receive and release one
+  osDelay(5U);
+  msg = osRtxMessageQueueReceive(MsgQueue, NULL, 0U);
+  (void)osRtxMessageQueueRelease(MsgQueue, msg);
+
+  // Queue is empty: commit a message to the blocked receiver (after its timeout)
+  osDelay(20U);
+  msg = osRtxMessageQueueLoan(MsgQueue, 0U);
+  if (msg != NULL) {
+    msg->seq     = 100U;
+    HelperCommit = msg;
+    (void)osRtxMessageQueueCommit(MsgQueue, msg, 0U);
+  }
+}
+
+/// Inline timer callback: loans and commits a message from the Kernel Tick (ISR)
+static void Isr (void *argument) {
+  msg_t *msg;
+  (void)argument;
+
+  msg = osRtxMessageQueueLoan(MsgQueue, 0U);
+  if (msg != NULL) {
+    msg->seq  = 200U;
+    IsrCommit = msg;
+    (void)osRtxMessageQueueCommit(MsgQueue, msg, 0U);
+  }
+}
+
+static const osTimerAttr_t IsrAttr = {
+  .attr_bits = osRtxTimerCallbackInline
+};
+
+static void Main (void *argument) {
+  osThreadId_t helper;
+  osTimerId_t  timer;
+  msg_t       *loan[2];
+  msg_t       *msg;
+  msg_t        copy;
+  msg_t        local;
+  uint8_t      prio;
+  uint32_t     tick;
+  uint32_t     i;
+  (void)argument;
+
+  MsgQueue = osMessageQueueNew(2U, sizeof(msg_t), NULL);
+  timer    = osTimerNew(Isr, osTimerOnce, NULL, &IsrAttr);
+  Check((MsgQueue != NULL) && (timer != NULL), "object creation");
+
+  // Loan, fill in place, commit, receive the same slot and release it
+  loan[0] = osRtxMessageQueueLoan(MsgQueue, 0U);
+  Check(loan[0] != NULL, "loan");
+  loan[0]->seq = 1U;
+  for (i = 0U; i < 7U; i++) {
+    loan[0]->data[i] = i;
+  }
+  Check(osMessageQueueGetSpace(MsgQueue) == 1U, "loaned slot occupies space");
+  Check(osRtxMessageQueueCommit(MsgQueue, loan[0], 3U) == osOK, "commit");
+  Check(osMessageQueueGetCount(MsgQueue) == 1U, "committed message counted");
+  prio = 0U;
+  msg  = osRtxMessageQueueReceive(MsgQueue, &prio, 0U);
+  Check((msg == loan[0]) && (msg->seq == 1U) && (msg->data[6] == 6U) && (prio == 3U), "receive without copy");
+  Check((osMessageQueueGetCount(MsgQueue) == 0U) && (osMessageQueueGetSpace(MsgQueue) == 1U),
+        "received slot occupies space");
+  Check(osRtxMessageQueueRelease(MsgQueue, msg) == osOK, "release");
+  Check(osMessageQueueGetSpace(MsgQueue) == 2U, "released slot is free");
+
+  // Priority order and interoperation with osMessageQueueGet
+  loan[0] = osRtxMessageQueueLoan(MsgQueue, 0U);
+  loan[1] = osRtxMessageQueueLoan(MsgQueue, 0U);
+  loan[0]->seq = 2U;
+  loan[1]->seq = 3U;
+  (void)osRtxMessageQueueCommit(MsgQueue, loan[0], 1U);
+  (void)osRtxMessageQueueCommit(MsgQueue, loan[1], 5U);
+  msg = osRtxMessageQueueReceive(MsgQueue, &prio, 0U);
+  Check((msg == loan[1]) && (prio == 5U), "receive highest priority");
+  (void)osRtxMessageQueueRelease(MsgQueue, msg);
+  Check((osMessageQueueGet(MsgQueue, &copy, &prio, 0U) == osOK) && (copy.seq == 2U) && (prio == 1U),
+        "get copy of committed message");
+
+  // Invalid slots
+  Check((osRtxMessageQueueCommit(MsgQueue, &local, 0U) == osErrorParameter) &&
+        (osRtxMessageQueueRelease(MsgQueue, &local) == osErrorParameter), "invalid slot rejected");
+
+  // Queue full with loaned slots: loan blocks until timeout
+  loan[0] = osRtxMessageQueueLoan(MsgQueue, 0U);
+  loan[1] = osRtxMessageQueueLoan(MsgQueue, 0U);
+  Check((loan[0] != NULL) && (loan[1] != NULL) && (osRtxMessageQueueLoan(MsgQueue, 0U) == NULL), "queue full");
+  tick = osKernelGetTickCount();
+  msg  = osRtxMessageQueueLoan(MsgQueue, 5U);
+  Check((msg == NULL) && ((osKernelGetTickCount() - tick) >= 5U), "loan timeout");
+
+  // Blocked loan resumed with the slot released by another thread
+  HelperLoan = loan[1];
+  helper = osThreadNew(Helper, NULL, NULL);
+  Check(helper != NULL, "thread creation");
+  msg = osRtxMessageQueueLoan(MsgQueue, 100U);
+  Check(msg == loan[1], "blocked loan resumed by release");
+
+  // Blocked loan resumed when another thread receives and releases a message
+  loan[0]->seq = 4U;
+  msg->seq     = 5U;
+  (void)osRtxMessageQueueCommit(MsgQueue, loan[0], 0U);
+  (void)osRtxMessageQueueCommit(MsgQueue, msg, 0U);
+  msg = osRtxMessageQueueLoan(MsgQueue, 100U);
+  Check(msg == loan[0], "blocked loan resumed by receiver");
+  (void)osRtxMessageQueueRelease(MsgQueue, msg);
+  Check((osMessageQueueGet(MsgQueue, &copy, NULL, 0U) == osOK) && (copy.seq == 5U), "remaining message");
+
+  // Queue empty: receive blocks until timeout
+  tick = osKernelGetTickCount();
+  msg  = osRtxMessageQueueReceive(MsgQueue, NULL, 5U);
+  Check((msg == NULL) && ((osKernelGetTickCount() - tick) >= 5U), "receive timeout");
+
+  // Blocked receive resumed with the slot committed by another thread
+  msg = osRtxMessageQueueReceive(MsgQueue, NULL, 100U);
+  Check((msg != NULL) && (msg == HelperCommit) && (msg->seq == 100U), "blocked receive resumed by commit");
+  (void)osRtxMessageQueueRelease(MsgQueue, msg);
+
+  // Blocked receive resumed with the slot committed from an ISR
+  (void)osTimerStart(timer, 2U);
+  msg = osRtxMessageQueueReceive(MsgQueue, NULL, 100U);
+  Check((msg != NULL) && (msg == IsrCommit) && (msg->seq == 200U), "blocked receive resumed from ISR");
+  (void)osRtxMessageQueueRelease(MsgQueue, msg);
+  Check((osMessageQueueGetCount(MsgQueue) == 0U) && (osMessageQueueGetSpace(MsgQueue) == 2U), "all slots free");
+
+  (void)osTimerDelete(timer);
+
+  printf("%s\n", (Failed == 0U) ? "PASS" : "FAIL");
+  exit((Failed == 0U) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+int main (void) {
+
+  (void)osKernelInitialize();
+  (void)osThreadNew(Main, NULL, NULL);
+  (void)osKernelStart();
+
+  return EXIT_FAILURE;
+}
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-RTOS RTX
+ * Title:       POSIX Host test of the mutex priority ceiling protocol
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "cmsis_os2.h"
+#include "rtx_os.h"
+
+static const osMutexAttr_t HighAttr = {
+  .attr_bits = osRtxMutexPrioCeiling(osPriorityHigh)
+};
+
+static const osMutexAttr_t RealtimeAttr = {
+  .attr_bits = osRtxMutexPrioCeiling(osPriorityRealtime)
+};
+
+static osMutexId_t MutexHigh;
+static osMutexId_t MutexRealtime;
+
+static volatile uint32_t SharerRun;
+static volatile osStatus_t RealtimeStatus;
+
+static uint32_t Failed;
+
+static void Check (int ok, const char *what) {
+  printf("%-36s %s\n", what, ok ? "ok" : "FAILED");
+  if (!ok) {
+    Failed++;
+  }
+}
+
+/// Thread above the main thread that shares the resource
+static void Sharer (void *argument) {
+  (void)argument;
+  SharerRun = 1U;
+}
+
+/// Thread above the ceiling of the mutex
+static void Realtime (void *argument) {
+  (void)argument;
+  RealtimeStatus = osMutexAcquire(MutexHigh, 0U);
+}
+
+static void Main (void *argument) {
+  static const osThreadAttr_t sharer_attr   = { .priority = osPriorityAboveNormal };
+  static const osThreadAttr_t realtime_attr = { .priority = osPriorityRealtime    };
+  osThreadId_t self = osThreadGetId();
+  (void)argument;
+
+  MutexHigh     = osMutexNew(&HighAttr);
+  MutexRealtime = osMutexNew(&RealtimeAttr);
+  Check((MutexHigh != NULL) && (MutexRealtime != NULL), "mutex creation");
+
+  // Owner boost to the ceiling: a sharing thread cannot preempt the owner
+  Check(osMutexAcquire(MutexHigh, 0U) == osOK, "acquire");
+  Check(osThreadGetPriority(self) == osPriorityHigh, "owner raised to ceiling");
+  (void)osThreadNew(Sharer, NULL, &sharer_attr);
+  Check(SharerRun == 0U, "owner not preempted");
+
+  // Restore on release
+  Check(osMutexRelease(MutexHigh) == osOK, "release");
+  Check(osThreadGetPriority(self) == osPriorityNormal, "base priority restored");
+  Check(SharerRun == 1U, "sharer runs after release");
+
+  // Nested ceiling mutexes released in any order
+  (void)osMutexAcquire(MutexHigh, 0U);
+  (void)osMutexAcquire(MutexRealtime, 0U);
+  Check(osThreadGetPriority(self) == osPriorityRealtime, "nested ceiling");
+  (void)osMutexRelease(MutexHigh);
+  Check(osThreadGetPriority(self) == osPriorityRealtime, "remaining ceiling kept");
+  (void)osMutexRelease(MutexRealtime);
+  Check(osThreadGetPriority(self) == osPriorityNormal, "nested release restored");
+
+  // osThreadSetPriority while boosted changes the base priority only
+  (void)osMutexAcquire(MutexHigh, 0U);
+  Check(osThreadSetPriority(self, osPriorityLow) == osOK, "set priority while boosted");
+  Check(osThreadGetPriority(self) == osPriorityHigh, "ceiling kept");
+  (void)osMutexRelease(MutexHigh);
+  Check(osThreadGetPriority(self) == osPriorityLow, "new base priority after release");
+  (void)osThreadSetPriority(self, osPriorityNormal);
+
+  (void)osMutexAcquire(MutexHigh, 0U);
+  (void)osThreadSetPriority(self, osPriorityRealtime);
+  Check(osThreadGetPriority(self) == osPriorityRealtime, "base priority above ceiling");
+  (void)osThreadSetPriority(self, osPriorityNormal);
+  Check(osThreadGetPriority(self) == osPriorityHigh, "back to ceiling");
+  (void)osMutexRelease(MutexHigh);
+  Check(osThreadGetPriority(self) == osPriorityNormal, "base priority restored");
+
+  // Thread above the ceiling is rejected
+  RealtimeStatus = osOK;
+  (void)osThreadNew(Realtime, NULL, &realtime_attr);
+  Check(RealtimeStatus == osErrorParameter, "thread above ceiling rejected");
+  Check(osMutexGetOwner(MutexHigh) == NULL, "mutex not owned");
+
+  printf("%s\n", (Failed == 0U) ? "PASS" : "FAIL");
+  exit((Failed == 0U) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+int main (void) {
+
+  (void)osKernelInitialize();
+  (void)osThreadNew(Main, NULL, NULL);
+  (void)osKernelStart();
+
+  return EXIT_FAILURE;
+}
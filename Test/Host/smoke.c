@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-RTOS RTX
+ * Title:       POSIX Host smoke test
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "cmsis_os2.h"
+
+// Each step exercises a kernel path that passes a value or a pointer to a
+// waiting thread through its R0..R3 register frame.
+
+static osThreadId_t       MainThread;
+static osSemaphoreId_t    Semaphore;
+static osMutexId_t        Mutex;
+static osEventFlagsId_t   EventFlags;
+static osMessageQueueId_t MsgQueue;
+static osMemoryPoolId_t   MemPool;
+
+static void           *PoolBlock;
+static volatile uint32_t TimerCount;
+static volatile uint32_t Shared;
+
+static uint32_t Failed;
+
+static void Check (int ok, const char *what) {
+  printf("%-36s %s\n", what, ok ? "ok" : "FAILED");
+  if (!ok) {
+    Failed++;
+  }
+}
+
+/// Helper thread: wakes up the main thread blocked in each step
+static void Helper (void *argument) {
+  uint64_t msg = 0x0123456789ABCDEFULL;
+  (void)argument;
+
+  osDelay(5U);
+  (void)osThreadFlagsSet(MainThread, 0x0001U);
+
+  osDelay(5U);
+  (void)osSemaphoreRelease(Semaphore);
+
+  osDelay(5U);
+  (void)osEventFlagsSet(EventFlags, 0x0100U);
+
+  osDelay(5U);
+  (void)osMessageQueuePut(MsgQueue, &msg, 3U, osWaitForever);
+
+  osDelay(5U);
+  (void)osMemoryPoolFree(MemPool, PoolBlock);
+
+  (void)osMutexAcquire(Mutex, osWaitForever);
+  osDelay(5U);
+  Shared = 1U;
+  (void)osMutexRelease(Mutex);
+}
+
+static void Timer (void *argument) {
+  (void)argument;
+  TimerCount++;
+}
+
+static void Main (void *argument) {
+  osThreadId_t helper;
+  osTimerId_t  timer;
+  uint64_t     msg = 0U;
+  uint8_t      msg_prio = 0U;
+  uint32_t     tick;
+  void        *block;
+  (void)argument;
+
+  MainThread = osThreadGetId();
+  Semaphore  = osSemaphoreNew(1U, 0U, NULL);
+  Mutex      = osMutexNew(NULL);
+  EventFlags = osEventFlagsNew(NULL);
+  MsgQueue   = osMessageQueueNew(2U, sizeof(msg), NULL);
+  MemPool    = osMemoryPoolNew(1U, 64U, NULL);
+  Check((Semaphore != NULL) && (Mutex != NULL) && (EventFlags != NULL) &&
+        (MsgQueue  != NULL) && (MemPool != NULL), "object creation");
+
+  PoolBlock = osMemoryPoolAlloc(MemPool, 0U);
+  Check(PoolBlock != NULL, "memory pool allocation");
+
+  timer = osTimerNew(Timer, osTimerPeriodic, NULL, NULL);
+  Check((timer != NULL) && (osTimerStart(timer, 2U) == osOK), "periodic timer start");
+
+  tick = osKernelGetTickCount();
+  Check(osDelay(10U) == osOK, "delay");
+  Check((osKernelGetTickCount() - tick) >= 10U, "delay duration");
+
+  helper = osThreadNew(Helper, NULL, NULL);
+  Check(helper != NULL, "thread creation");
+
+  // Kernel runs on core 0: masks without it are rejected
+  Check((osThreadSetAffinityMask(helper, 0x02U) == osErrorParameter) &&
+        (osThreadSetAffinityMask(helper, 0x03U) == osOK) &&
+        (osThreadGetAffinityMask(helper) == 0x03U), "affinity mask");
+
+  Check(osThreadFlagsWait(0x0001U, osFlagsWaitAny, 100U) == 0x0001U, "thread flags wait");
+  Check(osSemaphoreAcquire(Semaphore, 100U) == osOK, "semaphore acquire");
+  Check(osEventFlagsWait(EventFlags, 0x0100U, osFlagsWaitAny, 100U) == 0x0100U, "event flags wait");
+  Check((osMessageQueueGet(MsgQueue, &msg, &msg_prio, 100U) == osOK) &&
+        (msg == 0x0123456789ABCDEFULL) && (msg_prio == 3U), "message queue get");
+
+  block = osMemoryPoolAlloc(MemPool, 100U);
+  Check(block == PoolBlock, "memory pool allocation wakeup");
+
+  osDelay(1U);
+  Check(osMutexAcquire(Mutex, 100U) == osOK, "mutex acquire");
+  Check(Shared == 1U, "mutex protected update");
+  (void)osMutexRelease(Mutex);
+
+  (void)osTimerStop(timer);
+  Check(TimerCount >= 5U, "periodic timer callbacks");
+
+  printf("%s\n", (Failed == 0U) ? "PASS" : "FAIL");
+  exit((Failed == 0U) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+int main (void) {
+
+  (void)osKernelInitialize();
+  (void)osThreadNew(Main, NULL, NULL);
+  (void)osKernelStart();
+
+  return EXIT_FAILURE;
+}
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-RTOS RTX
+ * Title:       POSIX Host test of the expired timer list (OS_TIMER_EXPIRED_LIST)
+ *              with a single Timer Callback Queue entry and inline callbacks
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "RTE_Components.h"
+#include  CMSIS_device_header
+#include "cmsis_os2.h"
+#include "rtx_os.h"
+
+#define ONCE_COUNT      4U              // One-shot timers expiring in consecutive ticks
+#define SPIN_TICKS      8U              // Ticks the timer thread is kept from running
+
+static osTimerId_t Periodic;
+static osTimerId_t Once[ONCE_COUNT];
+static osTimerId_t Deleted;
+static osTimerId_t Inline;
+
+// Timer thread callbacks: count, thread and order of the one-shot timers
+static volatile uint32_t PeriodicCount;
+static volatile uint32_t DeletedCount;
+static osThreadId_t      CallbackThread;
+static uint8_t           OnceLog[ONCE_COUNT + 1U];
+static volatile uint32_t OnceCount;
+
+// Inline callbacks: count and context
+static volatile uint32_t InlineCount;
+static volatile uint32_t InlineIpsr;
+
+// Errors reported to osRtxErrorNotify
+static volatile uint32_t ErrorCount;
+
+static uint32_t Failed;
+
+static void Check (int ok, const char *what) {
+  printf("%-36s %s\n", what, ok ? "ok" : "FAILED");
+  if (!ok) {
+    Failed++;
+  }
+}
+
+/// OS Error Callback: records errors (replaces the RTX_Config.c default)
+uint32_t osRtxErrorNotify (uint32_t code, void *object_id) {
+  (void)code;
+  (void)object_id;
+
+  ErrorCount++;
+  return 0U;
+}
+
+static void PeriodicCallback (void *argument) {
+  (void)argument;
+  CallbackThread = osThreadGetId();
+  PeriodicCount++;
+}
+
+static void OnceCallback (void *argument) {
+  if (OnceCount <= ONCE_COUNT) {
+    OnceLog[OnceCount] = (uint8_t)(uintptr_t)argument;
+  }
+  OnceCount++;
+}
+
+static void DeletedCallback (void *argument) {
+  (void)argument;
+  DeletedCount++;
+}
+
+static void InlineCallback (void *argument) {
+  (void)argument;
+  InlineIpsr = __get_IPSR();
+  InlineCount++;
+}
+
+static const osTimerAttr_t InlineAttr = {
+  .attr_bits = osRtxTimerCallbackInline
+};
+
+static void Main (void *argument) {
+  static const uint8_t expected[ONCE_COUNT] = { 1U, 2U, 3U, 4U };
+  uint32_t tick;
+  uint32_t i;
+  (void)argument;
+
+  Periodic = osTimerNew(PeriodicCallback, osTimerPeriodic, NULL, NULL);
+  Deleted  = osTimerNew(DeletedCallback,  osTimerOnce,     NULL, NULL);
+  Inline   = osTimerNew(InlineCallback,   osTimerPeriodic, NULL, &InlineAttr);
+  for (i = 0U; i < ONCE_COUNT; i++) {
+    Once[i] = osTimerNew(OnceCallback, osTimerOnce, (void *)(uintptr_t)(i + 1U), NULL);
+  }
+  Check((Periodic != NULL) && (Deleted != NULL) && (Inline != NULL) && (Once[ONCE_COUNT - 1U] != NULL),
+        "timer creation");
+
+  // Start the timers in the same tick, one-shot timers in reverse order
+  osDelay(1U);
+  (void)osTimerStart(Periodic, 1U);
+  (void)osTimerStart(Deleted,  2U);
+  (void)osTimerStart(Inline,   1U);
+  for (i = ONCE_COUNT; i > 0U; i--) {
+    (void)osTimerStart(Once[i - 1U], i);
+  }
+
+  // Keep the timer thread (below the main thread) from running
+  tick = osKernelGetTickCount();
+  while ((osKernelGetTickCount() - tick) < SPIN_TICKS) {
+    // Timers expire in the Kernel Tick
+  }
+  (void)osTimerStop(Periodic);
+  (void)osTimerStop(Inline);
+
+  Check((InlineCount >= (SPIN_TICKS - 1U)) && (InlineIpsr != 0U), "inline callbacks run in Kernel Tick");
+  Check((PeriodicCount == 0U) && (OnceCount == 0U), "callbacks deferred to timer thread");
+
+  // Pending callback of a deleted timer is discarded
+  (void)osTimerDelete(Deleted);
+
+  // Timer thread delivers the pending callbacks
+  osDelay(2U);
+  Check(PeriodicCount == 1U, "periodic expiries merged");
+  Check((CallbackThread != NULL) && (strcmp(osThreadGetName(CallbackThread), "osRtxTimer") == 0),
+        "delivered by timer thread");
+  Check((OnceCount == ONCE_COUNT) && (memcmp(OnceLog, expected, ONCE_COUNT) == 0),
+        "one-shot callbacks in expiry order");
+  Check(DeletedCount == 0U, "deleted timer callback discarded");
+  Check(ErrorCount == 0U, "no timer queue overflow");
+
+  printf("%s\n", (Failed == 0U) ? "PASS" : "FAIL");
+  exit((Failed == 0U) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+int main (void) {
+  static const osThreadAttr_t main_attr = { .priority = osPriorityRealtime };
+
+  (void)osKernelInitialize();
+  (void)osThreadNew(Main, NULL, &main_attr);
+  (void)osKernelStart();
+
+  return EXIT_FAILURE;
+}
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-RTOS RTX
+ * Title:       POSIX Host test of waiting for multiple objects (OS_THREAD_WAIT_ANY)
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "cmsis_os2.h"
+#include "rtx_os.h"
+
+static osSemaphoreId_t    Semaphore;
+static osEventFlagsId_t   EventFlags;
+static osMessageQueueId_t MsgQueue;
+
+static uint32_t Failed;
+
+static void Check (int ok, const char *what) {
+  printf("%-36s %s\n", what, ok ? "ok" : "FAILED");
+  if (!ok) {
+    Failed++;
+  }
+}
+
+/// Helper thread: signals the objects while the main thread is blocked
+static void Helper (void *argument) {
+  uint32_t msg = 0x12345678U;
+  (void)argument;
+
+  osDelay(5U);
+  (void)osEventFlagsSet(EventFlags, 0x0002U);
+
+  osDelay(5U);
+  (void)osMessageQueuePut(MsgQueue, &msg, 0U, 0U);
+
+  osDelay(5U);
+  (void)osMessageQueueDelete(MsgQueue);
+}
+
+/// Inline timer callback: releases the semaphore from the Kernel Tick (ISR)
+static void Isr (void *argument) {
+  (void)argument;
+  (void)osSemaphoreRelease(Semaphore);
+}
+
+static const osTimerAttr_t IsrAttr = {
+  .attr_bits = osRtxTimerCallbackInline
+};
+
+static void Main (void *argument) {
+  osRtxWaitObject_t objects[3];
+  osThreadId_t      helper;
+  osTimerId_t       timer;
+  uint32_t          msg = 0U;
+  uint32_t          tick;
+  int32_t           index;
+  (void)argument;
+
+  Semaphore  = osSemaphoreNew(1U, 0U, NULL);
+  EventFlags = osEventFlagsNew(NULL);
+  MsgQueue   = osMessageQueueNew(2U, sizeof(msg), NULL);
+  timer      = osTimerNew(Isr, osTimerOnce, NULL, &IsrAttr);
+  Check((Semaphore != NULL) && (EventFlags != NULL) && (MsgQueue != NULL) &&
+        (timer != NULL), "object creation");
+
+  objects[0].object_id = Semaphore;
+  objects[0].flags     = 0U;
+  objects[1].object_id = EventFlags;
+  objects[1].flags     = 0x0003U;
+  objects[2].object_id = MsgQueue;
+  objects[2].flags     = 0U;
+
+  // Invalid parameters
+  Check((osRtxThreadWaitAny(NULL, 1U, 0U) == osErrorParameter) &&
+        (osRtxThreadWaitAny(objects, 0U, 0U) == osErrorParameter) &&
+        (osRtxThreadWaitAny(objects, osRtxWaitObjectLimit + 1U, 0U) == osErrorParameter),
+        "invalid parameters");
+
+  // Nothing signaled
+  Check(osRtxThreadWaitAny(objects, 3U, 0U) == osErrorResource, "no object signaled");
+
+  // Signal before wait: lowest signaled index, nothing is consumed
+  (void)osEventFlagsSet(EventFlags, 0x0001U);
+  (void)osSemaphoreRelease(Semaphore);
+  Check(osRtxThreadWaitAny(objects, 3U, 0U) == 0, "signal before wait (semaphore)");
+  Check(osRtxThreadWaitAny(objects, 3U, 0U) == 0, "signal is not consumed");
+  Check(osSemaphoreAcquire(Semaphore, 0U) == osOK, "semaphore acquire");
+  Check(osRtxThreadWaitAny(objects, 3U, 0U) == 1, "signal before wait (event flags)");
+  Check(osEventFlagsWait(EventFlags, 0x0003U, osFlagsWaitAny, 0U) == 0x0001U, "event flags wait");
+
+  // Timeout
+  tick  = osKernelGetTickCount();
+  index = osRtxThreadWaitAny(objects, 3U, 5U);
+  Check((index == osErrorTimeout) && ((osKernelGetTickCount() - tick) >= 5U), "timeout");
+
+  // Wakeup from the Kernel Tick (ISR post processing)
+  (void)osTimerStart(timer, 2U);
+  Check(osRtxThreadWaitAny(objects, 3U, 100U) == 0, "wakeup from ISR");
+  Check(osSemaphoreAcquire(Semaphore, 0U) == osOK, "semaphore acquire from ISR");
+
+  // Wakeup from another thread
+  helper = osThreadNew(Helper, NULL, NULL);
+  Check(helper != NULL, "thread creation");
+
+  Check(osRtxThreadWaitAny(objects, 3U, 100U) == 1, "wakeup by event flags");
+  Check(osEventFlagsWait(EventFlags, 0x0003U, osFlagsWaitAny, 0U) == 0x0002U, "event flags wait");
+
+  Check(osRtxThreadWaitAny(objects, 3U, 100U) == 2, "wakeup by message");
+  Check((osMessageQueueGet(MsgQueue, &msg, NULL, 0U) == osOK) && (msg == 0x12345678U),
+        "message queue get");
+
+  // Object deleted while waiting
+  tick  = osKernelGetTickCount();
+  index = osRtxThreadWaitAny(objects, 3U, 100U);
+  Check((index == osErrorResource) && ((osKernelGetTickCount() - tick) < 100U), "object deletion");
+  Check(osRtxThreadWaitAny(objects, 3U, 0U) == osErrorParameter, "deleted object rejected");
+
+  (void)osTimerDelete(timer);
+
+  printf("%s\n", (Failed == 0U) ? "PASS" : "FAIL");
+  exit((Failed == 0U) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+int main (void) {
+
+  (void)osKernelInitialize();
+  (void)osThreadNew(Main, NULL, NULL);
+  (void)osKernelStart();
+
+  return EXIT_FAILURE;
+}
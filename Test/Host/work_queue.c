@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-RTOS RTX
+ * Title:       POSIX Host test of deferred work (OS_WORK_QUEUE, OS_WORK_BATCH=4)
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "RTE_Components.h"
+#include  CMSIS_device_header
+#include "cmsis_os2.h"
+#include "rtx_os.h"
+
+#define ITEM_COUNT      10U             // Soft IRQ items submitted from an interrupt
+#define MARKER          0xFFU           // Event of the interrupt served between batches
+#define LOG_SIZE        16U             // Event log entries
+
+static void SoftIrqWork (void *argument);
+static void ThreadWork  (void *argument);
+static void BatchWork   (void *argument);
+
+static osRtxWork_t SoftIrqItem = osRtxWorkInit(SoftIrqWork, NULL, osRtxWorkLevelSoftIrq);
+static osRtxWork_t ThreadItem  = osRtxWorkInit(ThreadWork,  NULL, osRtxWorkLevelThread);
+static osRtxWork_t BatchItem[ITEM_COUNT];
+
+// Work function calls, context and thread of the last call
+static volatile uint32_t SoftIrqCount;
+static volatile uint32_t SoftIrqIpsr;
+static volatile uint32_t ThreadCount;
+static osThreadId_t      ThreadId;
+
+// Event log: batch items (0..ITEM_COUNT-1) and the interrupt served between batches (MARKER)
+static uint8_t  EventLog[LOG_SIZE];
+static uint32_t EventCount;
+
+// Status of the submits from the interrupt handlers
+static osStatus_t IrqStatus;
+static osStatus_t MarkerStatus;
+
+static uint32_t Failed;
+
+static void Check (int ok, const char *what) {
+  printf("%-36s %s\n", what, ok ? "ok" : "FAILED");
+  if (!ok) {
+    Failed++;
+  }
+}
+
+static void LogEvent (uint8_t event) {
+  if (EventCount < LOG_SIZE) {
+    EventLog[EventCount] = event;
+  }
+  EventCount++;
+}
+
+static void SoftIrqWork (void *argument) {
+  (void)argument;
+  SoftIrqIpsr = __get_IPSR();
+  SoftIrqCount++;
+}
+
+static void ThreadWork (void *argument) {
+  (void)argument;
+  ThreadId = osThreadGetId();
+  ThreadCount++;
+}
+
+/// Batch item: the first one requests an interrupt that is served before the next batch
+static void BatchWork (void *argument) {
+  uint32_t i = (uint32_t)(uintptr_t)argument;
+
+  if (i == 0U) {
+    NVIC_SetPendingIRQ(Interrupt1_IRQn);
+  }
+  LogEvent((uint8_t)i);
+}
+
+/// Interrupt 0: submits the batch items and resubmits the first one
+static void IRQ0_Handler (void) {
+  uint32_t i;
+
+  IrqStatus = osOK;
+  for (i = 0U; i < ITEM_COUNT; i++) {
+    if (osRtxWorkSubmit(&BatchItem[i]) != osOK) {
+      IrqStatus = osError;
+    }
+  }
+  if (osRtxWorkSubmit(&BatchItem[0]) != osErrorResource) {
+    IrqStatus = osError;
+  }
+}
+
+/// Interrupt 1: served between the batches, submits a thread level item
+static void IRQ1_Handler (void) {
+  LogEvent(MARKER);
+  MarkerStatus = osRtxWorkSubmit(&ThreadItem);
+}
+
+static void Main (void *argument) {
+  static const uint8_t expected[] = { 0U, 1U, 2U, 3U, MARKER, 4U, 5U, 6U, 7U, 8U, 9U };
+  osRtxWork_t      invalid = osRtxWorkInit(SoftIrqWork, NULL, osRtxWorkLevels);
+  osRtxWorkStats_t stats;
+  uint32_t         i;
+  (void)argument;
+
+  Check((osRtxWorkSubmit(NULL) == osErrorParameter) &&
+        (osRtxWorkSubmit(&invalid) == osErrorParameter) &&
+        (osRtxWorkGetStats(osRtxWorkLevels, &stats) == osErrorParameter), "invalid parameters");
+
+  // Soft IRQ level: executed by PendSV before the submitting thread continues
+  Check(osRtxWorkSubmit(&SoftIrqItem) == osOK, "soft IRQ submit");
+  Check((SoftIrqCount == 1U) && (SoftIrqIpsr != 0U), "soft IRQ work executed in PendSV");
+
+  // Thread level: executed by the Work Thread below the main thread,
+  // a resubmit of the pending item is coalesced
+  Check(osRtxWorkSubmit(&ThreadItem) == osOK, "thread submit");
+  Check(osRtxWorkSubmit(&ThreadItem) == osErrorResource, "pending item coalesced");
+  Check(ThreadCount == 0U, "thread work deferred");
+  osDelay(1U);
+  Check((ThreadCount == 1U) && (ThreadId != osThreadGetId()) &&
+        (strcmp(osThreadGetName(ThreadId), "osRtxWork") == 0), "thread work executed once");
+  Check(osRtxWorkSubmit(&ThreadItem) == osOK, "resubmit after execution");
+  osDelay(1U);
+  Check(ThreadCount == 2U, "thread work executed again");
+
+  // Submit from an interrupt: batches of OS_WORK_BATCH items with a PendSV per batch
+  for (i = 0U; i < ITEM_COUNT; i++) {
+    BatchItem[i] = (osRtxWork_t)osRtxWorkInit(BatchWork, (void *)(uintptr_t)i, osRtxWorkLevelSoftIrq);
+  }
+  NVIC_SetVector(Interrupt0_IRQn, (uintptr_t)IRQ0_Handler);
+  NVIC_SetVector(Interrupt1_IRQn, (uintptr_t)IRQ1_Handler);
+  NVIC_EnableIRQ(Interrupt0_IRQn);
+  NVIC_EnableIRQ(Interrupt1_IRQn);
+  NVIC_SetPendingIRQ(Interrupt0_IRQn);
+  Check(IrqStatus == osOK, "submit from interrupt");
+  Check((EventCount == sizeof(expected)) && (memcmp(EventLog, expected, sizeof(expected)) == 0),
+        "batch limit and PendSV re-pend");
+  (void)osRtxWorkGetStats(osRtxWorkLevelSoftIrq, &stats);
+  Check((stats.count == (ITEM_COUNT + 1U)) && (stats.backlog == 0U) &&
+        (stats.backlog_max == ITEM_COUNT), "soft IRQ statistics");
+
+  // Thread level item submitted from an interrupt
+  osDelay(1U);
+  Check((MarkerStatus == osOK) && (ThreadCount == 3U), "thread work from interrupt");
+  (void)osRtxWorkGetStats(osRtxWorkLevelThread, &stats);
+  Check((stats.count == 3U) && (stats.backlog == 0U), "thread statistics");
+
+  printf("%s\n", (Failed == 0U) ? "PASS" : "FAIL");
+  exit((Failed == 0U) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+int main (void) {
+  static const osThreadAttr_t main_attr = { .priority = osPriorityRealtime };
+
+  (void)osKernelInitialize();
+  (void)osThreadNew(Main, NULL, &main_attr);
+  (void)osKernelStart();
+
+  return EXIT_FAILURE;
+}